@@ -16,8 +16,11 @@ ggoFiles = {
     'recenter':            'src/applications/recenter/recenter.ggo',
     'SequentialProps':     'src/applications/sequentialProps/SequentialProps.ggo',
     'simpleBuilder':       'src/applications/simpleBuilder/simpleBuilder.ggo',
+    'solvationBuilder':    'src/applications/solvationBuilder/solvationBuilder.ggo',
     'StaticProps':         'src/applications/staticProps/StaticProps.ggo',
-    'thermalizer':         'src/applications/thermalizer/thermalizer.ggo'
+    'thermalizer':         'src/applications/thermalizer/thermalizer.ggo',
+    'benchmark':           'src/applications/benchmark/benchmark.ggo',
+    'replicas':            'src/applications/replicas/replicas.ggo'
 }
         
 def which(program):
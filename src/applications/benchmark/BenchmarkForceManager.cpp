@@ -0,0 +1,231 @@
+/*
+ * Copyright (c) 2018 The University of Notre Dame. All Rights Reserved.
+ *
+ * The University of Notre Dame grants you ("Licensee") a
+ * non-exclusive, royalty free, license to use, modify and
+ * redistribute this software in source and binary code form, provided
+ * that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the
+ *    distribution.
+ *
+ * This software is provided "AS IS," without a warranty of any
+ * kind. All express or implied conditions, representations and
+ * warranties, including any implied warranty of merchantability,
+ * fitness for a particular purpose or non-infringement, are hereby
+ * excluded.  The University of Notre Dame and its licensors shall not
+ * be liable for any damages suffered by licensee as a result of
+ * using, modifying or distributing the software or its
+ * derivatives. In no event will the University of Notre Dame or its
+ * licensors be liable for any lost revenue, profit or data, or for
+ * direct, indirect, special, consequential, incidental or punitive
+ * damages, however caused and regardless of the theory of liability,
+ * arising out of the use of or inability to use software, even if the
+ * University of Notre Dame has been advised of the possibility of
+ * such damages.
+ *
+ * SUPPORT OPEN SCIENCE!  If you use OpenMD or its source code in your
+ * research, please cite the appropriate papers when you publish your
+ * work.  Good starting points are:
+ *                                                                      
+ * [1]  Meineke, et al., J. Comp. Chem. 26, 252-271 (2005).             
+ * [2]  Fennell & Gezelter, J. Chem. Phys. 124, 234104 (2006).          
+ * [3]  Sun, Lin & Gezelter, J. Chem. Phys. 128, 234107 (2008).          
+ * [4]  Kuang & Gezelter,  J. Chem. Phys. 133, 164101 (2010).
+ * [5]  Vardeman, Stocker & Gezelter, J. Chem. Theory Comput. 7, 834 (2011).
+ */
+
+#include <chrono>
+#include <map>
+#include <set>
+
+#include "applications/benchmark/BenchmarkForceManager.hpp"
+#include "brains/SnapshotManager.hpp"
+#include "nonbonded/InteractionManager.hpp"
+#include "parallel/ForceDecomposition.hpp"
+
+namespace OpenMD {
+
+  typedef std::chrono::steady_clock Clock;
+
+  static RealType secondsSince(Clock::time_point start) {
+    return std::chrono::duration<double>(Clock::now() - start).count();
+  }
+
+  RealType BenchmarkForceManager::timeForces(int nRepeats) {
+    // one untimed evaluation builds the neighbor list and sets up
+    // the interaction manager:
+    calcForces();
+
+    Clock::time_point start = Clock::now();
+    for (int i = 0; i < nRepeats; i++) calcForces();
+    RealType seconds = secondsSince(start) / nRepeats;
+
+    collectPairs();
+    return seconds;
+  }
+
+  RealType BenchmarkForceManager::timeNeighborList(int nRepeats) {
+    Clock::time_point start = Clock::now();
+    for (int i = 0; i < nRepeats; i++)
+      fDecomp_->buildNeighborList(neighborList_, point_);
+    return secondsSince(start) / nRepeats;
+  }
+
+  void BenchmarkForceManager::collectPairs() {
+    Snapshot* snap = info_->getSnapshotManager()->getCurrentSnapshot();
+    pairs_.clear();
+
+    for (int cg1 = 0; cg1 < int(point_.size()) - 1; cg1++) {
+      vector<int>& atomListRow = fDecomp_->getAtomsInGroupRow(cg1);
+
+      for (int m2 = point_[cg1]; m2 < point_[cg1+1]; m2++) {
+        int cg2 = neighborList_[m2];
+        Vector3d dGrp = fDecomp_->getIntergroupVector(cg1, cg2);
+        if (dGrp.lengthSquare() >= rCutSq_) continue;
+
+        vector<int>& atomListColumn = fDecomp_->getAtomsInGroupColumn(cg2);
+        bool singleAtoms = (atomListRow.size() == 1 && 
+                            atomListColumn.size() == 1);
+
+        for (unsigned int i = 0; i < atomListRow.size(); i++) {
+          for (unsigned int j = 0; j < atomListColumn.size(); j++) {
+            int atom1 = atomListRow[i];
+            int atom2 = atomListColumn[j];
+            if (fDecomp_->skipAtomPair(atom1, atom2, cg1, cg2)) continue;
+            if (fDecomp_->excludeAtomPair(atom1, atom2)) continue;
+
+            PairRecord p;
+            p.atom1 = atom1;
+            p.atom2 = atom2;
+            p.topoDist = fDecomp_->getTopologicalDistance(atom1, atom2);
+            if (singleAtoms) {
+              p.d = dGrp;
+            } else {
+              p.d = fDecomp_->getInteratomicVector(atom1, atom2);
+              snap->wrapVector(p.d);
+            }
+            p.r2 = p.d.lengthSquare();
+            pairs_.push_back(p);
+          }
+        }
+      }
+    }
+  }
+
+  RealType BenchmarkForceManager::sweep(const std::vector<int>& pairIndices,
+                                        NonBondedInteraction* kernel,
+                                        bool density, int nRepeats) {
+    InteractionData idat;
+    Vector3d d, f1, eField1, eField2;
+    RealType r2, rij, vdwMult, electroMult, vpair, sw(1.0);
+    RealType dVdFQ1, dVdFQ2, sPot1, sPot2;
+    potVec pot, exPot, selePot;
+    int topoDist;
+
+    idat.d = &d;
+    idat.r2 = &r2;
+    idat.rij = &rij;
+    idat.rcut = &rCut_;
+    idat.sw = &sw;
+    idat.topoDist = &topoDist;
+    idat.vdwMult = &vdwMult;
+    idat.electroMult = &electroMult;
+    idat.pot = &pot;
+    idat.excludedPot = &exPot;
+    idat.selePot = &selePot;
+    idat.vpair = &vpair;
+    idat.f1 = &f1;
+    idat.dVdFQ1 = &dVdFQ1;
+    idat.dVdFQ2 = &dVdFQ2;
+    idat.eField1 = &eField1;
+    idat.eField2 = &eField2;
+    idat.sPot1 = &sPot1;
+    idat.sPot2 = &sPot2;
+    idat.isSelected = false;
+    idat.shiftedPot = (cutoffMethod_ == SHIFTED_POTENTIAL);
+    idat.shiftedForce = (cutoffMethod_ == SHIFTED_FORCE ||
+                         cutoffMethod_ == TAYLOR_SHIFTED);
+    idat.doParticlePot = doParticlePot_;
+    idat.doElectricField = doElectricField_;
+    idat.doSitePotential = doSitePotential_;
+
+    MetallicInteraction* metal = density ? 
+      dynamic_cast<MetallicInteraction*>(kernel) : NULL;
+
+    Clock::time_point start = Clock::now();
+    for (int r = 0; r < nRepeats; r++) {
+      for (unsigned int i = 0; i < pairIndices.size(); i++) {
+        const PairRecord& p = pairs_[pairIndices[i]];
+        fDecomp_->fillInteractionData(idat, p.atom1, p.atom2);
+        d = p.d;
+        r2 = p.r2;
+        rij = sqrt(r2);
+        topoDist = p.topoDist;
+        vdwMult = vdwScale_[topoDist];
+        electroMult = electrostaticScale_[topoDist];
+        f1.zero();
+
+        if (metal != NULL) 
+          metal->calcDensity(idat);
+        else if (kernel != NULL) 
+          kernel->calcForce(idat);
+      }
+    }
+    return secondsSince(start) / nRepeats;
+  }
+
+  std::vector<BenchmarkForceManager::KernelTiming> 
+  BenchmarkForceManager::timeKernels(int nRepeats) {
+    std::vector<KernelTiming> timings;
+
+    // sort the pairs by the kernels that apply to them (keyed by
+    // name so the report order is reproducible):
+    std::vector<int> allPairs;
+    std::map<std::string, NonBondedInteraction*> kernelNames;
+    std::map<std::string, std::vector<int> > kernelPairs;
+    InteractionData idat;
+    for (unsigned int i = 0; i < pairs_.size(); i++) {
+      fDecomp_->fillInteractionData(idat, pairs_[i].atom1, pairs_[i].atom2);
+      set<NonBondedInteraction*>& kernels = 
+        interactionMan_->getInteractions(idat.atid1, idat.atid2);
+      set<NonBondedInteraction*>::iterator k;
+      for (k = kernels.begin(); k != kernels.end(); ++k) {
+        kernelNames[(*k)->getName()] = *k;
+        kernelPairs[(*k)->getName()].push_back(i);
+      }
+      allPairs.push_back(i);
+    }
+
+    KernelTiming setup;
+    setup.name = "pair setup";
+    setup.nPairs = allPairs.size();
+    setup.seconds = sweep(allPairs, NULL, false, nRepeats);
+    timings.push_back(setup);
+    RealType setupPerPair = setup.nPairs > 0 ? 
+      setup.seconds / setup.nPairs : 0.0;
+
+    std::map<std::string, std::vector<int> >::iterator i;
+    for (i = kernelPairs.begin(); i != kernelPairs.end(); ++i) {
+      NonBondedInteraction* kernel = kernelNames[i->first];
+      int nPasses = (kernel->getFamily() == METALLIC_FAMILY) ? 2 : 1;
+
+      for (int pass = 0; pass < nPasses; pass++) {
+        bool density = (pass == 1);
+        KernelTiming t;
+        t.name = kernel->getName() + (density ? " density" : "");
+        t.nPairs = i->second.size();
+        t.seconds = sweep(i->second, kernel, density, nRepeats) - 
+          setupPerPair * t.nPairs;
+        if (t.seconds < 0.0) t.seconds = 0.0;
+        timings.push_back(t);
+      }
+    }
+    return timings;
+  }
+}
@@ -0,0 +1,108 @@
+/*
+ * Copyright (c) 2018 The University of Notre Dame. All Rights Reserved.
+ *
+ * The University of Notre Dame grants you ("Licensee") a
+ * non-exclusive, royalty free, license to use, modify and
+ * redistribute this software in source and binary code form, provided
+ * that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the
+ *    distribution.
+ *
+ * This software is provided "AS IS," without a warranty of any
+ * kind. All express or implied conditions, representations and
+ * warranties, including any implied warranty of merchantability,
+ * fitness for a particular purpose or non-infringement, are hereby
+ * excluded.  The University of Notre Dame and its licensors shall not
+ * be liable for any damages suffered by licensee as a result of
+ * using, modifying or distributing the software or its
+ * derivatives. In no event will the University of Notre Dame or its
+ * licensors be liable for any lost revenue, profit or data, or for
+ * direct, indirect, special, consequential, incidental or punitive
+ * damages, however caused and regardless of the theory of liability,
+ * arising out of the use of or inability to use software, even if the
+ * University of Notre Dame has been advised of the possibility of
+ * such damages.
+ *
+ * SUPPORT OPEN SCIENCE!  If you use OpenMD or its source code in your
+ * research, please cite the appropriate papers when you publish your
+ * work.  Good starting points are:
+ *                                                                      
+ * [1]  Meineke, et al., J. Comp. Chem. 26, 252-271 (2005).             
+ * [2]  Fennell & Gezelter, J. Chem. Phys. 124, 234104 (2006).          
+ * [3]  Sun, Lin & Gezelter, J. Chem. Phys. 128, 234107 (2008).          
+ * [4]  Kuang & Gezelter,  J. Chem. Phys. 133, 164101 (2010).
+ * [5]  Vardeman, Stocker & Gezelter, J. Chem. Theory Comput. 7, 834 (2011).
+ */
+
+#ifndef APPLICATIONS_BENCHMARK_BENCHMARKFORCEMANAGER_HPP
+#define APPLICATIONS_BENCHMARK_BENCHMARKFORCEMANAGER_HPP
+
+#include <string>
+#include <vector>
+
+#include "brains/ForceManager.hpp"
+
+namespace OpenMD {
+
+  /**
+   * @class BenchmarkForceManager
+   * @brief A ForceManager that times the pieces of the force
+   * calculation in isolation.
+   *
+   * The kernel timings replay the atom pairs that were inside the
+   * cutoff during the last force evaluation and call each non-bonded
+   * interaction (LJ, Electrostatic, EAM, ...) on its own.  The forces
+   * computed during these sweeps are thrown away.  Excluded pairs are
+   * not replayed, so the indirect electrostatic corrections for those
+   * pairs are only included in the full force evaluation.
+   */
+  class BenchmarkForceManager : public ForceManager {
+  public:
+    struct KernelTiming {
+      std::string name;   ///< kernel name, e.g. "LJ" or "EAM density"
+      long long nPairs;   ///< pairs handed to the kernel in one sweep
+      RealType seconds;   ///< wall clock seconds for one sweep
+    };
+
+    BenchmarkForceManager(SimInfo* info) : ForceManager(info) {}
+
+    /** Returns the wall clock seconds for one full force evaluation */
+    RealType timeForces(int nRepeats);
+
+    /** Returns the wall clock seconds for one neighbor list build */
+    RealType timeNeighborList(int nRepeats);
+
+    /**
+     * Times each non-bonded kernel over the pairs from the last force
+     * evaluation.  The first entry is the cost of filling the
+     * interaction data for every pair, which has already been
+     * subtracted from the kernel timings.
+     */
+    std::vector<KernelTiming> timeKernels(int nRepeats);
+
+    /** Number of atom pairs inside the cutoff in the last evaluation */
+    long long getNPairsInCutoff() { return pairs_.size(); }
+
+  private:
+    struct PairRecord {
+      int atom1;
+      int atom2;
+      int topoDist;
+      Vector3d d;
+      RealType r2;
+    };
+
+    void collectPairs();
+    RealType sweep(const std::vector<int>& pairIndices,
+                   NonBondedInteraction* kernel, bool density, int nRepeats);
+
+    std::vector<PairRecord> pairs_;
+  };
+}
+#endif
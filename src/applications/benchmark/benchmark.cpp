@@ -0,0 +1,218 @@
+/*
+ * Copyright (c) 2018 The University of Notre Dame. All Rights Reserved.
+ *
+ * The University of Notre Dame grants you ("Licensee") a
+ * non-exclusive, royalty free, license to use, modify and
+ * redistribute this software in source and binary code form, provided
+ * that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the
+ *    distribution.
+ *
+ * This software is provided "AS IS," without a warranty of any
+ * kind. All express or implied conditions, representations and
+ * warranties, including any implied warranty of merchantability,
+ * fitness for a particular purpose or non-infringement, are hereby
+ * excluded.  The University of Notre Dame and its licensors shall not
+ * be liable for any damages suffered by licensee as a result of
+ * using, modifying or distributing the software or its
+ * derivatives. In no event will the University of Notre Dame or its
+ * licensors be liable for any lost revenue, profit or data, or for
+ * direct, indirect, special, consequential, incidental or punitive
+ * damages, however caused and regardless of the theory of liability,
+ * arising out of the use of or inability to use software, even if the
+ * University of Notre Dame has been advised of the possibility of
+ * such damages.
+ *
+ * SUPPORT OPEN SCIENCE!  If you use OpenMD or its source code in your
+ * research, please cite the appropriate papers when you publish your
+ * work.  Good starting points are:
+ *                                                                      
+ * [1]  Meineke, et al., J. Comp. Chem. 26, 252-271 (2005).             
+ * [2]  Fennell & Gezelter, J. Chem. Phys. 124, 234104 (2006).          
+ * [3]  Sun, Lin & Gezelter, J. Chem. Phys. 128, 234107 (2008).          
+ * [4]  Kuang & Gezelter,  J. Chem. Phys. 133, 164101 (2010).
+ * [5]  Vardeman, Stocker & Gezelter, J. Chem. Theory Comput. 7, 834 (2011).
+ */
+
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "benchmarkCmd.hpp"
+#include "applications/benchmark/BenchmarkForceManager.hpp"
+#include "brains/Register.hpp"
+#include "brains/SimCreator.hpp"
+#include "brains/SimInfo.hpp"
+#include "brains/SnapshotManager.hpp"
+#include "integrators/Integrator.hpp"
+#include "integrators/IntegratorFactory.hpp"
+#include "utils/Revision.hpp"
+#include "utils/StringUtils.hpp"
+#include "utils/TimerRegistry.hpp"
+#include "utils/simError.h"
+
+using namespace OpenMD;
+
+static void writeLine(std::ostream& out, const std::string& system,
+                      const std::string& measurement, RealType seconds,
+                      long long nPairs, RealType nsPerDay) {
+  char line[256];
+  char perPair[32];
+  char rate[32];
+  if (nPairs > 0)
+    sprintf(perPair, "%12.3f", 1.0e9 * seconds / nPairs);
+  else
+    sprintf(perPair, "%12s", "-");
+  if (nsPerDay > 0.0)
+    sprintf(rate, "%12.4f", nsPerDay);
+  else
+    sprintf(rate, "%12s", "-");
+  sprintf(line, "%-28s %-24s %12.4f %12lld %s %s\n", system.c_str(),
+          measurement.c_str(), 1.0e3 * seconds, nPairs, perPair, rate);
+  out << line;
+}
+
+int main(int argc, char* argv[]) {
+
+  initSimError();
+
+  gengetopt_args_info args_info;
+  if (cmdline_parser(argc, argv, &args_info) != 0) {
+    cmdline_parser_print_help();
+    exit(1);
+  }
+
+  if (args_info.inputs_num == 0) {
+    sprintf(painCave.errMsg, 
+            "No OpenMD files to benchmark were given on the command line.\n");
+    painCave.severity = OPENMD_ERROR;
+    painCave.isFatal = 1;
+    simError();
+  }
+
+  int nRepeats = args_info.repeats_arg;
+  if (nRepeats < 1) {
+    sprintf(painCave.errMsg, "The number of repeats must be at least 1.\n");
+    painCave.severity = OPENMD_ERROR;
+    painCave.isFatal = 1;
+    simError();
+  }
+
+  std::ofstream outFile;
+  if (args_info.output_given) outFile.open(args_info.output_arg);
+  std::ostream& out = args_info.output_given ? outFile : std::cout;
+
+  registerAll();
+
+  Revision r;
+  out << "# OpenMD benchmark: " << r.getFullRevision() << "\n";
+  out << "# precision: " 
+      << (sizeof(RealType) == sizeof(float) ? "single" : "double")
+      << ", repeats: " << nRepeats << "\n";
+  char header[256];
+  sprintf(header, "#%-27s %-24s %12s %12s %12s %12s\n", "system", 
+          "measurement", "ms/call", "pairs", "ns/pair", "ns/day");
+  out << header;
+
+  TimerRegistry* timers = TimerRegistry::getInstance();
+  const char* phases[] = {"Force/ShortRange", 
+                          "Force/LongRange/NeighborList",
+                          "Force/LongRange/PairLoop",
+                          "Force/LongRange/ReciprocalSpace"};
+  const int nPhases = sizeof(phases) / sizeof(phases[0]);
+
+  for (unsigned int f = 0; f < args_info.inputs_num; f++) {
+    std::string fileName = args_info.inputs[f];
+    std::string system = getPrefix(fileName);
+
+    SimCreator creator;
+    SimInfo* info = creator.createSim(fileName);
+    Globals* simParams = info->getSimParams();
+
+    BenchmarkForceManager* fman = new BenchmarkForceManager(info);
+    fman->initialize();
+
+    // full force evaluations, with the phase breakdown taken from
+    // the timer registry:
+    std::vector<double> phaseBefore(nPhases);
+    for (int p = 0; p < nPhases; p++) 
+      phaseBefore[p] = timers->getTime(phases[p]);
+    RealType forceTime = fman->timeForces(nRepeats);
+    long long nPairs = fman->getNPairsInCutoff();
+
+    writeLine(out, system, "force evaluation", forceTime, nPairs, 0.0);
+    for (int p = 0; p < nPhases; p++) {
+      // the untimed warm-up call is included in the registry totals:
+      RealType phaseTime = (timers->getTime(phases[p]) - phaseBefore[p]) /
+        (nRepeats + 1);
+      if (phaseTime <= 0.0) continue;
+      std::string phase(phases[p]);
+      writeLine(out, system, "  " + phase.substr(phase.rfind('/') + 1), 
+                phaseTime, nPairs, 0.0);
+    }
+
+    writeLine(out, system, "neighbor list build", 
+              fman->timeNeighborList(nRepeats), 0, 0.0);
+
+    std::vector<BenchmarkForceManager::KernelTiming> kernels = 
+      fman->timeKernels(nRepeats);
+    for (unsigned int k = 0; k < kernels.size(); k++) 
+      writeLine(out, system, "kernel " + kernels[k].name, 
+                kernels[k].seconds, kernels[k].nPairs, 0.0);
+
+    bool runSteps = simParams->haveEnsemble();
+    delete fman;
+    delete info;
+
+    // Full MD steps for the run time given in the file.  The system
+    // is created again so that the integrator sets up its own force
+    // manager (some integrators need a particular kind):
+    if (runSteps) {
+      info = creator.createSim(fileName);
+      simParams = info->getSimParams();
+
+      Integrator* integrator = IntegratorFactory::getInstance()->
+        createIntegrator(toUpperCopy(simParams->getEnsemble()), info);
+      if (integrator == NULL) {
+        sprintf(painCave.errMsg,
+                "Integrator Factory can not create %s Integrator\n",
+                simParams->getEnsemble().c_str());
+        painCave.isFatal = 1;
+        simError();
+      }
+
+      SnapshotManager* sman = info->getSnapshotManager();
+      RealType startTime = sman->getCurrentSnapshot()->getTime();
+      std::chrono::steady_clock::time_point start = 
+        std::chrono::steady_clock::now();
+      integrator->integrate();
+      RealType seconds = std::chrono::duration<double>
+        (std::chrono::steady_clock::now() - start).count();
+      RealType dt = simParams->getDt();
+      int nSteps = int((sman->getCurrentSnapshot()->getTime() - startTime) / 
+                       dt + 0.5);
+      delete integrator;
+
+      if (nSteps > 0 && seconds > 0.0) {
+        RealType stepTime = seconds / nSteps;
+        // dt is in fs, and 1 ns = 1e6 fs:
+        RealType nsPerDay = dt * 1.0e-6 * 86400.0 / stepTime;
+        writeLine(out, system, "MD step", stepTime, nPairs, nsPerDay);
+      }
+      delete info;
+    }
+  }
+
+  cmdline_parser_free(&args_info);
+  return 0;
+}
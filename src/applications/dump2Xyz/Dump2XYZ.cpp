@@ -43,6 +43,7 @@
 #include <iostream>
 #include <fstream>
 #include <string>
+#include <thread>
 
 #include "Dump2XYZCmd.hpp"
 #include "brains/Register.hpp"
@@ -65,6 +66,11 @@
 using namespace OpenMD;
 
 using namespace std;
+
+static void writeFrameText(ostream* os, const string* frameText) {
+  os->write(frameText->data(), frameText->size());
+}
+
 int main(int argc, char* argv[]){
   
   gengetopt_args_info args_info;
@@ -226,15 +232,31 @@ int main(int argc, char* argv[]){
   }
 
   compositeVisitor->addVisitor(xyzVisitor, 200); 
-  
-  //create prepareVisitor
-  PrepareVisitor* prepareVisitor = new PrepareVisitor();
+
+  // The visitors keep their output records in a table indexed by
+  // global index.  The records are reused from frame to frame, so
+  // clearing the table replaces the PrepareVisitor sweep.
+  AtomDataTable atomDataTable(info->getNGlobalAtoms() + 
+                              info->getNGlobalRigidBodies());
+  compositeVisitor->setAtomDataTable(&atomDataTable);
   
   //open dump file
   DumpReader* dumpReader = new DumpReader(info, dumpFileName);
   int nframes = dumpReader->getNFrames();
   
   ofstream xyzStream(xyzFileName.c_str());
+
+  // Frames are converted in a three stage pipeline: while frame i is
+  // parsed and visited, a reader thread fetches the text of the next
+  // frame and a writer thread flushes the formatted previous frame.
+  // Parsing itself stays on this thread since it fills the shared
+  // snapshot.
+  ifstream textStream(dumpFileName.c_str(), ifstream::in | ifstream::binary);
+  string frameText, nextFrameText;
+  string xyzText, pendingXyzText;
+  thread writer;
+
+  if (nframes > 0) dumpReader->readFrameText(textStream, 0, frameText);
   
   SimInfo::MoleculeIterator miter;
   Molecule::IntegrableObjectIterator  iiter;
@@ -249,7 +271,13 @@ int main(int argc, char* argv[]){
   Snapshot* currentSnapshot;
        
   for (int i = 0; i < nframes; i += args_info.frame_arg){
-    dumpReader->readFrame(i);
+    int next = i + args_info.frame_arg;
+    thread reader;
+    if (next < nframes) 
+      reader = thread(&DumpReader::readFrameText, dumpReader, 
+                      std::ref(textStream), next, std::ref(nextFrameText));
+
+    dumpReader->readFrame(i, frameText);
     
     if (printFrc) forceMan->calcForces();
     
@@ -288,16 +316,7 @@ int main(int argc, char* argv[]){
     }
     
     //prepare visit
-    for (mol = info->beginMolecule(miter); mol != NULL; 
-         mol = info->nextMolecule(miter)) {
-
-      for (sd = mol->beginIntegrableObject(iiter); sd != NULL;
-           sd = mol->nextIntegrableObject(iiter)) {
-
-        sd->accept(prepareVisitor);
-
-      }
-    }
+    atomDataTable.clear();
     
     //update visitor
     compositeVisitor->update();
@@ -315,13 +334,21 @@ int main(int argc, char* argv[]){
       }
     }
     
-    xyzVisitor->writeFrame(xyzStream);
+    xyzVisitor->formatFrame(xyzText);
     xyzVisitor->clear();
+
+    if (writer.joinable()) writer.join();
+    pendingXyzText.swap(xyzText);
+    writer = thread(writeFrameText, &xyzStream, &pendingXyzText);
+
+    if (reader.joinable()) reader.join();
+    frameText.swap(nextFrameText);
     
   }//end for (int i = 0; i < nframes; i += args_info.frame_arg)
+
+  if (writer.joinable()) writer.join();
  
   xyzStream.close();
-  delete prepareVisitor; 
   delete compositeVisitor;
   delete info;
 }
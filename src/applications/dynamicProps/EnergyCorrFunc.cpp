@@ -194,6 +194,7 @@ namespace OpenMD {
     bool firsttime = true;
     for (int i = 0; i < nblocks; ++i) {
       bsMan_->loadBlock(i);
+      bsMan_->prefetchBlock(i + 1);
       assert(bsMan_->isBlockActive(i));      
       SnapshotBlock block1 = bsMan_->getSnapshotBlock(i);
       for (int j = block1.first; j < block1.second; ++j) {
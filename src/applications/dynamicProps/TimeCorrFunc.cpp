@@ -105,22 +105,36 @@ namespace OpenMD {
   void TimeCorrFunc::doCorrelate() {
     preCorrelate();
 
-    int nblocks = bsMan_->getNBlocks();
+    // visit the block pairs in an order that lets the cached blocks
+    // be reused, and read the next missing block from disk while the
+    // current pair is being correlated:
+    std::vector<SnapshotBlock> schedule = bsMan_->getBlockPairSchedule();
 
-    for (int i = 0; i < nblocks; ++i) {
-      bsMan_->loadBlock(i);
+    for (unsigned int k = 0; k < schedule.size(); ++k) {
+      int i = schedule[k].first;
+      int j = schedule[k].second;
 
-      for (int j = i; j < nblocks; ++j) {
-	bsMan_->loadBlock(j);
-	correlateBlocks(i, j);
-	bsMan_->unloadBlock(j);
+      bsMan_->loadBlock(i);
+      bsMan_->loadBlock(j);
+
+      if (k + 1 < schedule.size()) {
+        SnapshotBlock next = schedule[k + 1];
+        if (!bsMan_->isBlockActive(next.first))
+          bsMan_->prefetchBlock(next.first);
+        else
+          bsMan_->prefetchBlock(next.second);
       }
-        
+
+      correlateBlocks(i, j);
+
+      bsMan_->unloadBlock(j);
       bsMan_->unloadBlock(i);
     }
     
     postCorrelate();
 
+    bsMan_->printStatistics();
+
     writeCorrelate();
   }
 
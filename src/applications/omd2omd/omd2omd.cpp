@@ -43,6 +43,9 @@
 #include <iostream>
 #include <fstream>
 #include <string>
+#include <sstream>
+#include <thread>
+#include <algorithm>
 
 #include "omd2omdCmd.hpp"
 #include "brains/Register.hpp"
@@ -61,6 +64,31 @@ using namespace std;
 
 void createMdFile(const std::string&oldMdFileName, const std::string&newMdFileName, std::vector<int> nMol);
 
+/**
+ * Everything the streaming path needs to place the replicas of one
+ * molecule.  The old system is only read while the replicas are
+ * formatted, so a single plan is shared by all of the threads.
+ */
+struct ReplicationPlan {
+  std::vector<Molecule*> mols;
+  std::vector<int> firstObject;  // number of integrable objects before mol
+  Vector3i repeat;
+  int nReplicas;
+  Mat3x3d rotMatrix;
+  Mat3x3d rotInverse;
+  Vector3d translate;
+  Snapshot* oldSnap;
+  Mat3x3d oldHmat;
+};
+
+std::string createMetaData(const std::string& rawMetaData, 
+                           std::vector<int> nMol);
+void replicateMolecules(const ReplicationPlan* plan, int firstCopy, 
+                        int lastCopy, std::string* text);
+void streamReplicas(SimInfo* oldInfo, DumpReader* dumpReader,
+                    const std::string& outFileName, ReplicationPlan& plan,
+                    const Mat3x3d& repeatD, std::vector<int> nMol);
+
 int main(int argc, char* argv[]){
   
   gengetopt_args_info args_info;
@@ -129,6 +157,20 @@ int main(int argc, char* argv[]){
     nMol.push_back(nMolNew);
   }
   
+  if (args_info.stream_flag) {
+    ReplicationPlan plan;
+    plan.repeat = repeat;
+    plan.rotMatrix = rotMatrix;
+    plan.rotInverse = rotMatrix.inverse();
+    plan.translate = translate;
+
+    DumpReader* dumpReader = new DumpReader(oldInfo, dumpFileName);
+    streamReplicas(oldInfo, dumpReader, outFileName, plan, repeatD, nMol);
+    delete dumpReader;
+    delete oldInfo;
+    return 0;
+  }
+
   createMdFile(dumpFileName, outFileName, nMol);
 
   SimCreator newCreator;
@@ -240,6 +282,172 @@ int main(int argc, char* argv[]){
   delete oldInfo;
 }
 
+/**
+ * Writes the replicated frames straight to the output file.  The
+ * replicated SimInfo is never built: each replica is formatted from
+ * the StuntDoubles of the original system, with the (molecule,
+ * replica) copies of a frame split into rounds whose contiguous
+ * ranges are formatted concurrently and then written in order.
+ */
+void streamReplicas(SimInfo* oldInfo, DumpReader* dumpReader,
+                    const std::string& outFileName, ReplicationPlan& plan,
+                    const Mat3x3d& repeatD, std::vector<int> nMol) {
+  SimInfo::MoleculeIterator miter;
+  Molecule* mol;
+  
+  int nObjects = 0;
+  for (mol = oldInfo->beginMolecule(miter); mol != NULL; 
+       mol = oldInfo->nextMolecule(miter)) {
+    plan.mols.push_back(mol);
+    plan.firstObject.push_back(nObjects);
+    nObjects += mol->getNIntegrableObjects();
+  }
+  plan.nReplicas = plan.repeat.x() * plan.repeat.y() * plan.repeat.z();
+
+  int nCopies = plan.mols.size() * plan.nReplicas;
+  int nThreads = std::max(1u, std::thread::hardware_concurrency());
+
+  // bound the text held in memory to roughly a million objects per round
+  int objectsPerMol = std::max(1, nObjects / std::max(1, int(plan.mols.size())));
+  int copiesPerRound = std::max(nThreads, (1 << 20) / objectsPerMol);
+
+  std::ofstream outFile(outFileName.c_str());
+  if (!outFile) {
+    sprintf(painCave.errMsg, "Could not open \"%s\" for dump output.\n",
+            outFileName.c_str());
+    painCave.isFatal = 1;
+    simError();
+  }
+
+  outFile << "<OpenMD version=2>" << std::endl;
+  outFile << "  <MetaData>" << std::endl;
+  outFile << createMetaData(oldInfo->getRawMetaData(), nMol);
+  outFile << "  </MetaData>" << std::endl;
+
+  std::vector<std::string> texts(nThreads);
+  std::vector<std::thread> workers(nThreads);
+  int nframes = dumpReader->getNFrames();
+
+  for (int i = 0; i < nframes; i++){
+    cerr << "frame = " << i << "\n";
+    dumpReader->readFrame(i);
+    plan.oldSnap = oldInfo->getSnapshotManager()->getCurrentSnapshot();
+    plan.oldHmat = plan.oldSnap->getHmat();
+    
+    outFile << "  <Snapshot>\n";
+    DumpWriter::writeFrameProperties(outFile, plan.oldSnap, 
+                                     repeatD * (plan.rotMatrix * plan.oldHmat));
+    outFile << "    <StuntDoubles>\n";
+
+    for (int first = 0; first < nCopies; first += copiesPerRound) {
+      int last = std::min(first + copiesPerRound, nCopies);
+      int chunk = (last - first + nThreads - 1) / nThreads;
+
+      for (int t = 0; t < nThreads; t++) {
+        int lo = std::min(first + t * chunk, last);
+        int hi = std::min(lo + chunk, last);
+        workers[t] = std::thread(replicateMolecules, &plan, lo, hi, &texts[t]);
+      }
+      for (int t = 0; t < nThreads; t++) {
+        workers[t].join();
+        outFile << texts[t];
+      }
+    }
+
+    outFile << "    </StuntDoubles>\n";
+    outFile << "  </Snapshot>\n";
+  }
+  
+  outFile << "</OpenMD>\n";
+  outFile.close();
+}
+
+/**
+ * Formats the copies [firstCopy, lastCopy) as dump lines.  Copy c is
+ * replica (c % nReplicas) of molecule (c / nReplicas), which matches
+ * the ordering of the integrable objects in the replicated system.
+ */
+void replicateMolecules(const ReplicationPlan* plan, int firstCopy, 
+                        int lastCopy, std::string* text) {
+  Molecule::IntegrableObjectIterator iiter;
+  StuntDouble* sd;
+  char buffer[4096];
+  int ny = plan->repeat.y();
+  int nz = plan->repeat.z();
+
+  text->clear();
+
+  for (int c = firstCopy; c < lastCopy; c++) {
+    Molecule* mol = plan->mols[c / plan->nReplicas];
+    int r = c % plan->nReplicas;
+    Vector3d trans = Vector3d(r / (ny * nz), (r / nz) % ny, r % nz);
+    int newIndex = plan->firstObject[c / plan->nReplicas] * plan->nReplicas 
+      + r * mol->getNIntegrableObjects();
+
+    for (sd = mol->beginIntegrableObject(iiter); sd != NULL;
+         sd = mol->nextIntegrableObject(iiter)) {
+      Vector3d oldPos = sd->getPos() + plan->translate;
+      plan->oldSnap->wrapVector(oldPos);
+      Vector3d newPos = plan->rotMatrix*oldPos + trans * plan->oldHmat;
+      Vector3d newVel = plan->rotMatrix*sd->getVel();
+
+      if (sd->isDirectional()) {
+        RotMat3x3d bodyRotMat = sd->getA() * plan->rotInverse;
+        Quat4d q = bodyRotMat.toQuaternion();
+        Vector3d ji = plan->rotMatrix * sd->getJ();
+        sprintf(buffer, "%10d %7s %18.10g %18.10g %18.10g %13e %13e %13e"
+                " %13e %13e %13e %13e %13e %13e %13e\n", newIndex, "pvqj",
+                newPos[0], newPos[1], newPos[2],
+                newVel[0], newVel[1], newVel[2],
+                q[0], q[1], q[2], q[3], ji[0], ji[1], ji[2]);
+      } else {
+        sprintf(buffer, "%10d %7s %18.10g %18.10g %18.10g %13e %13e %13e\n",
+                newIndex, "pv", newPos[0], newPos[1], newPos[2],
+                newVel[0], newVel[1], newVel[2]);
+      }
+      *text += buffer;
+      newIndex++;
+    }
+  }
+}
+
+/**
+ * The MetaData block of the replicated system: the original one with
+ * the nMol statement of every component replaced.
+ */
+std::string createMetaData(const std::string& rawMetaData, 
+                           std::vector<int> nMol) {
+  std::istringstream oldMetaData(rawMetaData);
+  std::string newMetaData;
+  std::string line;
+  char buffer[1024];
+  
+  std::size_t i = 0;
+  while (std::getline(oldMetaData, line)) {
+    
+    //correct molecule number
+    if (line.find("nMol") != std::string::npos) {
+      if (i<nMol.size()){
+        sprintf(buffer, "\tnMol = %i;", nMol.at(i));
+        newMetaData += buffer;
+        newMetaData += '\n';
+        i++;
+      }
+    } else {
+      newMetaData += line;
+      newMetaData += '\n';
+    }
+  }
+
+  if (i != nMol.size()) {
+    sprintf(painCave.errMsg, "Couldn't replace the correct number of nMol\n"
+            "\tstatements in component blocks.");
+    painCave.isFatal = 1;
+    simError();
+  }
+  return newMetaData;
+}
+
 void createMdFile(const std::string&oldMdFileName, 
                   const std::string&newMdFileName, 
                   std::vector<int> nMol) {
@@ -46,10 +46,12 @@ const char *gengetopt_args_info_help[] = {
   "  -p, --rotatePhi=DOUBLE    rotate all coordinates Euler angle Phi\n                              (default=`0.0')",
   "  -q, --rotateTheta=DOUBLE  rotate all coordinates Euler angle Theta\n                              (default=`0.0')",
   "  -r, --rotatePsi=DOUBLE    rotate all coordinates Euler angle Psi\n                              (default=`0.0')",
+  "  -s, --stream              write the replicated frames directly, in parallel,\n                              without building the replicated system\n                              (default=off)",
     0
 };
 
 typedef enum {ARG_NO
+  , ARG_FLAG
   , ARG_STRING
   , ARG_INT
   , ARG_DOUBLE
@@ -86,6 +88,7 @@ void clear_given (struct gengetopt_args_info *args_info)
   args_info->rotatePhi_given = 0 ;
   args_info->rotateTheta_given = 0 ;
   args_info->rotatePsi_given = 0 ;
+  args_info->stream_given = 0 ;
 }
 
 static
@@ -114,6 +117,7 @@ void clear_args (struct gengetopt_args_info *args_info)
   args_info->rotateTheta_orig = NULL;
   args_info->rotatePsi_arg = 0.0;
   args_info->rotatePsi_orig = NULL;
+  args_info->stream_flag = 0;
   
 }
 
@@ -135,6 +139,7 @@ void init_args_info(struct gengetopt_args_info *args_info)
   args_info->rotatePhi_help = gengetopt_args_info_help[10] ;
   args_info->rotateTheta_help = gengetopt_args_info_help[11] ;
   args_info->rotatePsi_help = gengetopt_args_info_help[12] ;
+  args_info->stream_help = gengetopt_args_info_help[13] ;
   
 }
 
@@ -295,6 +300,8 @@ cmdline_parser_dump(FILE *outfile, struct gengetopt_args_info *args_info)
     write_into_file(outfile, "rotateTheta", args_info->rotateTheta_orig, 0);
   if (args_info->rotatePsi_given)
     write_into_file(outfile, "rotatePsi", args_info->rotatePsi_orig, 0);
+  if (args_info->stream_given)
+    write_into_file(outfile, "stream", 0, 0 );
   
 
   i = EXIT_SUCCESS;
@@ -1069,6 +1076,9 @@ int update_arg(void *field, char **orig_field,
     val = possible_values[found];
 
   switch(arg_type) {
+  case ARG_FLAG:
+    *((int *)field) = !*((int *)field);
+    break;
   case ARG_INT:
     if (val) *((int *)field) = strtol (val, &stop_char, 0);
     break;
@@ -1103,6 +1113,7 @@ int update_arg(void *field, char **orig_field,
   /* store the original value */
   switch(arg_type) {
   case ARG_NO:
+  case ARG_FLAG:
     break;
   default:
     if (value && orig_field) {
@@ -1175,6 +1186,7 @@ cmdline_parser_internal (
         { "rotatePhi",	1, NULL, 'p' },
         { "rotateTheta",	1, NULL, 'q' },
         { "rotatePsi",	1, NULL, 'r' },
+        { "stream",	0, NULL, 's' },
         { 0,  0, 0, 0 }
       };
 
@@ -1183,7 +1195,7 @@ cmdline_parser_internal (
       custom_opterr = opterr;
       custom_optopt = optopt;
 
-      c = custom_getopt_long (argc, argv, "hVi:o:x:y:z:t:u:v:p:q:r:", long_options, &option_index);
+      c = custom_getopt_long (argc, argv, "hVi:o:x:y:z:t:u:v:p:q:r:s", long_options, &option_index);
 
       optarg = custom_optarg;
       optind = custom_optind;
@@ -1336,6 +1348,16 @@ cmdline_parser_internal (
             goto failure;
         
           break;
+        case 's':	/* write the replicated frames directly, in parallel, without building the replicated system.  */
+        
+        
+          if (update_arg((void *)&(args_info->stream_flag), 0, &(args_info->stream_given),
+              &(local_args_info.stream_given), optarg, 0, 0, ARG_FLAG,
+              check_ambiguity, override, 1, 0, "stream", 's',
+              additional_error))
+            goto failure;
+        
+          break;
 
         case 0:	/* Long option with no short option */
         case '?':	/* Invalid option.  */
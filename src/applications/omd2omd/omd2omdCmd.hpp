@@ -72,6 +72,8 @@ struct gengetopt_args_info
   double rotatePsi_arg;	/**< @brief rotate all coordinates Euler angle Psi (default='0.0').  */
   char * rotatePsi_orig;	/**< @brief rotate all coordinates Euler angle Psi original value given at command line.  */
   const char *rotatePsi_help; /**< @brief rotate all coordinates Euler angle Psi help description.  */
+  int stream_flag;	/**< @brief write the replicated frames directly, in parallel, without building the replicated system (default=off).  */
+  const char *stream_help; /**< @brief write the replicated frames directly, in parallel, without building the replicated system help description.  */
   
   unsigned int help_given ;	/**< @brief Whether help was given.  */
   unsigned int version_given ;	/**< @brief Whether version was given.  */
@@ -86,6 +88,7 @@ struct gengetopt_args_info
   unsigned int rotatePhi_given ;	/**< @brief Whether rotatePhi was given.  */
   unsigned int rotateTheta_given ;	/**< @brief Whether rotateTheta was given.  */
   unsigned int rotatePsi_given ;	/**< @brief Whether rotatePsi was given.  */
+  unsigned int stream_given ;	/**< @brief Whether stream was given.  */
 
   char **inputs ; /**< @brief unamed options (options without names) */
   unsigned inputs_num ; /**< @brief unamed options number */
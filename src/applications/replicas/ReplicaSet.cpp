@@ -0,0 +1,442 @@
+/*
+ * Copyright (c) 2018 The University of Notre Dame. All Rights Reserved.
+ *
+ * The University of Notre Dame grants you ("Licensee") a
+ * non-exclusive, royalty free, license to use, modify and
+ * redistribute this software in source and binary code form, provided
+ * that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the
+ *    distribution.
+ *
+ * This software is provided "AS IS," without a warranty of any
+ * kind. All express or implied conditions, representations and
+ * warranties, including any implied warranty of merchantability,
+ * fitness for a particular purpose or non-infringement, are hereby
+ * excluded.  The University of Notre Dame and its licensors shall not
+ * be liable for any damages suffered by licensee as a result of
+ * using, modifying or distributing the software or its
+ * derivatives. In no event will the University of Notre Dame or its
+ * licensors be liable for any lost revenue, profit or data, or for
+ * direct, indirect, special, consequential, incidental or punitive
+ * damages, however caused and regardless of the theory of liability,
+ * arising out of the use of or inability to use software, even if the
+ * University of Notre Dame has been advised of the possibility of
+ * such damages.
+ *
+ * SUPPORT OPEN SCIENCE!  If you use OpenMD or its source code in your
+ * research, please cite the appropriate papers when you publish your
+ * work.  Good starting points are:
+ *                                                                      
+ * [1]  Meineke, et al., J. Comp. Chem. 26, 252-271 (2005).             
+ * [2]  Fennell & Gezelter, J. Chem. Phys. 124, 234104 (2006).          
+ * [3]  Sun, Lin & Gezelter, J. Chem. Phys. 128, 234107 (2008).          
+ * [4]  Kuang & Gezelter,  J. Chem. Phys. 133, 164101 (2010).
+ * [5]  Vardeman, Stocker & Gezelter, J. Chem. Theory Comput. 7, 834 (2011).
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <iostream>
+#include <thread>
+
+#include "applications/replicas/ReplicaSet.hpp"
+#include "brains/SimCreator.hpp"
+#include "brains/SnapshotManager.hpp"
+#include "brains/Velocitizer.hpp"
+#include "constraints/ZconstraintForceManager.hpp"
+#include "integrators/IntegratorFactory.hpp"
+#include "primitives/Molecule.hpp"
+#include "primitives/RigidBody.hpp"
+#include "restraints/RestraintForceManager.hpp"
+#include "restraints/ThermoIntegrationForceManager.hpp"
+#include "utils/Constants.hpp"
+#include "utils/PerformanceCounters.hpp"
+#include "utils/StringUtils.hpp"
+#include "utils/TimerRegistry.hpp"
+#include "utils/simError.h"
+
+namespace OpenMD {
+
+  ReplicaSet::ReplicaSet(const std::string& mdFileName, int nReplicas) :
+    exchangeTime_(0.0), pressure_(0.0), nSweeps_(0), randNumGen_(NULL) {
+
+    SimCreator creator;
+    for (int i = 0; i < nReplicas; i++) {
+      SimInfo* info = creator.createSim(mdFileName);
+      // the first replica owns the force field; the rest share it:
+      if (i == 0) creator.setSharedForceField(info->getForceField());
+
+      char suffix[16];
+      sprintf(suffix, "_r%d", i);
+      std::string prefix = getPrefix(info->getFinalConfigFileName()) + suffix;
+      info->setFinalConfigFileName(prefix + ".eor");
+      info->setDumpFileName(prefix + ".dump");
+      info->setStatFileName(prefix + ".stat");
+      info->setReportFileName(prefix + ".report");
+      info->setRestFileName(prefix + ".zang");
+      info->setCheckpointFileName(prefix + ".chk");
+
+      replicas_.push_back(info);
+    }
+  }
+
+  ReplicaSet::~ReplicaSet() {
+    for (unsigned int i = 0; i < integrators_.size(); i++)
+      delete integrators_[i];
+    // the shared force field goes with the first replica, so it is
+    // deleted last:
+    for (int i = replicas_.size() - 1; i >= 0; i--)
+      delete replicas_[i];
+    delete randNumGen_;
+  }
+
+  void ReplicaSet::setSeeds(unsigned long int seed) {
+    for (unsigned int i = 0; i < replicas_.size(); i++)
+      replicas_[i]->getSimParams()->setSeed(seed + i);
+    delete randNumGen_;
+    randNumGen_ = new SeqRandNumGen(seed);
+  }
+
+  void ReplicaSet::setTemperatureLadder(RealType tMin, RealType tMax) {
+    if (tMin <= 0.0 || tMax <= 0.0) {
+      sprintf(painCave.errMsg,
+              "ReplicaSet: the replica temperatures must be positive.\n");
+      painCave.isFatal = 1;
+      simError();
+    }
+    int n = replicas_.size();
+    temperatures_.resize(n);
+    for (int i = 0; i < n; i++) {
+      RealType x = (n > 1) ? RealType(i) / RealType(n - 1) : 0.0;
+      temperatures_[i] = tMin * pow(tMax / tMin, x);
+      replicas_[i]->getSimParams()->setTargetTemp(temperatures_[i]);
+    }
+  }
+
+  void ReplicaSet::setLambdaLadder(RealType lambdaMin, RealType lambdaMax) {
+    int n = replicas_.size();
+    for (int i = 0; i < n; i++) {
+      RealType x = (n > 1) ? RealType(i) / RealType(n - 1) : 0.0;
+      replicas_[i]->getSimParams()->
+        setThermodynamicIntegrationLambda(lambdaMin + x * (lambdaMax - 
+                                                           lambdaMin));
+    }
+  }
+
+  void ReplicaSet::setExchangeTime(RealType exchangeTime) {
+    exchangeTime_ = exchangeTime;
+  }
+
+  Integrator* ReplicaSet::createIntegrator(SimInfo* info) {
+    Globals* simParams = info->getSimParams();
+
+    if (!simParams->haveEnsemble()) {
+      sprintf(painCave.errMsg,
+              "ReplicaSet: the replicas need an ensemble to integrate.\n");
+      painCave.isFatal = 1;
+      simError();
+    }
+
+    Integrator* integrator = IntegratorFactory::getInstance()->
+      createIntegrator(toUpperCopy(simParams->getEnsemble()), info);
+
+    if (integrator == NULL) {
+      sprintf(painCave.errMsg,
+              "Integrator Factory can not create %s Integrator\n",
+              simParams->getEnsemble().c_str());
+      painCave.isFatal = 1;
+      simError();
+    }
+
+    // the same force manager choices that openmd makes:
+    if (simParams->getUseThermodynamicIntegration()) {
+      integrator->setForceManager(new ThermoIntegrationForceManager(info));
+    }
+    if (simParams->getUseRestraints() &&
+        !simParams->getUseThermodynamicIntegration()) {
+      integrator->setForceManager(new RestraintForceManager(info));
+    }
+    if (simParams->getNZconsStamps() > 0) {
+      info->setNZconstraint(simParams->getNZconsStamps());
+      integrator->setForceManager(new ZconstraintForceManager(info));
+    }
+    return integrator;
+  }
+
+  void ReplicaSet::integrateAll(int nThreads, RealType time) {
+    std::vector<std::thread> workers;
+    for (int t = 0; t < nThreads; t++) {
+      workers.push_back(std::thread([=]() {
+            for (int i = t; i < int(integrators_.size()); i += nThreads)
+              integrators_[i]->integrateUntil(time);
+          }));
+    }
+    for (int t = 0; t < nThreads; t++) workers[t].join();
+  }
+
+  void ReplicaSet::run(int nThreads) {
+    int n = replicas_.size();
+    nThreads = std::max(1, std::min(nThreads, n));
+
+    if (exchangeTime_ > 0.0 && temperatures_.empty()) {
+      sprintf(painCave.errMsg,
+              "ReplicaSet: exchanges need a temperature ladder, so the\n"
+              "\treplicas will run independently.\n");
+      painCave.isFatal = 0;
+      painCave.severity = OPENMD_WARNING;
+      simError();
+      exchangeTime_ = 0.0;
+    }
+    if (exchangeTime_ > 0.0) setExchangePressure();
+    if (randNumGen_ == NULL) randNumGen_ = new SeqRandNumGen();
+
+    // Everything up to the first step is done one replica at a time:
+    // the integrators and force managers read the shared force field
+    // and register their timers and counters here.
+    for (int i = 0; i < n; i++) {
+      if (!temperatures_.empty()) {
+        // the degrees of freedom are needed to draw the velocities:
+        replicas_[i]->update();
+        Velocitizer velocitizer(replicas_[i]);
+        velocitizer.randomize(temperatures_[i]);
+      }
+      integrators_.push_back(createIntegrator(replicas_[i]));
+      integrators_[i]->initializeIntegration();
+    }
+
+    // The timers and counters are shared by every thread, so they are
+    // only kept when the replicas are run one after another:
+    if (nThreads > 1) {
+      TimerRegistry::getInstance()->setEnabled(false);
+      PerformanceCounters::getInstance()->setEnabled(false);
+    }
+
+    RealType startTime = replicas_[0]->getSnapshotManager()->
+      getCurrentSnapshot()->getTime();
+    RealType runTime = integrators_[0]->getRunTime();
+    RealType dt = integrators_[0]->getDt();
+
+    nAttempts_.assign(n, 0);
+    nAccepted_.assign(n, 0);
+    if (exchangeTime_ > 0.0) {
+      for (int k = 1; startTime + k * exchangeTime_ <= runTime; k++) {
+        integrateAll(nThreads, startTime + k * exchangeTime_);
+        attemptExchanges();
+      }
+    }
+    integrateAll(nThreads, runTime + dt);
+
+    for (int i = 0; i < n; i++) integrators_[i]->finalizeIntegration();
+
+    if (exchangeTime_ > 0.0) {
+      std::cout << "Replica exchange acceptance:\n";
+      for (int i = 0; i + 1 < n; i++) {
+        char line[128];
+        sprintf(line, "  %10.3f K <-> %10.3f K : %5d / %5d  (%.3f)\n",
+                temperatures_[i], temperatures_[i + 1], nAccepted_[i],
+                nAttempts_[i], nAttempts_[i] > 0 ? 
+                RealType(nAccepted_[i]) / nAttempts_[i] : 0.0);
+        std::cout << line;
+      }
+    }
+  }
+
+  /**
+   * The acceptance test depends on the ensemble: constant pressure
+   * replicas sample exp[-beta (U + PV)], so the swap also carries a
+   * P (V_i - V_j) term.  Ensembles with other work terms (surface
+   * tension, hull pressure) are not supported.
+   */
+  void ReplicaSet::setExchangePressure() {
+    Globals* simParams = replicas_[0]->getSimParams();
+    std::string ensemble = toUpperCopy(simParams->getEnsemble());
+
+    if (ensemble == "NVE" || ensemble == "NVT" || ensemble == "RESPA" ||
+        ensemble == "LD" || ensemble == "LANGEVINDYNAMICS") {
+      pressure_ = 0.0;
+    } else if (ensemble == "NPTI" || ensemble == "NPTF" || 
+               ensemble == "NPTXYZ" || ensemble == "NPAT") {
+      if (!simParams->haveTargetPressure()) {
+        sprintf(painCave.errMsg,
+                "ReplicaSet: the %s ensemble needs a targetPressure for\n"
+                "\treplica exchange.\n", simParams->getEnsemble().c_str());
+        painCave.isFatal = 1;
+        simError();
+      }
+      // atm -> kcal/mol/A^3, as in the NPT conserved quantity:
+      pressure_ = simParams->getTargetPressure() / 
+        (Constants::pressureConvert * Constants::energyConvert);
+    } else {
+      sprintf(painCave.errMsg,
+              "ReplicaSet: replica exchange is not available for the %s\n"
+              "\tensemble.  Use NVE, NVT, LD, RESPA, NPTi, NPTf, NPTxyz\n"
+              "\tor NPAT.\n", simParams->getEnsemble().c_str());
+      painCave.isFatal = 1;
+      simError();
+    }
+  }
+
+  void ReplicaSet::attemptExchanges() {
+    int n = replicas_.size();
+    // alternate between the even and odd neighbor pairs:
+    int first = nSweeps_ % 2;
+    nSweeps_++;
+
+    for (int i = first; i + 1 < n; i += 2) {
+      int j = i + 1;
+      Snapshot* snapI = replicas_[i]->getSnapshotManager()->
+        getCurrentSnapshot();
+      Snapshot* snapJ = replicas_[j]->getSnapshotManager()->
+        getCurrentSnapshot();
+      RealType Hi = snapI->getPotentialEnergy();
+      RealType Hj = snapJ->getPotentialEnergy();
+      if (pressure_ != 0.0) {
+        Hi += pressure_ * snapI->getVolume();
+        Hj += pressure_ * snapJ->getVolume();
+      }
+      RealType betaI = 1.0 / (Constants::kb * temperatures_[i]);
+      RealType betaJ = 1.0 / (Constants::kb * temperatures_[j]);
+      RealType delta = (betaI - betaJ) * (Hi - Hj);
+
+      nAttempts_[i]++;
+      if (delta >= 0.0 || randNumGen_->rand() < exp(delta)) {
+        swapConfigurations(replicas_[i], replicas_[j],
+                           sqrt(temperatures_[i] / temperatures_[j]),
+                           sqrt(temperatures_[j] / temperatures_[i]));
+        nAccepted_[i]++;
+      }
+    }
+  }
+
+  void ReplicaSet::swapConfigurations(SimInfo* a, SimInfo* b, 
+                                      RealType scaleA, RealType scaleB) {
+    Snapshot* snapA = a->getSnapshotManager()->getCurrentSnapshot();
+    Snapshot* snapB = b->getSnapshotManager()->getCurrentSnapshot();
+
+    Mat3x3d hmat = snapA->getHmat();
+    snapA->setHmat(snapB->getHmat());
+    snapB->setHmat(hmat);
+
+    // The extended system variables travel with the configuration.
+    // The thermostat and barostat rates are velocities, so they are
+    // rescaled to the new temperature like the particle velocities:
+    pair<RealType, RealType> thermostat = snapA->getThermostat();
+    pair<RealType, RealType> thermostatB = snapB->getThermostat();
+    snapA->setThermostat(make_pair(scaleA * thermostatB.first,
+                                   thermostatB.second));
+    snapB->setThermostat(make_pair(scaleB * thermostat.first,
+                                   thermostat.second));
+
+    Mat3x3d barostatA = snapB->getBarostat();
+    Mat3x3d barostatB = snapA->getBarostat();
+    barostatA *= scaleA;
+    barostatB *= scaleB;
+    snapA->setBarostat(barostatA);
+    snapB->setBarostat(barostatB);
+
+    // The fluctuating charges are held at the same electronic
+    // temperature in every replica, so their state is swapped as is:
+    thermostat = snapA->getElectronicThermostat();
+    snapA->setElectronicThermostat(snapB->getElectronicThermostat());
+    snapB->setElectronicThermostat(thermostat);
+
+    SimInfo::MoleculeIterator miA, miB;
+    Molecule::IntegrableObjectIterator iiA, iiB;
+    Molecule::FluctuatingChargeIterator fqA, fqB;
+    Molecule::RigidBodyIterator rbIterA, rbIterB;
+    Molecule* molA;
+    Molecule* molB;
+    StuntDouble* sdA;
+    StuntDouble* sdB;
+    Atom* atomA;
+    Atom* atomB;
+    RigidBody* rb;
+
+    // both systems were built from the same file, so the molecules
+    // and their integrable objects come in the same order:
+    for (molA = a->beginMolecule(miA), molB = b->beginMolecule(miB); 
+         molA != NULL && molB != NULL;
+         molA = a->nextMolecule(miA), molB = b->nextMolecule(miB)) {
+
+      for (sdA = molA->beginIntegrableObject(iiA),
+             sdB = molB->beginIntegrableObject(iiB);
+           sdA != NULL && sdB != NULL;
+           sdA = molA->nextIntegrableObject(iiA),
+             sdB = molB->nextIntegrableObject(iiB)) {
+
+        Vector3d pos = sdA->getPos();
+        sdA->setPos(sdB->getPos());
+        sdB->setPos(pos);
+
+        Vector3d vel = sdA->getVel();
+        sdA->setVel(scaleA * sdB->getVel());
+        sdB->setVel(scaleB * vel);
+
+        Vector3d frc = sdA->getFrc();
+        sdA->setFrc(sdB->getFrc());
+        sdB->setFrc(frc);
+
+        if (sdA->isDirectional()) {
+          RotMat3x3d A = sdA->getA();
+          sdA->setA(sdB->getA());
+          sdB->setA(A);
+
+          Vector3d j = sdA->getJ();
+          sdA->setJ(scaleA * sdB->getJ());
+          sdB->setJ(scaleB * j);
+
+          Vector3d trq = sdA->getTrq();
+          sdA->setTrq(sdB->getTrq());
+          sdB->setTrq(trq);
+        }
+      }
+
+      for (atomA = molA->beginFluctuatingCharge(fqA),
+             atomB = molB->beginFluctuatingCharge(fqB);
+           atomA != NULL && atomB != NULL;
+           atomA = molA->nextFluctuatingCharge(fqA),
+             atomB = molB->nextFluctuatingCharge(fqB)) {
+
+        RealType q = atomA->getFlucQPos();
+        atomA->setFlucQPos(atomB->getFlucQPos());
+        atomB->setFlucQPos(q);
+
+        RealType qVel = atomA->getFlucQVel();
+        atomA->setFlucQVel(atomB->getFlucQVel());
+        atomB->setFlucQVel(qVel);
+
+        RealType qFrc = atomA->getFlucQFrc();
+        atomA->setFlucQFrc(atomB->getFlucQFrc());
+        atomB->setFlucQFrc(qFrc);
+      }
+
+      for (rb = molA->beginRigidBody(rbIterA); rb != NULL; 
+           rb = molA->nextRigidBody(rbIterA)) {
+        rb->updateAtoms();
+        rb->updateAtomVel();
+      }
+      for (rb = molB->beginRigidBody(rbIterB); rb != NULL; 
+           rb = molB->nextRigidBody(rbIterB)) {
+        rb->updateAtoms();
+        rb->updateAtomVel();
+      }
+    }
+
+    // the constraint algorithm starts each step from the previous
+    // snapshot, which has to hold the new configuration as well:
+    SimInfo* systems[2] = {a, b};
+    for (int s = 0; s < 2; s++) {
+      SnapshotManager* sman = systems[s]->getSnapshotManager();
+      int prevID = sman->getPrevSnapshot()->getID();
+      *sman->getPrevSnapshot() = *sman->getCurrentSnapshot();
+      sman->getPrevSnapshot()->setID(prevID);
+    }
+  }
+}
@@ -0,0 +1,114 @@
+/*
+ * Copyright (c) 2018 The University of Notre Dame. All Rights Reserved.
+ *
+ * The University of Notre Dame grants you ("Licensee") a
+ * non-exclusive, royalty free, license to use, modify and
+ * redistribute this software in source and binary code form, provided
+ * that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the
+ *    distribution.
+ *
+ * This software is provided "AS IS," without a warranty of any
+ * kind. All express or implied conditions, representations and
+ * warranties, including any implied warranty of merchantability,
+ * fitness for a particular purpose or non-infringement, are hereby
+ * excluded.  The University of Notre Dame and its licensors shall not
+ * be liable for any damages suffered by licensee as a result of
+ * using, modifying or distributing the software or its
+ * derivatives. In no event will the University of Notre Dame or its
+ * licensors be liable for any lost revenue, profit or data, or for
+ * direct, indirect, special, consequential, incidental or punitive
+ * damages, however caused and regardless of the theory of liability,
+ * arising out of the use of or inability to use software, even if the
+ * University of Notre Dame has been advised of the possibility of
+ * such damages.
+ *
+ * SUPPORT OPEN SCIENCE!  If you use OpenMD or its source code in your
+ * research, please cite the appropriate papers when you publish your
+ * work.  Good starting points are:
+ *                                                                      
+ * [1]  Meineke, et al., J. Comp. Chem. 26, 252-271 (2005).             
+ * [2]  Fennell & Gezelter, J. Chem. Phys. 124, 234104 (2006).          
+ * [3]  Sun, Lin & Gezelter, J. Chem. Phys. 128, 234107 (2008).          
+ * [4]  Kuang & Gezelter,  J. Chem. Phys. 133, 164101 (2010).
+ * [5]  Vardeman, Stocker & Gezelter, J. Chem. Theory Comput. 7, 834 (2011).
+ */
+
+#ifndef APPLICATIONS_REPLICAS_REPLICASET_HPP
+#define APPLICATIONS_REPLICAS_REPLICASET_HPP
+
+#include <string>
+#include <vector>
+
+#include "brains/SimInfo.hpp"
+#include "integrators/Integrator.hpp"
+#include "math/SeqRandNumGen.hpp"
+
+namespace OpenMD {
+
+  /**
+   * @class ReplicaSet
+   * @brief Several copies of one system advanced together in a single
+   * process.
+   *
+   * Every replica has its own SimInfo, snapshots, integrator and force
+   * manager, but the force field is parsed once and shared.  The
+   * replicas are stepped concurrently on worker threads, each thread
+   * taking replicas t, t + nThreads, ...  Replicas can be given
+   * different seeds, target temperatures and thermodynamic integration
+   * lambdas; all of them must be set before run() is called.
+   *
+   * With a temperature ladder and an exchange time, neighboring
+   * replicas attempt to swap configurations (positions, orientations,
+   * forces, fluctuating charges, the box and the thermostat and
+   * barostat variables) every exchange time.  The swap is accepted
+   * with probability min(1, exp[(1/kT_i - 1/kT_j)(U_i - U_j)]), with a
+   * P (V_i - V_j) term added to the energy difference in the constant
+   * pressure ensembles.  The velocities and thermostat and barostat
+   * rates are rescaled by sqrt(T_new / T_old).
+   */
+  class ReplicaSet {
+  public:
+    ReplicaSet(const std::string& mdFileName, int nReplicas);
+    ~ReplicaSet();
+
+    int getNReplicas() { return replicas_.size(); }
+    SimInfo* getSimInfo(int i) { return replicas_[i]; }
+
+    /** Replica k uses seed + k */
+    void setSeeds(unsigned long int seed);
+    /** Geometric ladder of target temperatures from tMin to tMax */
+    void setTemperatureLadder(RealType tMin, RealType tMax);
+    /** Evenly spaced thermodynamic integration lambdas */
+    void setLambdaLadder(RealType lambdaMin, RealType lambdaMax);
+    /** Time (fs) between exchange attempts; 0 turns exchanges off */
+    void setExchangeTime(RealType exchangeTime);
+
+    void run(int nThreads);
+
+  private:
+    Integrator* createIntegrator(SimInfo* info);
+    void integrateAll(int nThreads, RealType time);
+    void setExchangePressure();
+    void attemptExchanges();
+    void swapConfigurations(SimInfo* a, SimInfo* b, RealType scaleA,
+                            RealType scaleB);
+
+    std::vector<SimInfo*> replicas_;
+    std::vector<Integrator*> integrators_;
+    std::vector<RealType> temperatures_;
+    RealType exchangeTime_;
+    RealType pressure_;  /**< target pressure (kcal/mol/A^3), 0 unless NPT */
+    int nSweeps_;
+    std::vector<int> nAttempts_;
+    std::vector<int> nAccepted_;
+    SeqRandNumGen* randNumGen_;
+  };
+}
+#endif
@@ -0,0 +1,120 @@
+/*
+ * Copyright (c) 2018 The University of Notre Dame. All Rights Reserved.
+ *
+ * The University of Notre Dame grants you ("Licensee") a
+ * non-exclusive, royalty free, license to use, modify and
+ * redistribute this software in source and binary code form, provided
+ * that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the
+ *    distribution.
+ *
+ * This software is provided "AS IS," without a warranty of any
+ * kind. All express or implied conditions, representations and
+ * warranties, including any implied warranty of merchantability,
+ * fitness for a particular purpose or non-infringement, are hereby
+ * excluded.  The University of Notre Dame and its licensors shall not
+ * be liable for any damages suffered by licensee as a result of
+ * using, modifying or distributing the software or its
+ * derivatives. In no event will the University of Notre Dame or its
+ * licensors be liable for any lost revenue, profit or data, or for
+ * direct, indirect, special, consequential, incidental or punitive
+ * damages, however caused and regardless of the theory of liability,
+ * arising out of the use of or inability to use software, even if the
+ * University of Notre Dame has been advised of the possibility of
+ * such damages.
+ *
+ * SUPPORT OPEN SCIENCE!  If you use OpenMD or its source code in your
+ * research, please cite the appropriate papers when you publish your
+ * work.  Good starting points are:
+ *                                                                      
+ * [1]  Meineke, et al., J. Comp. Chem. 26, 252-271 (2005).             
+ * [2]  Fennell & Gezelter, J. Chem. Phys. 124, 234104 (2006).          
+ * [3]  Sun, Lin & Gezelter, J. Chem. Phys. 128, 234107 (2008).          
+ * [4]  Kuang & Gezelter,  J. Chem. Phys. 133, 164101 (2010).
+ * [5]  Vardeman, Stocker & Gezelter, J. Chem. Theory Comput. 7, 834 (2011).
+ */
+
+#include <iostream>
+#include <string>
+#include <thread>
+
+#include "replicasCmd.hpp"
+#include "applications/replicas/ReplicaSet.hpp"
+#include "brains/Register.hpp"
+#include "utils/simError.h"
+
+using namespace OpenMD;
+
+int main(int argc, char* argv[]) {
+
+  initSimError();
+
+  gengetopt_args_info args_info;
+  if (cmdline_parser(argc, argv, &args_info) != 0) {
+    cmdline_parser_print_help();
+    exit(1);
+  }
+
+  int nReplicas = args_info.replicas_arg;
+  if (nReplicas < 1) {
+    sprintf(painCave.errMsg, "The number of replicas must be at least 1.\n");
+    painCave.severity = OPENMD_ERROR;
+    painCave.isFatal = 1;
+    simError();
+  }
+
+  if (args_info.minTemperature_given != args_info.maxTemperature_given) {
+    sprintf(painCave.errMsg, 
+            "A temperature ladder needs both --minTemperature and\n"
+            "\t--maxTemperature.\n");
+    painCave.severity = OPENMD_ERROR;
+    painCave.isFatal = 1;
+    simError();
+  }
+
+  if (args_info.minLambda_given != args_info.maxLambda_given) {
+    sprintf(painCave.errMsg, 
+            "A lambda ladder needs both --minLambda and --maxLambda.\n");
+    painCave.severity = OPENMD_ERROR;
+    painCave.isFatal = 1;
+    simError();
+  }
+
+  registerAll();
+
+  ReplicaSet replicas(args_info.input_arg, nReplicas);
+
+  if (args_info.seed_given) {
+    replicas.setSeeds(args_info.seed_arg);
+  } else {
+    Globals* simParams = replicas.getSimInfo(0)->getSimParams();
+    if (simParams->haveSeed()) replicas.setSeeds(simParams->getSeed());
+  }
+
+  if (args_info.minTemperature_given) 
+    replicas.setTemperatureLadder(args_info.minTemperature_arg, 
+                                  args_info.maxTemperature_arg);
+
+  if (args_info.minLambda_given)
+    replicas.setLambdaLadder(args_info.minLambda_arg, args_info.maxLambda_arg);
+
+  if (args_info.exchangeTime_given) 
+    replicas.setExchangeTime(args_info.exchangeTime_arg);
+
+  int nThreads;
+  if (args_info.threads_given) 
+    nThreads = args_info.threads_arg;
+  else
+    nThreads = std::thread::hardware_concurrency();
+
+  replicas.run(nThreads);
+
+  cmdline_parser_free(&args_info);
+  return 0;
+}
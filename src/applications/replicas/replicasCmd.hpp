@@ -0,0 +1,211 @@
+/** @file replicasCmd.hpp
+ *  @brief The header file for the command line option parser
+ *  generated by GNU Gengetopt version 2.22.6
+ *  http://www.gnu.org/software/gengetopt.
+ *  DO NOT modify this file, since it can be overwritten
+ *  @author GNU Gengetopt by Lorenzo Bettini */
+
+#ifndef REPLICASCMD_H
+#define REPLICASCMD_H
+
+/* If we use autoconf.  */
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <stdio.h> /* for FILE */
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+#ifndef CMDLINE_PARSER_PACKAGE
+/** @brief the program name (used for printing errors) */
+#define CMDLINE_PARSER_PACKAGE "replicas"
+#endif
+
+#ifndef CMDLINE_PARSER_PACKAGE_NAME
+/** @brief the complete program name (used for help and version) */
+#define CMDLINE_PARSER_PACKAGE_NAME "replicas"
+#endif
+
+#ifndef CMDLINE_PARSER_VERSION
+/** @brief the program version */
+#define CMDLINE_PARSER_VERSION ""
+#endif
+
+/** @brief Where the command line options are stored */
+struct gengetopt_args_info
+{
+  const char *help_help; /**< @brief Print help and exit help description.  */
+  const char *version_help; /**< @brief Print version and exit help description.  */
+  char * input_arg;	/**< @brief OpenMD (.omd) file describing every replica.  */
+  char * input_orig;	/**< @brief OpenMD (.omd) file describing every replica original value given at command line.  */
+  const char *input_help; /**< @brief OpenMD (.omd) file describing every replica help description.  */
+  int replicas_arg;	/**< @brief number of replicas.  */
+  char * replicas_orig;	/**< @brief number of replicas original value given at command line.  */
+  const char *replicas_help; /**< @brief number of replicas help description.  */
+  int threads_arg;	/**< @brief number of worker threads (by default one per core, but no more than the number of replicas).  */
+  char * threads_orig;	/**< @brief number of worker threads (by default one per core, but no more than the number of replicas) original value given at command line.  */
+  const char *threads_help; /**< @brief number of worker threads (by default one per core, but no more than the number of replicas) help description.  */
+  int seed_arg;	/**< @brief random number seed of the first replica; replica k uses seed + k.  */
+  char * seed_orig;	/**< @brief random number seed of the first replica; replica k uses seed + k original value given at command line.  */
+  const char *seed_help; /**< @brief random number seed of the first replica; replica k uses seed + k help description.  */
+  double minTemperature_arg;	/**< @brief target temperature (K) of the first replica.  */
+  char * minTemperature_orig;	/**< @brief target temperature (K) of the first replica original value given at command line.  */
+  const char *minTemperature_help; /**< @brief target temperature (K) of the first replica help description.  */
+  double maxTemperature_arg;	/**< @brief target temperature (K) of the last replica; the temperatures in between are spaced geometrically.  */
+  char * maxTemperature_orig;	/**< @brief target temperature (K) of the last replica; the temperatures in between are spaced geometrically original value given at command line.  */
+  const char *maxTemperature_help; /**< @brief target temperature (K) of the last replica; the temperatures in between are spaced geometrically help description.  */
+  double minLambda_arg;	/**< @brief thermodynamic integration lambda of the first replica.  */
+  char * minLambda_orig;	/**< @brief thermodynamic integration lambda of the first replica original value given at command line.  */
+  const char *minLambda_help; /**< @brief thermodynamic integration lambda of the first replica help description.  */
+  double maxLambda_arg;	/**< @brief thermodynamic integration lambda of the last replica; the values in between are spaced evenly.  */
+  char * maxLambda_orig;	/**< @brief thermodynamic integration lambda of the last replica; the values in between are spaced evenly original value given at command line.  */
+  const char *maxLambda_help; /**< @brief thermodynamic integration lambda of the last replica; the values in between are spaced evenly help description.  */
+  double exchangeTime_arg;	/**< @brief time (fs) between attempted exchanges of neighboring temperatures.  */
+  char * exchangeTime_orig;	/**< @brief time (fs) between attempted exchanges of neighboring temperatures original value given at command line.  */
+  const char *exchangeTime_help; /**< @brief time (fs) between attempted exchanges of neighboring temperatures help description.  */
+  
+  unsigned int help_given ;	/**< @brief Whether help was given.  */
+  unsigned int version_given ;	/**< @brief Whether version was given.  */
+  unsigned int input_given ;	/**< @brief Whether input was given.  */
+  unsigned int replicas_given ;	/**< @brief Whether replicas was given.  */
+  unsigned int threads_given ;	/**< @brief Whether threads was given.  */
+  unsigned int seed_given ;	/**< @brief Whether seed was given.  */
+  unsigned int minTemperature_given ;	/**< @brief Whether minTemperature was given.  */
+  unsigned int maxTemperature_given ;	/**< @brief Whether maxTemperature was given.  */
+  unsigned int minLambda_given ;	/**< @brief Whether minLambda was given.  */
+  unsigned int maxLambda_given ;	/**< @brief Whether maxLambda was given.  */
+  unsigned int exchangeTime_given ;	/**< @brief Whether exchangeTime was given.  */
+
+  char **inputs ; /**< @brief unamed options (options without names) */
+  unsigned inputs_num ; /**< @brief unamed options number */
+} ;
+
+/** @brief The additional parameters to pass to parser functions */
+struct cmdline_parser_params
+{
+  int override; /**< @brief whether to override possibly already present options (default 0) */
+  int initialize; /**< @brief whether to initialize the option structure gengetopt_args_info (default 1) */
+  int check_required; /**< @brief whether to check that all required options were provided (default 1) */
+  int check_ambiguity; /**< @brief whether to check for options already specified in the option structure gengetopt_args_info (default 0) */
+  int print_errors; /**< @brief whether getopt_long should print an error message for a bad option (default 1) */
+} ;
+
+/** @brief the purpose string of the program */
+extern const char *gengetopt_args_info_purpose;
+/** @brief the usage string of the program */
+extern const char *gengetopt_args_info_usage;
+/** @brief the description string of the program */
+extern const char *gengetopt_args_info_description;
+/** @brief all the lines making the help output */
+extern const char *gengetopt_args_info_help[];
+
+/**
+ * The command line parser
+ * @param argc the number of command line options
+ * @param argv the command line options
+ * @param args_info the structure where option information will be stored
+ * @return 0 if everything went fine, NON 0 if an error took place
+ */
+int cmdline_parser (int argc, char **argv,
+  struct gengetopt_args_info *args_info);
+
+/**
+ * The command line parser (version with additional parameters - deprecated)
+ * @param argc the number of command line options
+ * @param argv the command line options
+ * @param args_info the structure where option information will be stored
+ * @param override whether to override possibly already present options
+ * @param initialize whether to initialize the option structure my_args_info
+ * @param check_required whether to check that all required options were provided
+ * @return 0 if everything went fine, NON 0 if an error took place
+ * @deprecated use cmdline_parser_ext() instead
+ */
+int cmdline_parser2 (int argc, char **argv,
+  struct gengetopt_args_info *args_info,
+  int override, int initialize, int check_required);
+
+/**
+ * The command line parser (version with additional parameters)
+ * @param argc the number of command line options
+ * @param argv the command line options
+ * @param args_info the structure where option information will be stored
+ * @param params additional parameters for the parser
+ * @return 0 if everything went fine, NON 0 if an error took place
+ */
+int cmdline_parser_ext (int argc, char **argv,
+  struct gengetopt_args_info *args_info,
+  struct cmdline_parser_params *params);
+
+/**
+ * Save the contents of the option struct into an already open FILE stream.
+ * @param outfile the stream where to dump options
+ * @param args_info the option struct to dump
+ * @return 0 if everything went fine, NON 0 if an error took place
+ */
+int cmdline_parser_dump(FILE *outfile,
+  struct gengetopt_args_info *args_info);
+
+/**
+ * Save the contents of the option struct into a (text) file.
+ * This file can be read by the config file parser (if generated by gengetopt)
+ * @param filename the file where to save
+ * @param args_info the option struct to save
+ * @return 0 if everything went fine, NON 0 if an error took place
+ */
+int cmdline_parser_file_save(const char *filename,
+  struct gengetopt_args_info *args_info);
+
+/**
+ * Print the help
+ */
+void cmdline_parser_print_help(void);
+/**
+ * Print the version
+ */
+void cmdline_parser_print_version(void);
+
+/**
+ * Initializes all the fields a cmdline_parser_params structure 
+ * to their default values
+ * @param params the structure to initialize
+ */
+void cmdline_parser_params_init(struct cmdline_parser_params *params);
+
+/**
+ * Allocates dynamically a cmdline_parser_params structure and initializes
+ * all its fields to their default values
+ * @return the created and initialized cmdline_parser_params structure
+ */
+struct cmdline_parser_params *cmdline_parser_params_create(void);
+
+/**
+ * Initializes the passed gengetopt_args_info structure's fields
+ * (also set default values for options that have a default)
+ * @param args_info the structure to initialize
+ */
+void cmdline_parser_init (struct gengetopt_args_info *args_info);
+/**
+ * Deallocates the string fields of the gengetopt_args_info structure
+ * (but does not deallocate the structure itself)
+ * @param args_info the structure to deallocate
+ */
+void cmdline_parser_free (struct gengetopt_args_info *args_info);
+
+/**
+ * Checks that all the required options were specified
+ * @param args_info the structure to check
+ * @param prog_name the name of the program that will be used to print
+ *   possible errors
+ * @return
+ */
+int cmdline_parser_required (struct gengetopt_args_info *args_info,
+  const char *prog_name);
+
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+#endif /* REPLICASCMD_H */
@@ -41,6 +41,7 @@
  */
 
 #include <algorithm>
+#include <cmath>
 #include <fstream>
 #include <sstream>
 #include "applications/sequentialProps/GCNSeq.hpp"
@@ -62,11 +63,15 @@ namespace OpenMD {
     RealType binMax_ = nnMax_ * 1.5;
     delta_ = binMax_ / bins_;
     usePBC_ = info->getSimParams()->getUsePeriodicBoundaryConditions();
+    skin_ = 0.1 * rCut_;
+    nRebuilds_ = 0;
+    nFrames_ = 0;
 
     std::stringstream params;
     params << " rcut = " << rCut_
            << ", nbins = " << bins_
-           << ", max neighbors = " << nnMax_;
+           << ", max neighbors = " << nnMax_
+           << ", skin = " << skin_;
     const std::string paramString = params.str();
     setParameterString( paramString );
   }
@@ -75,26 +80,152 @@ namespace OpenMD {
     histogram_.clear();
   }
 
+  bool GCNSeq::needsRebuild(const std::vector<StuntDouble*>& sds) {
+    if (sds.size() != refIndices_.size()) return true;
+    if (usePBC_ && currentSnapshot_->getHmat() != refHmat_) return true;
+
+    RealType maxDisp2 = 0.25 * skin_ * skin_;
+    for (unsigned int i = 0; i < sds.size(); i++) {
+      if (sds[i]->getGlobalIndex() != refIndices_[i]) return true;
+      Vector3d disp = sds[i]->getPos() - refPos_[i];
+      if (usePBC_) currentSnapshot_->wrapVector(disp);
+      if (disp.lengthSquare() > maxDisp2) return true;
+    }
+    return false;
+  }
+
+  void GCNSeq::buildCandidates(const std::vector<StuntDouble*>& sds) {
+    unsigned int n = sds.size();
+    RealType rList = rCut_ + skin_;
+    RealType rList2 = rList * rList;
+    
+    refIndices_.resize(n);
+    refPos_.resize(n);
+    for (unsigned int i = 0; i < n; i++) {
+      refIndices_[i] = sds[i]->getGlobalIndex();
+      refPos_[i] = sds[i]->getPos();
+    }
+    refHmat_ = currentSnapshot_->getHmat();
+    
+    for (unsigned int i = 0; i < candidates_.size(); i++) 
+      candidates_[i].clear();
+    candidates_.resize(n);
+    if (n == 0) return;
+
+    // Map every object into the unit cube: scaled box coordinates with
+    // periodic boundaries, or the bounding box of the selection without.
+    Mat3x3d hmat, invHmat;
+    Vector3d lo(0.0);
+    Vector3d widths;
+
+    if (usePBC_) {
+      hmat = refHmat_;
+      invHmat = hmat.inverse();
+      RealType volume = std::fabs(hmat.determinant());
+      Vector3d a = hmat.getColumn(0);
+      Vector3d b = hmat.getColumn(1);
+      Vector3d c = hmat.getColumn(2);
+      widths = Vector3d(volume / cross(b, c).length(),
+                        volume / cross(c, a).length(),
+                        volume / cross(a, b).length());
+    } else {
+      Vector3d hi = refPos_[0];
+      lo = refPos_[0];
+      for (unsigned int i = 1; i < n; i++) {
+        for (int k = 0; k < 3; k++) {
+          lo[k] = std::min(lo[k], refPos_[i][k]);
+          hi[k] = std::max(hi[k], refPos_[i][k]);
+        }
+      }
+      hmat = Mat3x3d(0.0);
+      for (int k = 0; k < 3; k++) {
+        widths[k] = hi[k] - lo[k] + rList;
+        hmat(k, k) = widths[k];
+      }
+      invHmat = hmat.inverse();
+    }
+
+    Vector3i nCells;
+    for (int k = 0; k < 3; k++) 
+      nCells[k] = std::max(1, int(widths[k] / rList));
+    
+    std::vector<std::vector<int> > cellList(nCells.x() * nCells.y() * 
+                                            nCells.z());
+    std::vector<Vector3i> cellOf(n);
+
+    for (unsigned int i = 0; i < n; i++) {
+      Vector3d scaled = invHmat * (refPos_[i] - lo);
+      for (int k = 0; k < 3; k++) {
+        if (usePBC_) scaled[k] -= std::floor(scaled[k]);
+        cellOf[i][k] = std::min(int(scaled[k] * nCells[k]), nCells[k] - 1);
+      }
+      cellList[(cellOf[i].z() * nCells.y() + cellOf[i].y()) * nCells.x() + 
+               cellOf[i].x()].push_back(i);
+    }
+
+    // With periodic boundaries and fewer than three cells along an
+    // axis the neighboring cells wrap onto each other, so only the
+    // distinct ones are visited.
+    std::vector<int> offsets[3];
+    for (int k = 0; k < 3; k++) {
+      offsets[k].push_back(0);
+      if (!usePBC_ || nCells[k] > 1) offsets[k].push_back(1);
+      if (!usePBC_ || nCells[k] > 2) offsets[k].push_back(-1);
+    }
+
+    for (unsigned int i = 0; i < n; i++) {
+      for (unsigned int ox = 0; ox < offsets[0].size(); ox++) {
+        int cx = cellOf[i].x() + offsets[0][ox];
+        for (unsigned int oy = 0; oy < offsets[1].size(); oy++) {
+          int cy = cellOf[i].y() + offsets[1][oy];
+          for (unsigned int oz = 0; oz < offsets[2].size(); oz++) {
+            int cz = cellOf[i].z() + offsets[2][oz];
+            
+            if (usePBC_) {
+              cx = (cx + nCells.x()) % nCells.x();
+              cy = (cy + nCells.y()) % nCells.y();
+              cz = (cz + nCells.z()) % nCells.z();
+            } else if (cx < 0 || cx >= nCells.x() || 
+                       cy < 0 || cy >= nCells.y() ||
+                       cz < 0 || cz >= nCells.z()) {
+              continue;
+            }
+
+            std::vector<int>& cell = cellList[(cz * nCells.y() + cy) * 
+                                              nCells.x() + cx];
+            for (unsigned int c = 0; c < cell.size(); c++) {
+              unsigned int j = cell[c];
+              if (j <= i) continue;
+              Vector3d diff = refPos_[j] - refPos_[i];
+              if (usePBC_) currentSnapshot_->wrapVector(diff);
+              if (diff.lengthSquare() < rList2) {
+                candidates_[i].push_back(j);
+                candidates_[j].push_back(i);
+              }
+            }
+          }
+        }
+      }
+    }
+    nRebuilds_++;
+  }
+
   void GCNSeq::doFrame(int istep) {
     SelectionManager common(info_);
     
     std::vector<std::vector<int> > listNN;
     std::vector<int> globalToLocal;
+    std::vector<StuntDouble*> sds;
 
     StuntDouble* sd1;
-    StuntDouble* sd2;
         
     int iterator1;
-    int iterator2;
     unsigned int mapIndex1(0);
-    unsigned int mapIndex2(0);
     unsigned int tempIndex(0);
     unsigned int whichBin(0);
     RealType gcn(0.0);
-    Vector3d pos1;
-    Vector3d pos2;
     Vector3d diff;
-    RealType distance;
+    RealType rCut2 = rCut_ * rCut_;
     
     //First have to calculate lists of nearest neighbors (listNN_):
              
@@ -108,39 +239,31 @@ namespace OpenMD {
     globalToLocal.clear();
     globalToLocal.resize(info_->getNGlobalAtoms() +
                          info_->getNGlobalRigidBodies(), -1);
-    for (unsigned int i = 0; i < listNN.size(); i++)         
-      listNN.at(i).clear();
-    listNN.clear();
     listNN.resize(commonCount);
     std::vector<RealType> histo;
     histo.resize(bins_, 0.0);
     
     mapIndex1 = 0;
     for(sd1 = common.beginSelected(iterator1); sd1 != NULL;
-        sd1 = common.nextSelected(iterator1)) {
-      
+        sd1 = common.nextSelected(iterator1)) {      
       globalToLocal.at(sd1->getGlobalIndex()) = mapIndex1;
-      
-      pos1 = sd1->getPos();
-      
-      mapIndex2 = 0;
-      for(sd2 = common.beginSelected(iterator2); sd2 != NULL;
-          sd2 = common.nextSelected(iterator2)) {
-        
-        if (mapIndex1 < mapIndex2) {
-          pos2 = sd2->getPos();
-          diff = pos2 - pos1;
-          if (usePBC_) currentSnapshot_->wrapVector(diff);
-          distance = diff.length();
-          if (distance < rCut_) {
-            listNN.at(mapIndex1).push_back(mapIndex2);
-            listNN.at(mapIndex2).push_back(mapIndex1);
-          }
-        }
-        mapIndex2++;
-      }
+      sds.push_back(sd1);
       mapIndex1++;
     }
+
+    if (needsRebuild(sds)) buildCandidates(sds);
+    nFrames_++;
+
+    // the actual neighbors are the candidates inside the cutoff:
+    for (unsigned int i = 0; i < sds.size(); i++) {
+      Vector3d pos1 = sds[i]->getPos();
+      for (unsigned int c = 0; c < candidates_[i].size(); c++) {
+        unsigned int j = candidates_[i][c];
+        diff = sds[j]->getPos() - pos1;
+        if (usePBC_) currentSnapshot_->wrapVector(diff);
+        if (diff.lengthSquare() < rCut2) listNN[i].push_back(j);
+      }
+    }
     
     // Fill up the histogram with gcn values
     for(sd1 = seleMan1_.beginSelected(iterator1); sd1 != NULL;
@@ -214,4 +337,13 @@ namespace OpenMD {
     
     ofs.close();    
   }
+
+  void GCNSeq::postSequence() {
+    sprintf(painCave.errMsg,
+            "GCNSeq: neighbor lists were rebuilt %d times in %d frames.\n",
+            nRebuilds_, nFrames_);
+    painCave.isFatal = 0;
+    painCave.severity = OPENMD_INFO;
+    simError();
+  }
 }
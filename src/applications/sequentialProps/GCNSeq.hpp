@@ -65,6 +65,11 @@ namespace OpenMD {
    *   rCut = cutoff radius for finding lists of nearest neighbors
    *   sele1 = selection of StuntDoubles used for the GCN distribution
    *   sele2 = selection of StuntDoubles used for nearest neighbor computation
+   *
+   * Nearest neighbors are found with a cell list built at rCut plus a
+   * skin.  The resulting candidate pairs are reused in later frames
+   * until some object has moved more than half of the skin, the box
+   * changes, or the selection changes.
    */
   class GCNSeq : public SequentialAnalyzer {
     
@@ -76,7 +81,12 @@ namespace OpenMD {
     virtual void doFrame(int istep);
     virtual void writeSequence();
     
+  protected:
+    virtual void postSequence();
+
   private:
+    bool needsRebuild(const std::vector<StuntDouble*>& sds);
+    void buildCandidates(const std::vector<StuntDouble*>& sds);
 
     RealType rCut_;    
     int bins_;
@@ -86,6 +96,14 @@ namespace OpenMD {
     RealType delta_;
     int selectionCount1_;
     int selectionCount2_;
+
+    RealType skin_;
+    int nRebuilds_;
+    int nFrames_;
+    std::vector<int> refIndices_;
+    std::vector<Vector3d> refPos_;
+    Mat3x3d refHmat_;
+    std::vector<std::vector<int> > candidates_;
     
     std::vector<int> count_;
     std::vector<std::vector<RealType> >  histogram_;
@@ -41,7 +41,9 @@
  */
 
 #include <algorithm>
+#include <fstream>
 #include <functional>
+#include <thread>
 #include "applications/sequentialProps/SequentialAnalyzer.hpp"
 #include "utils/simError.h"
 #include "utils/Revision.hpp"
@@ -82,8 +84,24 @@ namespace OpenMD {
   
     storageLayout_ = info_->getStorageLayout();
 
+    // The text of the next frame is fetched on a helper thread while
+    // the current frame is being analyzed.  Parsing still happens here
+    // because every frame is loaded into the same SimInfo.
+    std::ifstream textStream(dumpFilename_.c_str(),
+                             std::ifstream::in | std::ifstream::binary);
+    std::string frameText, nextFrameText;
+    if (nFrames > 0) reader.readFrameText(textStream, 0, frameText);
+
     for (frame_ = 0; frame_ < nFrames; frame_ += step_) {
-      reader.readFrame(frame_);
+      int nextFrame = frame_ + step_;
+      std::thread prefetch;
+      if (nextFrame < nFrames) {
+        prefetch = std::thread(&DumpReader::readFrameText, &reader,
+                               std::ref(textStream), nextFrame,
+                               std::ref(nextFrameText));
+      }
+
+      reader.readFrame(frame_, frameText);
       currentSnapshot_ = info_->getSnapshotManager()->getCurrentSnapshot();
       times_.push_back( currentSnapshot_->getTime() );
       
@@ -95,6 +113,9 @@ namespace OpenMD {
       }
             
       doFrame(frame_);
+
+      if (prefetch.joinable()) prefetch.join();
+      frameText.swap(nextFrameText);
     }   
 
     postSequence();
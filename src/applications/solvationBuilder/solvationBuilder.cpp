@@ -0,0 +1,333 @@
+/*
+ * Copyright (c) 2018 The University of Notre Dame. All Rights Reserved.
+ *
+ * The University of Notre Dame grants you ("Licensee") a
+ * non-exclusive, royalty free, license to use, modify and
+ * redistribute this software in source and binary code form, provided
+ * that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the
+ *    distribution.
+ *
+ * This software is provided "AS IS," without a warranty of any
+ * kind. All express or implied conditions, representations and
+ * warranties, including any implied warranty of merchantability,
+ * fitness for a particular purpose or non-infringement, are hereby
+ * excluded.  The University of Notre Dame and its licensors shall not
+ * be liable for any damages suffered by licensee as a result of
+ * using, modifying or distributing the software or its
+ * derivatives. In no event will the University of Notre Dame or its
+ * licensors be liable for any lost revenue, profit or data, or for
+ * direct, indirect, special, consequential, incidental or punitive
+ * damages, however caused and regardless of the theory of liability,
+ * arising out of the use of or inability to use software, even if the
+ * University of Notre Dame has been advised of the possibility of
+ * such damages.
+ *
+ * SUPPORT OPEN SCIENCE!  If you use OpenMD or its source code in your
+ * research, please cite the appropriate papers when you publish your
+ * work.  Good starting points are:
+ *                                                                      
+ * [1]  Meineke, et al., J. Comp. Chem. 26, 252-271 (2005).             
+ * [2]  Fennell & Gezelter, J. Chem. Phys. 124, 234104 (2006).          
+ * [3]  Sun, Lin & Gezelter, J. Chem. Phys. 128, 234107 (2008).          
+ * [4]  Kuang & Gezelter,  J. Chem. Phys. 133, 164101 (2010).
+ * [5]  Vardeman, Stocker & Gezelter, J. Chem. Theory Comput. 7, 834 (2011).
+ */
+ 
+#include <cstdio>
+#include <cstring>
+#include <cmath>
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <set>
+
+#include "solvationBuilderCmd.hpp"
+#include "brains/Register.hpp"
+#include "brains/SimCreator.hpp"
+#include "brains/SimInfo.hpp"
+#include "primitives/Molecule.hpp"
+#include "primitives/RigidBody.hpp"
+#include "io/DumpWriter.hpp"
+#include "utils/OccupancyGrid.hpp"
+#include "utils/simError.h"
+
+using namespace std;
+using namespace OpenMD;
+
+void updateRigidBodies(SimInfo* info);
+std::string getMoleculeDefinitions(const std::string& rawMetaData,
+                                   std::set<std::string>& includes,
+                                   std::set<std::string>& molecules);
+void writeIntegrableObjects(std::ostream& os, Molecule* mol, int& index);
+
+int main(int argc, char *argv []) {
+
+  gengetopt_args_info args_info;
+
+  // parse command line arguments
+  if (cmdline_parser(argc, argv, &args_info) != 0)
+    exit(1);
+
+  std::string soluteFileName = args_info.solute_arg;
+  std::string solventFileName = args_info.solvent_arg;
+  std::string outputFileName = args_info.output_arg;
+  RealType rcut = args_info.rcut_arg;
+
+  if (rcut <= 0.0) {
+    sprintf(painCave.errMsg, "The cutoff radius must be greater than 0.");
+    painCave.isFatal = 1;
+    simError();
+  }
+
+  //parse md files and set up the two systems
+
+  SimCreator soluteCreator;
+  SimInfo* solute = soluteCreator.createSim(soluteFileName, true);
+  updateRigidBodies(solute);
+
+  SimCreator solventCreator;
+  SimInfo* solvent = solventCreator.createSim(solventFileName, true);
+  updateRigidBodies(solvent);
+
+  Snapshot* soluteSnap = solute->getSnapshotManager()->getCurrentSnapshot();
+  Snapshot* solventSnap = solvent->getSnapshotManager()->getCurrentSnapshot();
+  Mat3x3d hmat = soluteSnap->getHmat();
+  Mat3x3d solventHmat = solventSnap->getHmat();
+
+  const RealType boxTolerance = 1.0e-3;
+  RealType maxDiff = 0.0;
+  for (int i = 0; i < 3; i++) 
+    for (int j = 0; j < 3; j++) 
+      maxDiff = std::max(maxDiff, std::fabs(hmat(i, j) - solventHmat(i, j)));
+  
+  if (maxDiff > boxTolerance) {
+    sprintf(painCave.errMsg, "The solute and solvent boxes have different "
+            "geometries (Hmat elements differ by %g).\n", maxDiff);
+    painCave.isFatal = 1;
+    simError();
+  }
+
+  // bin the solute atoms:
+
+  OccupancyGrid grid(hmat, rcut);
+  SimInfo::MoleculeIterator mi;
+  Molecule::AtomIterator ai;
+  Molecule* mol;
+  Atom* atom;
+
+  for (mol = solute->beginMolecule(mi); mol != NULL; 
+       mol = solute->nextMolecule(mi)) {
+    for (atom = mol->beginAtom(ai); atom != NULL; atom = mol->nextAtom(ai)) {
+      grid.addPoint(atom->getPos());
+    }
+  }
+
+  // carve out every solvent molecule with an atom inside the cutoff:
+
+  std::vector<Component*> components = solvent->getSimParams()->getComponents();
+  std::vector<int> nKept(components.size(), 0);
+  std::vector<Molecule*> keepers;
+  std::size_t whichComponent = 0;
+  int componentEnd = components.empty() ? 0 : components[0]->getNMol();
+  int nRemoved = 0;
+
+  for (mol = solvent->beginMolecule(mi); mol != NULL; 
+       mol = solvent->nextMolecule(mi)) {
+
+    while (mol->getGlobalIndex() >= componentEnd && 
+           whichComponent + 1 < components.size()) {
+      whichComponent++;
+      componentEnd += components[whichComponent]->getNMol();
+    }
+
+    bool overlaps = false;
+    for (atom = mol->beginAtom(ai); atom != NULL; atom = mol->nextAtom(ai)) {
+      if (grid.isOccupied(atom->getPos())) {
+        overlaps = true;
+        break;
+      }
+    }
+
+    if (overlaps) {
+      nRemoved++;
+    } else {
+      keepers.push_back(mol);
+      nKept[whichComponent]++;
+    }
+  }
+
+  // write the combined system:
+
+  ofstream outFile(outputFileName.c_str());
+  if (!outFile) {
+    sprintf(painCave.errMsg, "Could not open \"%s\" for output.\n",
+            outputFileName.c_str());
+    painCave.isFatal = 1;
+    simError();
+  }
+
+  // the solvent molecules are defined by the #include lines and
+  // molecule blocks of the solvent file, less the ones the solute
+  // file already has:
+
+  std::set<std::string> includes;
+  std::set<std::string> molecules;
+  getMoleculeDefinitions(solute->getRawMetaData(), includes, molecules);
+  for (int i = 0; i < solute->getNMoleculeStamp(); i++)
+    molecules.insert(solute->getMoleculeStamp(i)->getName());
+
+  std::string solventDefinitions = 
+    getMoleculeDefinitions(solvent->getRawMetaData(), includes, molecules);
+
+  outFile << "<OpenMD version=2>" << std::endl;
+  outFile << "  <MetaData>" << std::endl;
+  outFile << solute->getRawMetaData();
+  outFile << solventDefinitions;
+  for (std::size_t i = 0; i < components.size(); i++) {
+    outFile << "component{" << std::endl;
+    outFile << "  type = \"" << components[i]->getType() << "\";" << std::endl;
+    outFile << "  nMol = " << nKept[i] << ";" << std::endl;
+    outFile << "}" << std::endl;
+  }
+  outFile << "  </MetaData>" << std::endl;
+
+  outFile << "  <Snapshot>\n";
+  DumpWriter::writeFrameProperties(outFile, soluteSnap);
+  outFile << "    <StuntDoubles>\n";
+
+  int index = 0;
+  for (mol = solute->beginMolecule(mi); mol != NULL; 
+       mol = solute->nextMolecule(mi)) {
+    writeIntegrableObjects(outFile, mol, index);
+  }
+  for (std::size_t i = 0; i < keepers.size(); i++) {
+    writeIntegrableObjects(outFile, keepers[i], index);
+  }
+
+  outFile << "    </StuntDoubles>\n";
+  outFile << "  </Snapshot>\n";
+  outFile << "</OpenMD>\n";
+  outFile.close();
+
+  Vector3i nCells = grid.getNCells();
+  sprintf(painCave.errMsg, "Removed %d of %d solvent molecules overlapping "
+          "with %d solute atoms\n"
+          "\t(%d x %d x %d cell grid).  A new OpenMD file called \"%s\"\n"
+          "\thas been generated.\n", 
+          nRemoved, solvent->getNGlobalMolecules(), grid.getNPoints(),
+          nCells.x(), nCells.y(), nCells.z(), outputFileName.c_str());
+  painCave.isFatal = 0;
+  painCave.severity = OPENMD_INFO;
+  simError();
+
+  delete solute;
+  delete solvent;
+  return 0;
+}
+
+void updateRigidBodies(SimInfo* info) {
+  SimInfo::MoleculeIterator mi;
+  Molecule::RigidBodyIterator rbIter;
+  Molecule* mol;
+  RigidBody* rb;
+
+  for (mol = info->beginMolecule(mi); mol != NULL; 
+       mol = info->nextMolecule(mi)) {
+    for (rb = mol->beginRigidBody(rbIter); rb != NULL; 
+         rb = mol->nextRigidBody(rbIter)) {
+      rb->updateAtoms();
+    }
+  }
+}
+
+/**
+ * Returns the #include lines and molecule{} blocks of a raw MetaData
+ * block that are not yet in includes and molecules, and adds them to
+ * those sets.  Everything else (components, global parameters) is
+ * skipped.
+ */
+std::string getMoleculeDefinitions(const std::string& rawMetaData,
+                                   std::set<std::string>& includes,
+                                   std::set<std::string>& molecules) {
+  std::istringstream metaData(rawMetaData);
+  std::string definitions;
+  std::string line;
+  std::string block;
+  int depth = 0;
+  bool inMolecule = false;
+
+  while (std::getline(metaData, line)) {
+    // braces inside comments don't count:
+    std::string code = line.substr(0, line.find("//"));
+    std::size_t first = code.find_first_not_of(" \t");
+
+    if (depth == 0 && first != std::string::npos) {
+      if (code.compare(first, 8, "#include") == 0) {
+        std::size_t last = code.find_last_not_of(" \t\r");
+        std::string include = code.substr(first, last - first + 1);
+        if (includes.insert(include).second) 
+          definitions += line + '\n';
+        continue;
+      }
+      inMolecule = (code.compare(first, 8, "molecule") == 0);
+      block.clear();
+    }
+
+    if (inMolecule) block += line + '\n';
+
+    for (std::size_t i = 0; i < code.size(); i++) {
+      if (code[i] == '{') depth++;
+      if (code[i] == '}') depth--;
+    }
+
+    if (inMolecule && depth == 0 && code.find('}') != std::string::npos) {
+      // the first name statement in the block is the molecule's name:
+      std::string name;
+      std::size_t n = block.find("name");
+      if (n != std::string::npos) {
+        std::size_t q1 = block.find('"', n);
+        std::size_t q2 = block.find('"', q1 + 1);
+        if (q1 != std::string::npos && q2 != std::string::npos)
+          name = block.substr(q1 + 1, q2 - q1 - 1);
+      }
+      if (molecules.insert(name).second) definitions += block;
+      inMolecule = false;
+    }
+  }
+  return definitions;
+}
+
+void writeIntegrableObjects(std::ostream& os, Molecule* mol, int& index) {
+  Molecule::IntegrableObjectIterator ii;
+  StuntDouble* sd;
+  char buffer[4096];
+
+  for (sd = mol->beginIntegrableObject(ii); sd != NULL;
+       sd = mol->nextIntegrableObject(ii)) {
+    Vector3d pos = sd->getPos();
+    Vector3d vel = sd->getVel();
+
+    if (sd->isDirectional()) {
+      Quat4d q = sd->getQ();
+      Vector3d ji = sd->getJ();
+      sprintf(buffer, "%10d %7s %18.10g %18.10g %18.10g %13e %13e %13e"
+              " %13e %13e %13e %13e %13e %13e %13e\n", index, "pvqj",
+              pos[0], pos[1], pos[2], vel[0], vel[1], vel[2],
+              q[0], q[1], q[2], q[3], ji[0], ji[1], ji[2]);
+    } else {
+      sprintf(buffer, "%10d %7s %18.10g %18.10g %18.10g %13e %13e %13e\n",
+              index, "pv", pos[0], pos[1], pos[2], vel[0], vel[1], vel[2]);
+    }
+    os << buffer;
+    index++;
+  }
+}
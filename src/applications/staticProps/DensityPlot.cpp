@@ -56,7 +56,7 @@ namespace OpenMD {
 			   const std::string& sele, const std::string& cmSele,
 			   RealType len, int nrbins) 
     : StaticAnalyser(info, filename, nrbins), 
-      len_(len), halfLen_(len/2), nRBins_(nrbins),
+      len_(len), halfLen_(len/2), nRBins_(nrbins), density_(nrbins, 1, 1),
       selectionScript_(sele), seleMan_(info), evaluator_(info), 
       cmSelectionScript_(cmSele), cmSeleMan_(info), cmEvaluator_(info) {
 
@@ -64,7 +64,6 @@ namespace OpenMD {
     
     deltaR_ = len_ /nRBins_;  
     histogram_.resize(nRBins_);
-    density_.resize(nRBins_);
     
     std::fill(histogram_.begin(), histogram_.end(), 0);  
     
@@ -80,91 +79,105 @@ namespace OpenMD {
     }    
   }
 
-  void DensityPlot::process() {
+  void DensityPlot::beginFrames(int nFrames) {
+    nProcessed_ = nFrames /step_;
+    density_.clear();
+  }
+
+  void DensityPlot::processFrame(int frame) {
 
     bool usePeriodicBoundaryConditions_ = info_->getSimParams()->getUsePeriodicBoundaryConditions();
 
-    DumpReader reader(info_, dumpFilename_);    
-    int nFrames = reader.getNFrames();
-    for (int i = 0; i < nFrames; i += step_) {
-      reader.readFrame(i);
-      currentSnapshot_ = info_->getSnapshotManager()->getCurrentSnapshot();
-      
-      if (evaluator_.isDynamic()) {
-	seleMan_.setSelectionSet(evaluator_.evaluate());
-      }
+    currentSnapshot_ = info_->getSnapshotManager()->getCurrentSnapshot();
+    
+    if (evaluator_.isDynamic()) {
+      seleMan_.setSelectionSet(evaluator_.evaluate());
+    }
 
-      if (cmEvaluator_.isDynamic()) {
-	cmSeleMan_.setSelectionSet(cmEvaluator_.evaluate());
-      }
+    if (cmEvaluator_.isDynamic()) {
+      cmSeleMan_.setSelectionSet(cmEvaluator_.evaluate());
+    }
 
-      Vector3d origin = calcNewOrigin();
+    Vector3d origin = calcNewOrigin();
+
+    Mat3x3d hmat = currentSnapshot_->getHmat();
+    RealType slabVolume = deltaR_ * hmat(0, 0) * hmat(1, 1);
+    // The per-atom parameters are looked up serially so that any
+    // errors are reported from the main thread.
+    std::vector<Vector3d> positions;
+    std::vector<RealType> nelectrons;
+    std::vector<RealType> sigmas;
+    int k; 
+    for (StuntDouble* sd = seleMan_.beginSelected(k); sd != NULL; 
+         sd = seleMan_.nextSelected(k)) {
+
+
+      if (!sd->isAtom()) {
+        sprintf( painCave.errMsg, 
+      	   "Can not calculate electron density if it is not atom\n");
+        painCave.severity = OPENMD_ERROR;
+        painCave.isFatal = 1;
+        simError(); 
+      }
+          
+      Atom* atom = static_cast<Atom*>(sd);
+      GenericData* data = atom->getAtomType()->getPropertyByName("nelectron");
+      if (data == NULL) {
+        sprintf( painCave.errMsg, "Can not find Parameters for nelectron\n");
+        painCave.severity = OPENMD_ERROR;
+        painCave.isFatal = 1;
+        simError(); 
+      }
+          
+      DoubleGenericData* doubleData = dynamic_cast<DoubleGenericData*>(data);
+      if (doubleData == NULL) {
+        sprintf( painCave.errMsg,
+                 "Can not cast GenericData to DoubleGenericData\n");
+        painCave.severity = OPENMD_ERROR;
+        painCave.isFatal = 1;
+        simError();   
+      }
+          
+      LennardJonesAdapter lja = LennardJonesAdapter(atom->getAtomType());
+      positions.push_back(sd->getPos() - origin);
+      nelectrons.push_back(doubleData->getData());
+      sigmas.push_back(lja.getSigma() * 0.5);
+    }
 
-      Mat3x3d hmat = currentSnapshot_->getHmat();
-      RealType slabVolume = deltaR_ * hmat(0, 0) * hmat(1, 1);
-      int k; 
-      for (StuntDouble* sd = seleMan_.beginSelected(k); sd != NULL; 
-	   sd = seleMan_.nextSelected(k)) {
+    density_.parallelFor(positions.size(), [&](int n) {
+        RealType nelectron = nelectrons[n];
+        RealType sigma = sigmas[n];
+        RealType sigma2 = sigma * sigma;
+        RealType prefactor = nelectron / 
+          (slabVolume * sqrt(2*Constants::PI*sigma*sigma));
 
+        // The gaussian is negligible beyond 6 sigma, so only the
+        // bins inside that window are visited:
+        int jmin = std::max(0, int((halfLen_ - 6.0 * sigma) / deltaR_));
+        int jmax = std::min(nRBins_ - 1,
+                            int((halfLen_ + 6.0 * sigma) / deltaR_) + 1);
 
-        if (!sd->isAtom()) {
-          sprintf( painCave.errMsg, 
-		   "Can not calculate electron density if it is not atom\n");
-          painCave.severity = OPENMD_ERROR;
-          painCave.isFatal = 1;
-          simError(); 
-        }
-            
-        Atom* atom = static_cast<Atom*>(sd);
-        GenericData* data = atom->getAtomType()->getPropertyByName("nelectron");
-        if (data == NULL) {
-          sprintf( painCave.errMsg, "Can not find Parameters for nelectron\n");
-          painCave.severity = OPENMD_ERROR;
-          painCave.isFatal = 1;
-          simError(); 
-        }
-            
-        DoubleGenericData* doubleData = dynamic_cast<DoubleGenericData*>(data);
-        if (doubleData == NULL) {
-          sprintf( painCave.errMsg,
-                   "Can not cast GenericData to DoubleGenericData\n");
-          painCave.severity = OPENMD_ERROR;
-          painCave.isFatal = 1;
-          simError();   
-        }
-            
-        RealType nelectron = doubleData->getData();
-        LennardJonesAdapter lja = LennardJonesAdapter(atom->getAtomType());
-        RealType sigma = lja.getSigma() * 0.5;
-        RealType sigma2 = sigma * sigma;
-            
-        Vector3d pos = sd->getPos() - origin;
-        for (int j =0; j < nRBins_; ++j) {
-          Vector3d tmp(pos);
+        for (int j = jmin; j <= jmax; ++j) {
+          Vector3d tmp(positions[n]);
           RealType zdist =j * deltaR_ - halfLen_;
           tmp[2] += zdist;
           if (usePeriodicBoundaryConditions_) 
             currentSnapshot_->wrapVector(tmp);
-              
+            
           RealType wrappedZdist = tmp.z() + halfLen_;
           if (wrappedZdist < 0.0 || wrappedZdist > len_) {
             continue;
           }
-              
-          int which = int(wrappedZdist / deltaR_);
-          density_[which] += nelectron * exp(-zdist*zdist/(sigma2*2.0)) /(slabVolume* sqrt(2*Constants::PI*sigma*sigma));
-              
-        }            
-      }        
-    }
-  
-    int nProcessed = nFrames /step_;
-    std::transform(density_.begin(), density_.end(), density_.begin(), 
-		   std::bind2nd(std::divides<RealType>(), nProcessed));  
-    writeDensity();
-        
+            
+          int which = std::min(int(wrappedZdist / deltaR_), nRBins_ - 1);
+          density_.add(which, 0, 0, 
+                       prefactor * exp(-zdist*zdist/(sigma2*2.0)));
+        }
+      });
+  }
 
-  
+  void DensityPlot::endFrames() {
+    writeDensity();
   }
 
   Vector3d DensityPlot::calcNewOrigin() {
@@ -191,7 +204,8 @@ namespace OpenMD {
       ofs << "#nRBins = " << nRBins_ << "\t maxLen = " 
 	  << len_ << "\tdeltaR = " << deltaR_ <<"\n";
       for (unsigned int i = 0; i < histogram_.size(); ++i) {
-        ofs << i*deltaR_ - halfLen_ <<"\t" << density_[i]<< std::endl;
+        ofs << i*deltaR_ - halfLen_ <<"\t" << density_(i, 0, 0) / nProcessed_
+            << std::endl;
       }        
     } else {
 
@@ -44,13 +44,17 @@
 #include "selection/SelectionEvaluator.hpp"
 #include "selection/SelectionManager.hpp"
 #include "applications/staticProps/StaticAnalyser.hpp"
+#include "utils/GridAccumulator.hpp"
 
 namespace OpenMD {
 
     class DensityPlot : public StaticAnalyser{
         public:
             DensityPlot(SimInfo* info, const std::string& filename, const std::string& sele, const std::string& cmSele,RealType len, int nrbins);
-            virtual void process();
+            virtual bool isFrameWise() { return true; }
+            virtual void beginFrames(int nFrames);
+            virtual void processFrame(int frame);
+            virtual void endFrames();
 
             int getNRBins() {
               return nRBins_; 
@@ -70,9 +74,10 @@ namespace OpenMD {
             RealType len_;
             RealType halfLen_;
             int nRBins_;
+            int nProcessed_;
             RealType deltaR_;                
             std::vector<int> histogram_; 
-            std::vector<RealType> density_; 
+            GridAccumulator<RealType> density_; 
 
             std::string selectionScript_;
             SelectionManager seleMan_;
@@ -53,7 +53,8 @@ namespace OpenMD {
 		 const std::string& sele1, const std::string& sele2, 
 		 const std::string& sele3, RealType len, int nrbins)
     : RadialDistrFunc(info, filename, sele1, sele2, nrbins), len_(len), 
-      halfLen_(len/2), evaluator3_(info), seleMan3_(info) {
+      halfLen_(len/2), evaluator3_(info), seleMan3_(info),
+      histogram_(nrbins, nrbins, nrbins) {
     
     setOutputName(getPrefix(filename) + ".gxyz");
     
@@ -63,23 +64,44 @@ namespace OpenMD {
     }    
     
     deltaR_ =  len_ / nBins_;
-    
-    histogram_.resize(nBins_);
-    for (unsigned int i = 0 ; i < nBins_; ++i) {
-      histogram_[i].resize(nBins_);
-      for(unsigned int j = 0; j < nBins_; ++j) {
-	histogram_[i][j].resize(nBins_);
-      }
-    }    
   }
   
   void GofXyz::preProcess() {
-    for (unsigned int i = 0 ; i < nBins_; ++i) {
-      histogram_[i].resize(nBins_);
-      for(unsigned int j = 0; j < nBins_; ++j) {
-	std::fill(histogram_[i][j].begin(), histogram_[i][j].end(), 0);
-      }
-    }   
+    histogram_.clear();
+  }
+
+  // The pair loops are spread over threads by the first object of
+  // each pair; collectHistogram only reads the snapshot and rotMats_,
+  // and the histogram itself accumulates atomically.
+  void GofXyz::processNonOverlapping(SelectionManager& sman1, 
+                                     SelectionManager& sman2) {
+    std::vector<StuntDouble*> sds1, sds2;
+    StuntDouble* sd;
+    int i;
+
+    for (sd = sman1.beginSelected(i); sd != NULL; sd = sman1.nextSelected(i))
+      sds1.push_back(sd);
+    for (sd = sman2.beginSelected(i); sd != NULL; sd = sman2.nextSelected(i))
+      sds2.push_back(sd);
+
+    histogram_.parallelFor(sds1.size(), [&](int n) {
+        for (unsigned int m = 0; m < sds2.size(); ++m)
+          collectHistogram(sds1[n], sds2[m]);
+      });
+  }
+
+  void GofXyz::processOverlapping(SelectionManager& sman) {
+    std::vector<StuntDouble*> sds;
+    StuntDouble* sd;
+    int i;
+
+    for (sd = sman.beginSelected(i); sd != NULL; sd = sman.nextSelected(i))
+      sds.push_back(sd);
+
+    histogram_.parallelFor(sds.size(), [&](int n) {
+        for (unsigned int m = n + 1; m < sds.size(); ++m)
+          collectHistogram(sds[n], sds[m]);
+      });
   }
   
   
@@ -164,7 +186,7 @@ namespace OpenMD {
     if (xbin < int(nBins_) && xbin >=0 &&
         ybin < int(nBins_) && ybin >= 0 &&
         zbin < int(nBins_) && zbin >=0 ) {
-      ++histogram_[xbin][ybin][zbin];
+      histogram_.add(xbin, ybin, zbin, 1);
     }
     
   }
@@ -177,11 +199,12 @@ namespace OpenMD {
       //rdfStream << "selection2: (" << selectionScript2_ << ")\n";
       //rdfStream << "#nRBins = " << nBins_ << "\t maxLen = " 
       //          << len_ << "deltaR = " << deltaR_ <<"\n";
-      for (unsigned int i = 0; i < histogram_.size(); ++i) { 
-	for(unsigned int j = 0; j < histogram_[i].size(); ++j) { 
-	  for(unsigned int k = 0;k < histogram_[i][j].size(); ++k) {
-	    rdfStream.write(reinterpret_cast<char *>( &histogram_[i][j][k] ),
-                            sizeof( histogram_[i][j][k] ));
+      for (unsigned int i = 0; i < histogram_.getDim1(); ++i) { 
+	for(unsigned int j = 0; j < histogram_.getDim2(); ++j) { 
+	  for(unsigned int k = 0;k < histogram_.getDim3(); ++k) {
+            int count = histogram_(i, j, k);
+	    rdfStream.write(reinterpret_cast<char *>( &count ),
+                            sizeof( count ));
 	  }
 	}
       }
@@ -43,6 +43,7 @@
 #define APPLICATIONS_STATICPROPS_GOFXYZ_HPP
 
 #include "applications/staticProps/RadialDistrFunc.hpp"
+#include "utils/GridAccumulator.hpp"
 namespace OpenMD {
 
   class GofXyz : public RadialDistrFunc {
@@ -62,6 +63,9 @@ namespace OpenMD {
   private:
 
     virtual void preProcess();
+    virtual void processNonOverlapping(SelectionManager& sman1, 
+                                       SelectionManager& sman2);
+    virtual void processOverlapping(SelectionManager& sman);
     void initializeHistogram();
     virtual void collectHistogram(StuntDouble* sd1, StuntDouble* sd2);
     virtual void writeRdf();
@@ -76,7 +80,7 @@ namespace OpenMD {
     SelectionEvaluator evaluator3_;
     SelectionManager seleMan3_;
         
-    std::vector<std::vector<std::vector<int> > > histogram_;
+    GridAccumulator<int> histogram_;
 
     std::map<int, RotMat3x3d> rotMats_;
 
@@ -67,7 +67,7 @@ namespace OpenMD {
            int nrbins)
     : StaticAnalyser(info, filename, nrbins), selectionScript_(sele),
       evaluator_(info), seleMan_(info), nBinsX_(nbins_x), nBinsY_(nbins_y),
-      nBinsZ_(nbins_z) {
+      nBinsZ_(nbins_z), dens_(nbins_x, nbins_y, nbins_z) {
 
     evaluator_.loadScriptString(sele);
     if (!evaluator_.isDynamic()) {
@@ -75,19 +75,14 @@ namespace OpenMD {
     }
 
     // dens_ stores the local density, rho(x,y,z) on a 3-D grid
-    dens_.resize(nBinsX_);
     // bin stores the upper and lower surface cutoff locations (z) for
     // a column through grid location x,y
     minHeight_.resize(nBinsX_);
     maxHeight_.resize(nBinsX_);
 
     for (unsigned int i = 0; i < nBinsX_; i++) {
-      dens_[i].resize(nBinsY_);
       minHeight_[i].resize(nBinsY_);
       maxHeight_[i].resize(nBinsY_);            
-      for (unsigned int j = 0; j < nBinsY_; j++) {
-        dens_[i][j].resize(nBinsZ_);
-      }
     }
     
     mag1.resize(nBinsX_*nBinsY_);
@@ -148,10 +143,8 @@ namespace OpenMD {
       for (unsigned int i = 0; i < nBinsX_; i++) {
         std::fill(minHeight_[i].begin(), minHeight_[i].end(), 0.0);
         std::fill(maxHeight_[i].begin(), maxHeight_[i].end(), 0.0);
-        for (unsigned int j = 0; j < nBinsY_; j++) {
-          std::fill(dens_[i][j].begin(), dens_[i][j].end(), 0.0);
-        }
       }
+      dens_.clear();
                  
       reader.readFrame(istep);
       currentSnapshot_ = info_->getSnapshotManager()->getCurrentSnapshot();
@@ -187,34 +180,40 @@ namespace OpenMD {
       RealType lenY_ = hmat(1,1);
       RealType lenZ_ = hmat(2,2);
 
-      RealType x, y, z, dx, dy, dz;
-      RealType sigma, rcut;
-      int di, dj, dk, ibin, jbin, kbin;
-      int igrid, jgrid, kgrid;
-      Vector3d scaled;
+      RealType dx, dy, dz;
       
       dx = lenX_ / nBinsX_;
       dy = lenY_ / nBinsY_;
       dz = lenZ_ / nBinsZ_;
 
+      std::vector<Vector3d> positions;
+      std::vector<RealType> sigmas;
 
       for (sd = seleMan_.beginSelected(ii); sd != NULL;
            sd = seleMan_.nextSelected(ii)) {
-
-
         if (sd->isAtom()) {
           Atom* atom = static_cast<Atom*>(sd);
-          Vector3d pos = sd->getPos();
           LennardJonesAdapter lja = LennardJonesAdapter(atom->getAtomType());
+          positions.push_back(sd->getPos());
           // For SPC/E water, this yields the Willard-Chandler
           // distance of 2.4 Angstroms:
-          sigma = lja.getSigma() * 0.758176459;
-          rcut = 3.0 * sigma;
-	  
+          sigmas.push_back(lja.getSigma() * 0.758176459);
+        }
+      }
+
+      // Each atom is binned directly into the voxel holding it and
+      // spread over the neighboring voxels; the atoms are handled on
+      // separate threads and dens_ accumulates atomically.
+      dens_.parallelFor(positions.size(), [&](int n) {
+          RealType x, y, z;
+          int di, dj, dk, ibin, jbin, kbin;
+          int igrid, jgrid, kgrid;
+          RealType sigma = sigmas[n];
+          RealType rcut = 3.0 * sigma;
 
           // scaled positions relative to the box vectors
 	  //  -> the atom's position in numbers of box lengths (more accurately box vectors)
-          scaled = invBox * pos ;
+          Vector3d scaled = invBox * positions[n];
 	  
           // wrap the vector back into the unit box by subtracting
           // integer box numbers
@@ -259,18 +258,17 @@ namespace OpenMD {
                 
 		RealType dist = sqrt(x*x + y*y + z*z);
 	    
-                dens_[igrid][jgrid][kgrid] += getDensity(dist, sigma, rcut);
+                dens_.add(igrid, jgrid, kgrid, getDensity(dist, sigma, rcut));
               }
             }
           }
-        }
-      }
+        });
 
       RealType maxDens(0.0);
       for (unsigned int i = 0; i < nBinsX_; i++) {
         for (unsigned int j = 0; j < nBinsY_; j++) {
           for (unsigned int k = 0; k < nBinsZ_; k++) {
-            if (dens_[i][j][k] > maxDens) maxDens = dens_[i][j][k];
+            if (dens_(i, j, k) > maxDens) maxDens = dens_(i, j, k);
           }
         }
       }
@@ -295,14 +293,14 @@ namespace OpenMD {
 	  bool minFound = false;
 	  bool maxFound = false;
           
-          if (dens_[i][j][0] < threshold) {
+          if (dens_(i, j, 0) < threshold) {
 
             for (unsigned int k = 0; k < nBinsZ_-1; k++) {
 	      
               z0 = lenZ_ * (RealType(k) / RealType(nBinsZ_));
               z1 = lenZ_ * (RealType(k+1) / RealType(nBinsZ_));
-              h0 = dens_[i][j][k];
-              h1 = dens_[i][j][k+1];
+              h0 = dens_(i, j, k);
+              h1 = dens_(i, j, k+1);
               
               if (h0 < threshold && h1 > threshold && !minFound) {
                 // simple linear interpolation to find the height:
@@ -321,8 +319,8 @@ namespace OpenMD {
 
               z0 = lenZ_ * (RealType(k) / RealType(nBinsZ_));
               z1 = lenZ_ * (RealType(k+1) / RealType(nBinsZ_));
-              h0 = dens_[i][j][k];
-              h1 = dens_[i][j][k+1];
+              h0 = dens_(i, j, k);
+              h1 = dens_(i, j, k+1);
               
               if (h0 > threshold && h1 < threshold && !maxFound) {
                 // simple linear interpolation to find the height:
@@ -67,6 +67,7 @@
 
 #include "applications/staticProps/RadialDistrFunc.hpp"
 #include "utils/Accumulator.hpp"
+#include "utils/GridAccumulator.hpp"
 
 namespace OpenMD {
   
@@ -94,7 +95,7 @@ namespace OpenMD {
     unsigned int nBinsZ_;
     RealType dfreq_;
 
-    std::vector<std::vector<std::vector<RealType> > > dens_;
+    GridAccumulator<RealType> dens_;
     std::vector<std::vector<RealType> > minHeight_;
     std::vector<std::vector<RealType> > maxHeight_;    
     std::vector<RealType> mag1, newmag1;
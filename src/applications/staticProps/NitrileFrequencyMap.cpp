@@ -127,10 +127,16 @@ namespace OpenMD {
     excludesForAtom.clear();
     excludesForAtom.resize(nAtoms);
 
-    for (int i = 0; i < nAtoms; i++) {
-      for (int j = 0; j < nAtoms; j++) {
-        if (excludes->hasPair(i, j)) 
+    const vector<int>& offsets = excludes->getRowOffsets();
+    const vector<int>& partners = excludes->getPartners();
+    int nRows = min(nAtoms, static_cast<int>(offsets.size()) - 1);
+    for (int i = 0; i < nRows; i++) {
+      for (int k = offsets[i]; k < offsets[i+1]; k++) {
+        int j = partners[k];
+        if (j < nAtoms) {
           excludesForAtom[i].push_back(j);              
+          excludesForAtom[j].push_back(i);              
+        }
       }      
     }    
 
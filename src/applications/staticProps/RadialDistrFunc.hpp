@@ -63,7 +63,10 @@ namespace OpenMD {
 
     virtual ~RadialDistrFunc() {}
         
-    void process();        
+    virtual bool isFrameWise() { return true; }
+    virtual void beginFrames(int nFrames);
+    virtual void processFrame(int frame);
+    virtual void endFrames();
 
 
         
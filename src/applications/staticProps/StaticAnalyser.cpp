@@ -41,6 +41,7 @@
  */
 
 #include "applications/staticProps/StaticAnalyser.hpp"
+#include "io/DumpReader.hpp"
 #include "utils/simError.h"
 #include "utils/Revision.hpp"
 
@@ -59,6 +60,18 @@ namespace OpenMD {
       counts_->accumulator.push_back( new Accumulator() );     
   }
   
+  void StaticAnalyser::process() {
+    DumpReader reader(info_, dumpFilename_);
+    int nFrames = reader.getNFrames();
+
+    beginFrames(nFrames);
+    for (int i = 0; i < nFrames; i += step_) {
+      reader.readFrame(i);
+      processFrame(i);
+    }
+    endFrames();
+  }
+  
   void StaticAnalyser::writeOutput() {
     vector<OutputData*>::iterator i;
     OutputData* outputData;
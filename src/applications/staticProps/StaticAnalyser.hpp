@@ -77,7 +77,22 @@ namespace OpenMD {
     StaticAnalyser(SimInfo* info, const std::string& filename, unsigned int nbins);
     
     virtual ~StaticAnalyser() {}
-    virtual void process()=0;
+
+    /**
+     * Runs the analysis over the dump file.  The default reads every
+     * step_'th frame and hands it to processFrame().
+     */
+    virtual void process();
+
+    /**
+     * Analysers that split their work into the per-frame calls below
+     * return true here, and can then share a single pass over the
+     * dump file with other analysers.
+     */
+    virtual bool isFrameWise() { return false; }
+    virtual void beginFrames(int nFrames) {}
+    virtual void processFrame(int frame) {}
+    virtual void endFrames() {}
 
     void setOutputName(const std::string& filename) {
       outputFilename_ = filename;
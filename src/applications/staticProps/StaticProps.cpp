@@ -43,6 +43,7 @@
 #include <iostream>
 #include <fstream>
 #include <string>
+#include <vector>
 
 #include "brains/SimCreator.hpp"
 #include "brains/SimInfo.hpp"
@@ -223,51 +224,58 @@ int main(int argc, char* argv[]){
   }
 
       
-  StaticAnalyser* analyser;
+  std::vector<StaticAnalyser*> analysers;
   
                                        
   if (args_info.gofr_given){
-    analyser= new GofR(info, dumpFileName, sele1, sele2, maxLen, 
-		       nrbins);        
-  } else if (args_info.gofz_given) {
-    analyser= new GofZ(info, dumpFileName, sele1, sele2, maxLen,
-		       args_info.nbins_arg, privilegedAxis);
-  } else if (args_info.r_z_given) {
-    analyser  = new GofRZ(info, dumpFileName, sele1, sele2, maxLen, zmaxLen, 
-			  nrbins, args_info.nbins_z_arg, privilegedAxis);
-  } else if (args_info.r_theta_given) {
+    analysers.push_back(new GofR(info, dumpFileName, sele1, sele2, maxLen, 
+                                 nrbins));        
+  }
+  if (args_info.gofz_given) {
+    analysers.push_back(new GofZ(info, dumpFileName, sele1, sele2, maxLen,
+                                 args_info.nbins_arg, privilegedAxis));
+  }
+  if (args_info.r_z_given) {
+    analysers.push_back(new GofRZ(info, dumpFileName, sele1, sele2, maxLen, zmaxLen, 
+                                  nrbins, args_info.nbins_z_arg, privilegedAxis));
+  }
+  if (args_info.r_theta_given) {
     if (args_info.sele3_given) 
-      analyser  = new GofRTheta(info, dumpFileName, sele1, sele2, sele3, maxLen,
-                                nrbins, nanglebins);
+      analysers.push_back(new GofRTheta(info, dumpFileName, sele1, sele2, sele3, maxLen,
+                                        nrbins, nanglebins));
     else 
-      analyser  = new GofRTheta(info, dumpFileName, sele1, sele2, maxLen, 
-                                nrbins, nanglebins);
-  } else if (args_info.r_omega_given) {
+      analysers.push_back(new GofRTheta(info, dumpFileName, sele1, sele2, maxLen, 
+                                        nrbins, nanglebins));
+  }
+  if (args_info.r_omega_given) {
     if (args_info.sele3_given) 
-      analyser  = new GofROmega(info, dumpFileName, sele1, sele2, sele3, maxLen,
-                                nrbins, nanglebins);
+      analysers.push_back(new GofROmega(info, dumpFileName, sele1, sele2, sele3, maxLen,
+                                        nrbins, nanglebins));
     else 
-      analyser  = new GofROmega(info, dumpFileName, sele1, sele2, maxLen,
-                                nrbins, nanglebins);
+      analysers.push_back(new GofROmega(info, dumpFileName, sele1, sele2, maxLen,
+                                        nrbins, nanglebins));
 
-  } else if (args_info.theta_omega_given) {
+  }
+  if (args_info.theta_omega_given) {
     if (args_info.sele3_given) 
-      analyser  = new GofAngle2(info, dumpFileName, sele1, sele2, sele3,
-                                nanglebins);
+      analysers.push_back(new GofAngle2(info, dumpFileName, sele1, sele2, sele3,
+                                        nanglebins));
     else
-      analyser  = new GofAngle2(info, dumpFileName, sele1, sele2, 
-                                nanglebins);
-  } else if (args_info.r_theta_omega_given) {
+      analysers.push_back(new GofAngle2(info, dumpFileName, sele1, sele2, 
+                                        nanglebins));
+  }
+  if (args_info.r_theta_omega_given) {
     if (args_info.sele3_given) 
-      analyser  = new GofRAngle2(info, dumpFileName, sele1, sele2, sele3,
-                                 maxLen, nrbins, nanglebins);
+      analysers.push_back(new GofRAngle2(info, dumpFileName, sele1, sele2, sele3,
+                                         maxLen, nrbins, nanglebins));
     else
-      analyser  = new GofRAngle2(info, dumpFileName, sele1, sele2, 
-                                 maxLen, nrbins, nanglebins);
-  } else if (args_info.gxyz_given) {
+      analysers.push_back(new GofRAngle2(info, dumpFileName, sele1, sele2, 
+                                         maxLen, nrbins, nanglebins));
+  }
+  if (args_info.gxyz_given) {
     if (args_info.refsele_given) {
-      analyser= new GofXyz(info, dumpFileName, sele1, sele2,
-                           args_info.refsele_arg, maxLen, args_info.nbins_arg);
+      analysers.push_back(new GofXyz(info, dumpFileName, sele1, sele2,
+                                     args_info.refsele_arg, maxLen, args_info.nbins_arg));
     } else {
       sprintf( painCave.errMsg,
 	       "--refsele must set when --gxyz is used");
@@ -275,10 +283,11 @@ int main(int argc, char* argv[]){
       painCave.isFatal = 1;
       simError();  
     }
-  } else if (args_info.twodgofr_given){
+  }
+  if (args_info.twodgofr_given){
     if (args_info.dz_given) {
-      analyser= new TwoDGofR(info, dumpFileName, sele1, sele2, maxLen, 
-			     args_info.dz_arg, nrbins);        
+      analysers.push_back(new TwoDGofR(info, dumpFileName, sele1, sele2, maxLen, 
+                                       args_info.dz_arg, nrbins));        
     } else {
       sprintf( painCave.errMsg,
 	       "A slab width (dz) must be specified when calculating TwoDGofR");
@@ -286,16 +295,17 @@ int main(int argc, char* argv[]){
       painCave.isFatal = 1;
       simError();
     }    
-  } else if (args_info.p2_given) {
+  }
+  if (args_info.p2_given) {
     if (args_info.sele1_given) {     
       if (args_info.sele2_given) 
-        analyser  = new P2OrderParameter(info, dumpFileName, sele1, sele2);
+        analysers.push_back(new P2OrderParameter(info, dumpFileName, sele1, sele2));
       else 
         if (args_info.seleoffset_given) 
-          analyser  = new P2OrderParameter(info, dumpFileName, sele1, 
-                                           args_info.seleoffset_arg);
+          analysers.push_back(new P2OrderParameter(info, dumpFileName, sele1, 
+                                                   args_info.seleoffset_arg));
         else 
-          analyser  = new P2OrderParameter(info, dumpFileName, sele1);
+          analysers.push_back(new P2OrderParameter(info, dumpFileName, sele1));
     } else {
       sprintf( painCave.errMsg,
 	       "At least one selection script (--sele1) must be specified when calculating P2 order parameters");
@@ -303,13 +313,15 @@ int main(int argc, char* argv[]){
       painCave.isFatal = 1;
       simError();
     }
-  } else if (args_info.rp2_given){
-    analyser = new RippleOP(info, dumpFileName, sele1, sele2);
-  } else if (args_info.bo_given){
+  }
+  if (args_info.rp2_given){
+    analysers.push_back(new RippleOP(info, dumpFileName, sele1, sele2));
+  }
+  if (args_info.bo_given){
     if (args_info.rcut_given) {
-      analyser = new BondOrderParameter(info, dumpFileName, sele1, 
-					args_info.rcut_arg, 
-					args_info.nbins_arg);
+      analysers.push_back(new BondOrderParameter(info, dumpFileName, sele1, 
+                                                 args_info.rcut_arg, 
+                                                 args_info.nbins_arg));
     } else {
       sprintf( painCave.errMsg,
 	       "A cutoff radius (rcut) must be specified when calculating Bond Order Parameters");
@@ -317,15 +329,17 @@ int main(int argc, char* argv[]){
       painCave.isFatal = 1;
       simError();
     }
-  } else if (args_info.multipole_given){
-    analyser = new MultipoleSum(info, dumpFileName, sele1, 
-                                maxLen, args_info.nbins_arg);
+  }
+  if (args_info.multipole_given){
+    analysers.push_back(new MultipoleSum(info, dumpFileName, sele1, 
+                                         maxLen, args_info.nbins_arg));
     
-  } else if (args_info.tet_param_given) {
+  }
+  if (args_info.tet_param_given) {
     if (args_info.rcut_given) {	  
-      analyser = new TetrahedralityParam(info, dumpFileName, sele1, 
-					 args_info.rcut_arg, 
-					 args_info.nbins_arg);
+      analysers.push_back(new TetrahedralityParam(info, dumpFileName, sele1, 
+                                                  args_info.rcut_arg, 
+                                                  args_info.nbins_arg));
     } else {
       sprintf( painCave.errMsg,
 	       "A cutoff radius (rcut) must be specified when calculating Tetrahedrality Parameters");
@@ -334,12 +348,13 @@ int main(int argc, char* argv[]){
       simError();
     }
     
-  } else if (args_info.tet_param_z_given) {
+  }
+  if (args_info.tet_param_z_given) {
     if (args_info.rcut_given) {	  
-      analyser = new TetrahedralityParamZ(info, dumpFileName, sele1, sele2,
-                                          args_info.rcut_arg, 
-                                          args_info.nbins_arg,
-					  privilegedAxis);
+      analysers.push_back(new TetrahedralityParamZ(info, dumpFileName, sele1, sele2,
+                                                   args_info.rcut_arg, 
+                                                   args_info.nbins_arg,
+                                                   privilegedAxis));
     } else {
       sprintf( painCave.errMsg,
 	       "A cutoff radius (rcut) must be specified when calculating Tetrahedrality Parameters");
@@ -348,11 +363,12 @@ int main(int argc, char* argv[]){
       simError();
     }
     
-  } else if (args_info.tet_param_dens_given) {
+  }
+  if (args_info.tet_param_dens_given) {
     if (args_info.rcut_given) {
-      analyser = new TetrahedralityParamDens(info, dumpFileName, sele1, sele2,
-					     args_info.rcut_arg,
-					     args_info.nbins_arg);
+      analysers.push_back(new TetrahedralityParamDens(info, dumpFileName, sele1, sele2,
+                                                      args_info.rcut_arg,
+                                                      args_info.nbins_arg));
     } else {
       sprintf( painCave.errMsg,
                "A cutoff radius (rcut) must be specified when calculating Tetrahedrality Parameters");
@@ -360,14 +376,15 @@ int main(int argc, char* argv[]){
       painCave.isFatal = 1;
       simError();
     }
-  } else if (args_info.tet_hb_given) {
+  }
+  if (args_info.tet_hb_given) {
     if (args_info.rcut_given) {	  
-      analyser = new TetrahedralityHBMatrix(info, dumpFileName, sele1,
-                                            args_info.rcut_arg,
-                                            args_info.OOcut_arg,
-                                            args_info.thetacut_arg,
-                                            args_info.OHcut_arg,
-                                            args_info.nbins_arg);
+      analysers.push_back(new TetrahedralityHBMatrix(info, dumpFileName, sele1,
+                                                     args_info.rcut_arg,
+                                                     args_info.OOcut_arg,
+                                                     args_info.thetacut_arg,
+                                                     args_info.OHcut_arg,
+                                                     args_info.nbins_arg));
     } else {
       sprintf( painCave.errMsg,
 	       "A cutoff radius (rcut) must be specified when calculating "
@@ -376,7 +393,8 @@ int main(int argc, char* argv[]){
       painCave.isFatal = 1;
       simError();
     }
-  } else if (args_info.tet_param_xyz_given) {
+  }
+  if (args_info.tet_param_xyz_given) {
     if (!args_info.rcut_given) {
       sprintf( painCave.errMsg,
 	       "A cutoff radius (rcut) must be specified when calculating"
@@ -401,15 +419,16 @@ int main(int argc, char* argv[]){
       painCave.isFatal = 1;
       simError();
     }
-    analyser = new TetrahedralityParamXYZ(info, dumpFileName, sele1, sele2,
-                                          args_info.rcut_arg, 
-                                          args_info.voxelSize_arg,
-                                          args_info.gaussWidth_arg);
-  } else if (args_info.ior_given){
+    analysers.push_back(new TetrahedralityParamXYZ(info, dumpFileName, sele1, sele2,
+                                                   args_info.rcut_arg, 
+                                                   args_info.voxelSize_arg,
+                                                   args_info.gaussWidth_arg));
+  }
+  if (args_info.ior_given){
     if (args_info.rcut_given) {
-      analyser = new IcosahedralOfR(info, dumpFileName, sele1, 
-                                    args_info.rcut_arg,
-                                    nrbins, maxLen);
+      analysers.push_back(new IcosahedralOfR(info, dumpFileName, sele1, 
+                                             args_info.rcut_arg,
+                                             nrbins, maxLen));
     } else {
       sprintf( painCave.errMsg,
 	       "A cutoff radius (rcut) must be specified when calculating Bond Order Parameters");
@@ -417,10 +436,11 @@ int main(int argc, char* argv[]){
       painCave.isFatal = 1;
       simError();
     }
-  } else if (args_info.for_given){
+  }
+  if (args_info.for_given){
     if (args_info.rcut_given) {
-      analyser = new FCCOfR(info, dumpFileName, sele1, args_info.rcut_arg,
-			    nrbins, maxLen);
+      analysers.push_back(new FCCOfR(info, dumpFileName, sele1, args_info.rcut_arg,
+                                     nrbins, maxLen));
     } else {
       sprintf( painCave.errMsg,
 	       "A cutoff radius (rcut) must be specified when calculating Bond Order Parameters");
@@ -428,11 +448,12 @@ int main(int argc, char* argv[]){
       painCave.isFatal = 1;
       simError();
     }
-  } else if (args_info.bad_given){
+  }
+  if (args_info.bad_given){
     if (args_info.rcut_given) {
-      analyser = new BondAngleDistribution(info, dumpFileName, sele1, 
-                                           args_info.rcut_arg,
-					   args_info.nbins_arg);
+      analysers.push_back(new BondAngleDistribution(info, dumpFileName, sele1, 
+                                                    args_info.rcut_arg,
+                                                    args_info.nbins_arg));
     } else {
       sprintf( painCave.errMsg,
 	       "A cutoff radius (rcut) must be specified when calculating Bond Angle Distributions");
@@ -440,71 +461,81 @@ int main(int argc, char* argv[]){
       painCave.isFatal = 1;
       simError();
     }
-  } else if (args_info.scd_given) {
+  }
+  if (args_info.scd_given) {
     if (batchMode) {
-      analyser  = new SCDOrderParameter(info, dumpFileName, 
-                                        args_info.molname_arg, 
-					args_info.begin_arg, args_info.end_arg);
+      analysers.push_back(new SCDOrderParameter(info, dumpFileName, 
+                                                args_info.molname_arg, 
+                                                args_info.begin_arg, args_info.end_arg));
     } else{
-      analyser  = new SCDOrderParameter(info, dumpFileName, 
-                                        sele1, sele2, sele3);
+      analysers.push_back(new SCDOrderParameter(info, dumpFileName, 
+                                                sele1, sele2, sele3));
     }
-  }else if (args_info.density_given) {
-    analyser= new DensityPlot(info, dumpFileName, sele1, sele2, maxLen,
-			      args_info.nbins_arg);  
-  } else if (args_info.count_given) {
-    analyser = new ObjectCount(info, dumpFileName, sele1 );
-  } else if (args_info.slab_density_given) {
-    analyser = new RhoZ(info, dumpFileName, sele1, args_info.nbins_arg);
-  } else if (args_info.pipe_density_given) {
+  }
+  if (args_info.density_given) {
+    analysers.push_back(new DensityPlot(info, dumpFileName, sele1, sele2, maxLen,
+                                        args_info.nbins_arg));  
+  }
+  if (args_info.count_given) {
+    analysers.push_back(new ObjectCount(info, dumpFileName, sele1 ));
+  }
+  if (args_info.slab_density_given) {
+    analysers.push_back(new RhoZ(info, dumpFileName, sele1, args_info.nbins_arg));
+  }
+  if (args_info.pipe_density_given) {
 
     switch (privilegedAxis) {
     case 0:      
-      analyser = new PipeDensity(info, dumpFileName, sele1,
-                                 args_info.nbins_y_arg, args_info.nbins_z_arg,
-                                 privilegedAxis);
+      analysers.push_back(new PipeDensity(info, dumpFileName, sele1,
+                                          args_info.nbins_y_arg, args_info.nbins_z_arg,
+                                          privilegedAxis));
       break;
     case 1:
-      analyser = new PipeDensity(info, dumpFileName, sele1,
-                                 args_info.nbins_z_arg, args_info.nbins_x_arg,
-                                 privilegedAxis);      
+      analysers.push_back(new PipeDensity(info, dumpFileName, sele1,
+                                          args_info.nbins_z_arg, args_info.nbins_x_arg,
+                                          privilegedAxis));      
       break;
     case 2:
     default:
-      analyser = new PipeDensity(info, dumpFileName, sele1,
-                                 args_info.nbins_x_arg, args_info.nbins_y_arg,
-                                 privilegedAxis);            
+      analysers.push_back(new PipeDensity(info, dumpFileName, sele1,
+                                          args_info.nbins_x_arg, args_info.nbins_y_arg,
+                                          privilegedAxis));            
       break;
     }
-  } else if (args_info.rnemdz_given) {
-    analyser = new RNEMDZ(info, dumpFileName, sele1, args_info.nbins_arg, privilegedAxis);
-  } else if (args_info.rnemdr_given) {
-    analyser = new RNEMDR(info, dumpFileName, sele1, nrbins);
-  } else if (args_info.rnemdrt_given) {
-    analyser = new RNEMDRTheta(info, dumpFileName, sele1, nrbins, nanglebins);
-  } else if (args_info.nitrile_given) {
-    analyser = new NitrileFrequencyMap(info, dumpFileName, sele1,
-                                       args_info.nbins_arg);
-  } else if (args_info.p_angle_given) {
+  }
+  if (args_info.rnemdz_given) {
+    analysers.push_back(new RNEMDZ(info, dumpFileName, sele1, args_info.nbins_arg, privilegedAxis));
+  }
+  if (args_info.rnemdr_given) {
+    analysers.push_back(new RNEMDR(info, dumpFileName, sele1, nrbins));
+  }
+  if (args_info.rnemdrt_given) {
+    analysers.push_back(new RNEMDRTheta(info, dumpFileName, sele1, nrbins, nanglebins));
+  }
+  if (args_info.nitrile_given) {
+    analysers.push_back(new NitrileFrequencyMap(info, dumpFileName, sele1,
+                                                args_info.nbins_arg));
+  }
+  if (args_info.p_angle_given) {
     if (args_info.sele1_given) {     
       if (args_info.sele2_given) 
-        analyser  = new pAngle(info, dumpFileName, sele1, sele2,
-                               args_info.nbins_arg);
+        analysers.push_back(new pAngle(info, dumpFileName, sele1, sele2,
+                                       args_info.nbins_arg));
       else 
         if (args_info.seleoffset_given) {
           if (args_info.seleoffset2_given) {
-            analyser  = new pAngle(info, dumpFileName, sele1, 
-                                   args_info.seleoffset_arg, 
-                                   args_info.seleoffset2_arg, 
-                                   args_info.nbins_arg);
+            analysers.push_back(new pAngle(info, dumpFileName, sele1, 
+                                           args_info.seleoffset_arg, 
+                                           args_info.seleoffset2_arg, 
+                                           args_info.nbins_arg));
           } else {
-            analyser  = new pAngle(info, dumpFileName, sele1, 
-                                   args_info.seleoffset_arg, 
-                                   args_info.nbins_arg);
+            analysers.push_back(new pAngle(info, dumpFileName, sele1, 
+                                           args_info.seleoffset_arg, 
+                                           args_info.nbins_arg));
           }
         } else 
-          analyser  = new pAngle(info, dumpFileName, sele1, 
-                                 args_info.nbins_arg);
+          analysers.push_back(new pAngle(info, dumpFileName, sele1, 
+                                         args_info.nbins_arg));
     } else {
       sprintf( painCave.errMsg,
 	       "At least one selection script (--sele1) must be specified when "
@@ -514,23 +545,27 @@ int main(int argc, char* argv[]){
       simError();
     }
 #if defined(HAVE_FFTW_H) || defined(HAVE_DFFTW_H) || defined(HAVE_FFTW3_H)
-  }else if (args_info.hxy_given) {
-    analyser = new Hxy(info, dumpFileName, sele1, args_info.nbins_x_arg, 
-		       args_info.nbins_y_arg, args_info.nbins_z_arg,
-                       args_info.nbins_arg);
+  }
+  if (args_info.hxy_given) {
+    analysers.push_back(new Hxy(info, dumpFileName, sele1, args_info.nbins_x_arg, 
+                                args_info.nbins_y_arg, args_info.nbins_z_arg,
+                                args_info.nbins_arg));
 #endif
-  }else if(args_info.cn_given || args_info.scn_given || args_info.gcn_given){
+  }
+  if (args_info.cn_given || args_info.scn_given || args_info.gcn_given){
     if (args_info.rcut_given) {
       if (args_info.cn_given) {
-        analyser = new CoordinationNumber(info, dumpFileName, sele1, sele2,
-                                          args_info.rcut_arg,
-                                          args_info.nbins_arg);
-      } else if (args_info.scn_given) {
-        analyser = new SCN(info, dumpFileName, sele1, sele2,
-                           args_info.rcut_arg, args_info.nbins_arg);
-      } else if (args_info.gcn_given) {
-        analyser = new GCN(info, dumpFileName, sele1, sele2,
-                           args_info.rcut_arg, args_info.nbins_arg);
+        analysers.push_back(new CoordinationNumber(info, dumpFileName, sele1, sele2,
+                                                   args_info.rcut_arg,
+                                                   args_info.nbins_arg));
+      }
+      if (args_info.scn_given) {
+        analysers.push_back(new SCN(info, dumpFileName, sele1, sele2,
+                                    args_info.rcut_arg, args_info.nbins_arg));
+      }
+      if (args_info.gcn_given) {
+        analysers.push_back(new GCN(info, dumpFileName, sele1, sele2,
+                                    args_info.rcut_arg, args_info.nbins_arg));
       }
     } else {
       sprintf( painCave.errMsg,
@@ -541,12 +576,13 @@ int main(int argc, char* argv[]){
       simError();
     }
   }
-  else if (args_info.surfDiffusion_given){
-    analyser = new SurfaceDiffusion(info, dumpFileName, sele1, maxLen);
-  }else if (args_info.rho_r_given) {
+  if (args_info.surfDiffusion_given){
+    analysers.push_back(new SurfaceDiffusion(info, dumpFileName, sele1, maxLen));
+  }
+  if (args_info.rho_r_given) {
     if (args_info.radius_given){
-      analyser = new RhoR(info, dumpFileName, sele1, maxLen, nrbins,
-                          args_info.radius_arg);
+      analysers.push_back(new RhoR(info, dumpFileName, sele1, maxLen, nrbins,
+                                   args_info.radius_arg));
     }else{
       sprintf( painCave.errMsg,
 	       "A particle radius (radius) must be specified when calculating Rho(r)");
@@ -554,20 +590,24 @@ int main(int argc, char* argv[]){
       painCave.isFatal = 1;
       simError();
     }
-  } else if (args_info.hullvol_given) {
-    analyser = new NanoVolume(info, dumpFileName, sele1);
-  } else if (args_info.rodlength_given) {
-    analyser = new NanoLength(info, dumpFileName, sele1);
-  } else if (args_info.angle_r_given) {
-    analyser = new AngleR(info, dumpFileName, sele1, maxLen, nrbins);
-  } else if (args_info.hbond_given){
+  }
+  if (args_info.hullvol_given) {
+    analysers.push_back(new NanoVolume(info, dumpFileName, sele1));
+  }
+  if (args_info.rodlength_given) {
+    analysers.push_back(new NanoLength(info, dumpFileName, sele1));
+  }
+  if (args_info.angle_r_given) {
+    analysers.push_back(new AngleR(info, dumpFileName, sele1, maxLen, nrbins));
+  }
+  if (args_info.hbond_given){
     if (args_info.rcut_given) {
       if (args_info.thetacut_given) {
         
-        analyser = new HBondGeometric(info, dumpFileName, sele1, sele2,
-                                      args_info.rcut_arg,
-                                      args_info.thetacut_arg,
-                                      args_info.nbins_arg);
+        analysers.push_back(new HBondGeometric(info, dumpFileName, sele1, sele2,
+                                               args_info.rcut_arg,
+                                               args_info.thetacut_arg,
+                                               args_info.nbins_arg));
       } else {
         sprintf( painCave.errMsg,
                  "A cutoff angle (thetacut) must be specified when calculating Hydrogen Bonding Statistics");
@@ -582,30 +622,84 @@ int main(int argc, char* argv[]){
       painCave.isFatal = 1;
       simError();
     }
-  } else if (args_info.potDiff_given) {
-    analyser = new PotDiff(info, dumpFileName, sele1);
-  } else if (args_info.kirkwood_given) {
-    analyser= new Kirkwood(info, dumpFileName, sele1, sele2, maxLen, 
-                           nrbins);
-  } else if (args_info.kirkwoodQ_given) {
-    analyser= new KirkwoodQuadrupoles(info, dumpFileName, sele1, sele2, maxLen, 
-                                      nrbins);
-  } else if (args_info.densityfield_given) {
-    analyser = new DensityField(info, dumpFileName, sele1, args_info.voxelSize_arg);
-  } else if (args_info.velocityfield_given) {
-    analyser = new VelocityField(info, dumpFileName, sele1, args_info.voxelSize_arg);
+  }
+  if (args_info.potDiff_given) {
+    analysers.push_back(new PotDiff(info, dumpFileName, sele1));
+  }
+  if (args_info.kirkwood_given) {
+    analysers.push_back(new Kirkwood(info, dumpFileName, sele1, sele2, maxLen, 
+                                     nrbins));
+  }
+  if (args_info.kirkwoodQ_given) {
+    analysers.push_back(new KirkwoodQuadrupoles(info, dumpFileName, sele1, sele2, maxLen, 
+                                                nrbins));
+  }
+  if (args_info.densityfield_given) {
+    analysers.push_back(new DensityField(info, dumpFileName, sele1, args_info.voxelSize_arg));
+  }
+  if (args_info.velocityfield_given) {
+    analysers.push_back(new VelocityField(info, dumpFileName, sele1, args_info.voxelSize_arg));
+  }
+
+  if (analysers.empty()) {
+    sprintf( painCave.errMsg,
+             "StaticProps: at least one analysis option (e.g. --gofr) is\n"
+             "\trequired.  Run StaticProps --help for the full list.\n");
+    painCave.severity = OPENMD_ERROR;
+    painCave.isFatal = 1;
+    simError();
   }
 
   if (args_info.output_given) {
-    analyser->setOutputName(args_info.output_arg);
+    if (analysers.size() == 1) {
+      analysers[0]->setOutputName(args_info.output_arg);
+    } else {
+      sprintf( painCave.errMsg,
+               "--output is ignored when more than one analysis is requested;\n"
+               "\teach analysis writes to its default file name.\n");
+      painCave.severity = OPENMD_WARNING;
+      painCave.isFatal = 0;
+      simError();
+    }
   }
   if (args_info.step_given) {
-    analyser->setStep(args_info.step_arg);
+    for (unsigned int i = 0; i < analysers.size(); i++) 
+      analysers[i]->setStep(args_info.step_arg);
+  }
+
+  // Analysers that work frame by frame share a single pass through
+  // the dump file, so each frame is read (and its rigid bodies are
+  // updated) only once.  The others run their own passes.
+  std::vector<StaticAnalyser*> frameWise;
+  for (unsigned int i = 0; i < analysers.size(); i++) {
+    if (analysers[i]->isFrameWise())
+      frameWise.push_back(analysers[i]);
+    else
+      analysers[i]->process();
+  }
+
+  if (frameWise.size() == 1) {
+    frameWise[0]->process();
+  } else if (frameWise.size() > 1) {
+    DumpReader reader(info, dumpFileName);
+    int nFrames = reader.getNFrames();
+    int step = frameWise[0]->getStep();
+
+    for (unsigned int i = 0; i < frameWise.size(); i++) 
+      frameWise[i]->beginFrames(nFrames);
+
+    for (int frame = 0; frame < nFrames; frame += step) {
+      reader.readFrame(frame);
+      for (unsigned int i = 0; i < frameWise.size(); i++) 
+        frameWise[i]->processFrame(frame);
+    }
+
+    for (unsigned int i = 0; i < frameWise.size(); i++) 
+      frameWise[i]->endFrames();
   }
   
-  analyser->process();
-  
-  delete analyser;    
+  for (unsigned int i = 0; i < analysers.size(); i++) 
+    delete analysers[i];
   delete info;
   
   return 0;   
@@ -66,7 +66,6 @@ const char *gengetopt_args_info_help[] = {
   "  -v, --voxelSize=DOUBLE        voxel size (angstroms)",
   "      --gaussWidth=DOUBLE       Gaussian width (angstroms)",
   "      --privilegedAxis=ENUM     which axis is special for spatial analysis\n                                  (default = z axis)  (possible values=\"x\",\n                                  \"y\", \"z\" default=`z')",
-  "\n Group: staticProps\n   an option of this group is required",
   "      --bo                      bond order parameter (--rcut must be specified)",
   "      --ior                     icosahedral bond order parameter as a function\n                                  of radius (--rcut must be specified)",
   "      --for                     FCC bond order parameter as a function of\n                                  radius (--rcut must be specified)",
@@ -246,7 +245,6 @@ void clear_given (struct gengetopt_args_info *args_info)
   args_info->kirkwoodQ_given = 0 ;
   args_info->densityfield_given = 0 ;
   args_info->velocityfield_given = 0 ;
-  args_info->staticProps_group_counter = 0 ;
 }
 
 static
@@ -345,52 +343,52 @@ void init_args_info(struct gengetopt_args_info *args_info)
   args_info->voxelSize_help = gengetopt_args_info_help[30] ;
   args_info->gaussWidth_help = gengetopt_args_info_help[31] ;
   args_info->privilegedAxis_help = gengetopt_args_info_help[32] ;
-  args_info->bo_help = gengetopt_args_info_help[34] ;
-  args_info->ior_help = gengetopt_args_info_help[35] ;
-  args_info->for_help = gengetopt_args_info_help[36] ;
-  args_info->bad_help = gengetopt_args_info_help[37] ;
-  args_info->count_help = gengetopt_args_info_help[38] ;
-  args_info->gofr_help = gengetopt_args_info_help[39] ;
-  args_info->gofz_help = gengetopt_args_info_help[40] ;
-  args_info->r_theta_help = gengetopt_args_info_help[41] ;
-  args_info->r_omega_help = gengetopt_args_info_help[42] ;
-  args_info->r_z_help = gengetopt_args_info_help[43] ;
-  args_info->theta_omega_help = gengetopt_args_info_help[44] ;
-  args_info->r_theta_omega_help = gengetopt_args_info_help[45] ;
-  args_info->gxyz_help = gengetopt_args_info_help[46] ;
-  args_info->twodgofr_help = gengetopt_args_info_help[47] ;
-  args_info->p2_help = gengetopt_args_info_help[48] ;
-  args_info->rp2_help = gengetopt_args_info_help[49] ;
-  args_info->scd_help = gengetopt_args_info_help[50] ;
-  args_info->density_help = gengetopt_args_info_help[51] ;
-  args_info->slab_density_help = gengetopt_args_info_help[52] ;
-  args_info->pipe_density_help = gengetopt_args_info_help[53] ;
-  args_info->p_angle_help = gengetopt_args_info_help[54] ;
-  args_info->hxy_help = gengetopt_args_info_help[55] ;
-  args_info->rho_r_help = gengetopt_args_info_help[56] ;
-  args_info->angle_r_help = gengetopt_args_info_help[57] ;
-  args_info->hullvol_help = gengetopt_args_info_help[58] ;
-  args_info->rodlength_help = gengetopt_args_info_help[59] ;
-  args_info->tet_param_help = gengetopt_args_info_help[60] ;
-  args_info->tet_param_z_help = gengetopt_args_info_help[61] ;
-  args_info->tet_param_dens_help = gengetopt_args_info_help[62] ;
-  args_info->tet_param_xyz_help = gengetopt_args_info_help[63] ;
-  args_info->rnemdz_help = gengetopt_args_info_help[64] ;
-  args_info->rnemdr_help = gengetopt_args_info_help[65] ;
-  args_info->rnemdrt_help = gengetopt_args_info_help[66] ;
-  args_info->nitrile_help = gengetopt_args_info_help[67] ;
-  args_info->multipole_help = gengetopt_args_info_help[68] ;
-  args_info->surfDiffusion_help = gengetopt_args_info_help[69] ;
-  args_info->cn_help = gengetopt_args_info_help[70] ;
-  args_info->scn_help = gengetopt_args_info_help[71] ;
-  args_info->gcn_help = gengetopt_args_info_help[72] ;
-  args_info->hbond_help = gengetopt_args_info_help[73] ;
-  args_info->potDiff_help = gengetopt_args_info_help[74] ;
-  args_info->tet_hb_help = gengetopt_args_info_help[75] ;
-  args_info->kirkwood_help = gengetopt_args_info_help[76] ;
-  args_info->kirkwoodQ_help = gengetopt_args_info_help[77] ;
-  args_info->densityfield_help = gengetopt_args_info_help[78] ;
-  args_info->velocityfield_help = gengetopt_args_info_help[79] ;
+  args_info->bo_help = gengetopt_args_info_help[33] ;
+  args_info->ior_help = gengetopt_args_info_help[34] ;
+  args_info->for_help = gengetopt_args_info_help[35] ;
+  args_info->bad_help = gengetopt_args_info_help[36] ;
+  args_info->count_help = gengetopt_args_info_help[37] ;
+  args_info->gofr_help = gengetopt_args_info_help[38] ;
+  args_info->gofz_help = gengetopt_args_info_help[39] ;
+  args_info->r_theta_help = gengetopt_args_info_help[40] ;
+  args_info->r_omega_help = gengetopt_args_info_help[41] ;
+  args_info->r_z_help = gengetopt_args_info_help[42] ;
+  args_info->theta_omega_help = gengetopt_args_info_help[43] ;
+  args_info->r_theta_omega_help = gengetopt_args_info_help[44] ;
+  args_info->gxyz_help = gengetopt_args_info_help[45] ;
+  args_info->twodgofr_help = gengetopt_args_info_help[46] ;
+  args_info->p2_help = gengetopt_args_info_help[47] ;
+  args_info->rp2_help = gengetopt_args_info_help[48] ;
+  args_info->scd_help = gengetopt_args_info_help[49] ;
+  args_info->density_help = gengetopt_args_info_help[50] ;
+  args_info->slab_density_help = gengetopt_args_info_help[51] ;
+  args_info->pipe_density_help = gengetopt_args_info_help[52] ;
+  args_info->p_angle_help = gengetopt_args_info_help[53] ;
+  args_info->hxy_help = gengetopt_args_info_help[54] ;
+  args_info->rho_r_help = gengetopt_args_info_help[55] ;
+  args_info->angle_r_help = gengetopt_args_info_help[56] ;
+  args_info->hullvol_help = gengetopt_args_info_help[57] ;
+  args_info->rodlength_help = gengetopt_args_info_help[58] ;
+  args_info->tet_param_help = gengetopt_args_info_help[59] ;
+  args_info->tet_param_z_help = gengetopt_args_info_help[60] ;
+  args_info->tet_param_dens_help = gengetopt_args_info_help[61] ;
+  args_info->tet_param_xyz_help = gengetopt_args_info_help[62] ;
+  args_info->rnemdz_help = gengetopt_args_info_help[63] ;
+  args_info->rnemdr_help = gengetopt_args_info_help[64] ;
+  args_info->rnemdrt_help = gengetopt_args_info_help[65] ;
+  args_info->nitrile_help = gengetopt_args_info_help[66] ;
+  args_info->multipole_help = gengetopt_args_info_help[67] ;
+  args_info->surfDiffusion_help = gengetopt_args_info_help[68] ;
+  args_info->cn_help = gengetopt_args_info_help[69] ;
+  args_info->scn_help = gengetopt_args_info_help[70] ;
+  args_info->gcn_help = gengetopt_args_info_help[71] ;
+  args_info->hbond_help = gengetopt_args_info_help[72] ;
+  args_info->potDiff_help = gengetopt_args_info_help[73] ;
+  args_info->tet_hb_help = gengetopt_args_info_help[74] ;
+  args_info->kirkwood_help = gengetopt_args_info_help[75] ;
+  args_info->kirkwoodQ_help = gengetopt_args_info_help[76] ;
+  args_info->densityfield_help = gengetopt_args_info_help[77] ;
+  args_info->velocityfield_help = gengetopt_args_info_help[78] ;
   
 }
 
@@ -797,62 +795,6 @@ gengetopt_strdup (const char *s)
   return result;
 }
 
-static void
-reset_group_staticProps(struct gengetopt_args_info *args_info)
-{
-  if (! args_info->staticProps_group_counter)
-    return;
-  
-  args_info->bo_given = 0 ;
-  args_info->ior_given = 0 ;
-  args_info->for_given = 0 ;
-  args_info->bad_given = 0 ;
-  args_info->count_given = 0 ;
-  args_info->gofr_given = 0 ;
-  args_info->gofz_given = 0 ;
-  args_info->r_theta_given = 0 ;
-  args_info->r_omega_given = 0 ;
-  args_info->r_z_given = 0 ;
-  args_info->theta_omega_given = 0 ;
-  args_info->r_theta_omega_given = 0 ;
-  args_info->gxyz_given = 0 ;
-  args_info->twodgofr_given = 0 ;
-  args_info->p2_given = 0 ;
-  args_info->rp2_given = 0 ;
-  args_info->scd_given = 0 ;
-  args_info->density_given = 0 ;
-  args_info->slab_density_given = 0 ;
-  args_info->pipe_density_given = 0 ;
-  args_info->p_angle_given = 0 ;
-  args_info->hxy_given = 0 ;
-  args_info->rho_r_given = 0 ;
-  args_info->angle_r_given = 0 ;
-  args_info->hullvol_given = 0 ;
-  args_info->rodlength_given = 0 ;
-  args_info->tet_param_given = 0 ;
-  args_info->tet_param_z_given = 0 ;
-  args_info->tet_param_dens_given = 0 ;
-  args_info->tet_param_xyz_given = 0 ;
-  args_info->rnemdz_given = 0 ;
-  args_info->rnemdr_given = 0 ;
-  args_info->rnemdrt_given = 0 ;
-  args_info->nitrile_given = 0 ;
-  args_info->multipole_given = 0 ;
-  args_info->surfDiffusion_given = 0 ;
-  args_info->cn_given = 0 ;
-  args_info->scn_given = 0 ;
-  args_info->gcn_given = 0 ;
-  args_info->hbond_given = 0 ;
-  args_info->potDiff_given = 0 ;
-  args_info->tet_hb_given = 0 ;
-  args_info->kirkwood_given = 0 ;
-  args_info->kirkwoodQ_given = 0 ;
-  args_info->densityfield_given = 0 ;
-  args_info->velocityfield_given = 0 ;
-
-  args_info->staticProps_group_counter = 0;
-}
-
 int
 cmdline_parser (int argc, char **argv, struct gengetopt_args_info *args_info)
 {
@@ -910,12 +852,6 @@ cmdline_parser_required2 (struct gengetopt_args_info *args_info, const char *pro
       error_occurred = 1;
     }
   
-  if (args_info->staticProps_group_counter == 0)
-    {
-      fprintf (stderr, "%s: %d options of group staticProps were given. One is required%s.\n", prog_name, args_info->staticProps_group_counter, (additional_error ? additional_error : ""));
-      error_occurred = 1;
-    }
-  
 
   /* checks for dependences among options */
 
@@ -1929,9 +1865,6 @@ cmdline_parser_internal (
           break;
         case 'g':	/* g(r).  */
         
-          if (args_info->staticProps_group_counter && override)
-            reset_group_staticProps (args_info);
-          args_info->staticProps_group_counter += 1;
         
           if (update_arg( 0 , 
                0 , &(args_info->gofr_given),
@@ -1944,9 +1877,6 @@ cmdline_parser_internal (
           break;
         case 'p':	/* p2 order parameter (--sele1 must be specified, --sele2 is optional).  */
         
-          if (args_info->staticProps_group_counter && override)
-            reset_group_staticProps (args_info);
-          args_info->staticProps_group_counter += 1;
         
           if (update_arg( 0 , 
                0 , &(args_info->p2_given),
@@ -1959,9 +1889,6 @@ cmdline_parser_internal (
           break;
         case 's':	/* scd order parameter (either --sele1, --sele2, --sele3 are specified or --molname, --begin, --end are specified).  */
         
-          if (args_info->staticProps_group_counter && override)
-            reset_group_staticProps (args_info);
-          args_info->staticProps_group_counter += 1;
         
           if (update_arg( 0 , 
                0 , &(args_info->scd_given),
@@ -1974,9 +1901,6 @@ cmdline_parser_internal (
           break;
         case 'd':	/* density plot.  */
         
-          if (args_info->staticProps_group_counter && override)
-            reset_group_staticProps (args_info);
-          args_info->staticProps_group_counter += 1;
         
           if (update_arg( 0 , 
                0 , &(args_info->density_given),
@@ -1989,9 +1913,6 @@ cmdline_parser_internal (
           break;
         case 'Q':	/* tetrahedrality order parameter (Qk).  */
         
-          if (args_info->staticProps_group_counter && override)
-            reset_group_staticProps (args_info);
-          args_info->staticProps_group_counter += 1;
         
           if (update_arg( 0 , 
                0 , &(args_info->tet_param_given),
@@ -2004,9 +1925,6 @@ cmdline_parser_internal (
           break;
         case 'm':	/* average multipole moments contained within cutoff spheres as a function of radius.  */
         
-          if (args_info->staticProps_group_counter && override)
-            reset_group_staticProps (args_info);
-          args_info->staticProps_group_counter += 1;
         
           if (update_arg( 0 , 
                0 , &(args_info->multipole_given),
@@ -2019,9 +1937,6 @@ cmdline_parser_internal (
           break;
         case 'k':	/* distance-dependent Kirkwood factor.  */
         
-          if (args_info->staticProps_group_counter && override)
-            reset_group_staticProps (args_info);
-          args_info->staticProps_group_counter += 1;
         
           if (update_arg( 0 , 
                0 , &(args_info->kirkwood_given),
@@ -2318,9 +2233,6 @@ cmdline_parser_internal (
           else if (strcmp (long_options[option_index].name, "bo") == 0)
           {
           
-            if (args_info->staticProps_group_counter && override)
-              reset_group_staticProps (args_info);
-            args_info->staticProps_group_counter += 1;
           
             if (update_arg( 0 , 
                  0 , &(args_info->bo_given),
@@ -2335,9 +2247,6 @@ cmdline_parser_internal (
           else if (strcmp (long_options[option_index].name, "ior") == 0)
           {
           
-            if (args_info->staticProps_group_counter && override)
-              reset_group_staticProps (args_info);
-            args_info->staticProps_group_counter += 1;
           
             if (update_arg( 0 , 
                  0 , &(args_info->ior_given),
@@ -2352,9 +2261,6 @@ cmdline_parser_internal (
           else if (strcmp (long_options[option_index].name, "for") == 0)
           {
           
-            if (args_info->staticProps_group_counter && override)
-              reset_group_staticProps (args_info);
-            args_info->staticProps_group_counter += 1;
           
             if (update_arg( 0 , 
                  0 , &(args_info->for_given),
@@ -2369,9 +2275,6 @@ cmdline_parser_internal (
           else if (strcmp (long_options[option_index].name, "bad") == 0)
           {
           
-            if (args_info->staticProps_group_counter && override)
-              reset_group_staticProps (args_info);
-            args_info->staticProps_group_counter += 1;
           
             if (update_arg( 0 , 
                  0 , &(args_info->bad_given),
@@ -2386,9 +2289,6 @@ cmdline_parser_internal (
           else if (strcmp (long_options[option_index].name, "count") == 0)
           {
           
-            if (args_info->staticProps_group_counter && override)
-              reset_group_staticProps (args_info);
-            args_info->staticProps_group_counter += 1;
           
             if (update_arg( 0 , 
                  0 , &(args_info->count_given),
@@ -2403,9 +2303,6 @@ cmdline_parser_internal (
           else if (strcmp (long_options[option_index].name, "gofz") == 0)
           {
           
-            if (args_info->staticProps_group_counter && override)
-              reset_group_staticProps (args_info);
-            args_info->staticProps_group_counter += 1;
           
             if (update_arg( 0 , 
                  0 , &(args_info->gofz_given),
@@ -2420,9 +2317,6 @@ cmdline_parser_internal (
           else if (strcmp (long_options[option_index].name, "r_theta") == 0)
           {
           
-            if (args_info->staticProps_group_counter && override)
-              reset_group_staticProps (args_info);
-            args_info->staticProps_group_counter += 1;
           
             if (update_arg( 0 , 
                  0 , &(args_info->r_theta_given),
@@ -2437,9 +2331,6 @@ cmdline_parser_internal (
           else if (strcmp (long_options[option_index].name, "r_omega") == 0)
           {
           
-            if (args_info->staticProps_group_counter && override)
-              reset_group_staticProps (args_info);
-            args_info->staticProps_group_counter += 1;
           
             if (update_arg( 0 , 
                  0 , &(args_info->r_omega_given),
@@ -2454,9 +2345,6 @@ cmdline_parser_internal (
           else if (strcmp (long_options[option_index].name, "r_z") == 0)
           {
           
-            if (args_info->staticProps_group_counter && override)
-              reset_group_staticProps (args_info);
-            args_info->staticProps_group_counter += 1;
           
             if (update_arg( 0 , 
                  0 , &(args_info->r_z_given),
@@ -2471,9 +2359,6 @@ cmdline_parser_internal (
           else if (strcmp (long_options[option_index].name, "theta_omega") == 0)
           {
           
-            if (args_info->staticProps_group_counter && override)
-              reset_group_staticProps (args_info);
-            args_info->staticProps_group_counter += 1;
           
             if (update_arg( 0 , 
                  0 , &(args_info->theta_omega_given),
@@ -2488,9 +2373,6 @@ cmdline_parser_internal (
           else if (strcmp (long_options[option_index].name, "r_theta_omega") == 0)
           {
           
-            if (args_info->staticProps_group_counter && override)
-              reset_group_staticProps (args_info);
-            args_info->staticProps_group_counter += 1;
           
             if (update_arg( 0 , 
                  0 , &(args_info->r_theta_omega_given),
@@ -2505,9 +2387,6 @@ cmdline_parser_internal (
           else if (strcmp (long_options[option_index].name, "gxyz") == 0)
           {
           
-            if (args_info->staticProps_group_counter && override)
-              reset_group_staticProps (args_info);
-            args_info->staticProps_group_counter += 1;
           
             if (update_arg( 0 , 
                  0 , &(args_info->gxyz_given),
@@ -2522,9 +2401,6 @@ cmdline_parser_internal (
           else if (strcmp (long_options[option_index].name, "twodgofr") == 0)
           {
           
-            if (args_info->staticProps_group_counter && override)
-              reset_group_staticProps (args_info);
-            args_info->staticProps_group_counter += 1;
           
             if (update_arg( 0 , 
                  0 , &(args_info->twodgofr_given),
@@ -2539,9 +2415,6 @@ cmdline_parser_internal (
           else if (strcmp (long_options[option_index].name, "rp2") == 0)
           {
           
-            if (args_info->staticProps_group_counter && override)
-              reset_group_staticProps (args_info);
-            args_info->staticProps_group_counter += 1;
           
             if (update_arg( 0 , 
                  0 , &(args_info->rp2_given),
@@ -2556,9 +2429,6 @@ cmdline_parser_internal (
           else if (strcmp (long_options[option_index].name, "slab_density") == 0)
           {
           
-            if (args_info->staticProps_group_counter && override)
-              reset_group_staticProps (args_info);
-            args_info->staticProps_group_counter += 1;
           
             if (update_arg( 0 , 
                  0 , &(args_info->slab_density_given),
@@ -2573,9 +2443,6 @@ cmdline_parser_internal (
           else if (strcmp (long_options[option_index].name, "pipe_density") == 0)
           {
           
-            if (args_info->staticProps_group_counter && override)
-              reset_group_staticProps (args_info);
-            args_info->staticProps_group_counter += 1;
           
             if (update_arg( 0 , 
                  0 , &(args_info->pipe_density_given),
@@ -2590,9 +2457,6 @@ cmdline_parser_internal (
           else if (strcmp (long_options[option_index].name, "p_angle") == 0)
           {
           
-            if (args_info->staticProps_group_counter && override)
-              reset_group_staticProps (args_info);
-            args_info->staticProps_group_counter += 1;
           
             if (update_arg( 0 , 
                  0 , &(args_info->p_angle_given),
@@ -2607,9 +2471,6 @@ cmdline_parser_internal (
           else if (strcmp (long_options[option_index].name, "hxy") == 0)
           {
           
-            if (args_info->staticProps_group_counter && override)
-              reset_group_staticProps (args_info);
-            args_info->staticProps_group_counter += 1;
           
             if (update_arg( 0 , 
                  0 , &(args_info->hxy_given),
@@ -2624,9 +2485,6 @@ cmdline_parser_internal (
           else if (strcmp (long_options[option_index].name, "rho_r") == 0)
           {
           
-            if (args_info->staticProps_group_counter && override)
-              reset_group_staticProps (args_info);
-            args_info->staticProps_group_counter += 1;
           
             if (update_arg( 0 , 
                  0 , &(args_info->rho_r_given),
@@ -2641,9 +2499,6 @@ cmdline_parser_internal (
           else if (strcmp (long_options[option_index].name, "angle_r") == 0)
           {
           
-            if (args_info->staticProps_group_counter && override)
-              reset_group_staticProps (args_info);
-            args_info->staticProps_group_counter += 1;
           
             if (update_arg( 0 , 
                  0 , &(args_info->angle_r_given),
@@ -2658,9 +2513,6 @@ cmdline_parser_internal (
           else if (strcmp (long_options[option_index].name, "hullvol") == 0)
           {
           
-            if (args_info->staticProps_group_counter && override)
-              reset_group_staticProps (args_info);
-            args_info->staticProps_group_counter += 1;
           
             if (update_arg( 0 , 
                  0 , &(args_info->hullvol_given),
@@ -2675,9 +2527,6 @@ cmdline_parser_internal (
           else if (strcmp (long_options[option_index].name, "rodlength") == 0)
           {
           
-            if (args_info->staticProps_group_counter && override)
-              reset_group_staticProps (args_info);
-            args_info->staticProps_group_counter += 1;
           
             if (update_arg( 0 , 
                  0 , &(args_info->rodlength_given),
@@ -2692,9 +2541,6 @@ cmdline_parser_internal (
           else if (strcmp (long_options[option_index].name, "tet_param_z") == 0)
           {
           
-            if (args_info->staticProps_group_counter && override)
-              reset_group_staticProps (args_info);
-            args_info->staticProps_group_counter += 1;
           
             if (update_arg( 0 , 
                  0 , &(args_info->tet_param_z_given),
@@ -2709,9 +2555,6 @@ cmdline_parser_internal (
           else if (strcmp (long_options[option_index].name, "tet_param_dens") == 0)
           {
           
-            if (args_info->staticProps_group_counter && override)
-              reset_group_staticProps (args_info);
-            args_info->staticProps_group_counter += 1;
           
             if (update_arg( 0 , 
                  0 , &(args_info->tet_param_dens_given),
@@ -2726,9 +2569,6 @@ cmdline_parser_internal (
           else if (strcmp (long_options[option_index].name, "tet_param_xyz") == 0)
           {
           
-            if (args_info->staticProps_group_counter && override)
-              reset_group_staticProps (args_info);
-            args_info->staticProps_group_counter += 1;
           
             if (update_arg( 0 , 
                  0 , &(args_info->tet_param_xyz_given),
@@ -2743,9 +2583,6 @@ cmdline_parser_internal (
           else if (strcmp (long_options[option_index].name, "rnemdz") == 0)
           {
           
-            if (args_info->staticProps_group_counter && override)
-              reset_group_staticProps (args_info);
-            args_info->staticProps_group_counter += 1;
           
             if (update_arg( 0 , 
                  0 , &(args_info->rnemdz_given),
@@ -2760,9 +2597,6 @@ cmdline_parser_internal (
           else if (strcmp (long_options[option_index].name, "rnemdr") == 0)
           {
           
-            if (args_info->staticProps_group_counter && override)
-              reset_group_staticProps (args_info);
-            args_info->staticProps_group_counter += 1;
           
             if (update_arg( 0 , 
                  0 , &(args_info->rnemdr_given),
@@ -2777,9 +2611,6 @@ cmdline_parser_internal (
           else if (strcmp (long_options[option_index].name, "rnemdrt") == 0)
           {
           
-            if (args_info->staticProps_group_counter && override)
-              reset_group_staticProps (args_info);
-            args_info->staticProps_group_counter += 1;
           
             if (update_arg( 0 , 
                  0 , &(args_info->rnemdrt_given),
@@ -2794,9 +2625,6 @@ cmdline_parser_internal (
           else if (strcmp (long_options[option_index].name, "nitrile") == 0)
           {
           
-            if (args_info->staticProps_group_counter && override)
-              reset_group_staticProps (args_info);
-            args_info->staticProps_group_counter += 1;
           
             if (update_arg( 0 , 
                  0 , &(args_info->nitrile_given),
@@ -2811,9 +2639,6 @@ cmdline_parser_internal (
           else if (strcmp (long_options[option_index].name, "surfDiffusion") == 0)
           {
           
-            if (args_info->staticProps_group_counter && override)
-              reset_group_staticProps (args_info);
-            args_info->staticProps_group_counter += 1;
           
             if (update_arg( 0 , 
                  0 , &(args_info->surfDiffusion_given),
@@ -2828,9 +2653,6 @@ cmdline_parser_internal (
           else if (strcmp (long_options[option_index].name, "cn") == 0)
           {
           
-            if (args_info->staticProps_group_counter && override)
-              reset_group_staticProps (args_info);
-            args_info->staticProps_group_counter += 1;
           
             if (update_arg( 0 , 
                  0 , &(args_info->cn_given),
@@ -2845,9 +2667,6 @@ cmdline_parser_internal (
           else if (strcmp (long_options[option_index].name, "scn") == 0)
           {
           
-            if (args_info->staticProps_group_counter && override)
-              reset_group_staticProps (args_info);
-            args_info->staticProps_group_counter += 1;
           
             if (update_arg( 0 , 
                  0 , &(args_info->scn_given),
@@ -2862,9 +2681,6 @@ cmdline_parser_internal (
           else if (strcmp (long_options[option_index].name, "gcn") == 0)
           {
           
-            if (args_info->staticProps_group_counter && override)
-              reset_group_staticProps (args_info);
-            args_info->staticProps_group_counter += 1;
           
             if (update_arg( 0 , 
                  0 , &(args_info->gcn_given),
@@ -2879,9 +2695,6 @@ cmdline_parser_internal (
           else if (strcmp (long_options[option_index].name, "hbond") == 0)
           {
           
-            if (args_info->staticProps_group_counter && override)
-              reset_group_staticProps (args_info);
-            args_info->staticProps_group_counter += 1;
           
             if (update_arg( 0 , 
                  0 , &(args_info->hbond_given),
@@ -2896,9 +2709,6 @@ cmdline_parser_internal (
           else if (strcmp (long_options[option_index].name, "potDiff") == 0)
           {
           
-            if (args_info->staticProps_group_counter && override)
-              reset_group_staticProps (args_info);
-            args_info->staticProps_group_counter += 1;
           
             if (update_arg( 0 , 
                  0 , &(args_info->potDiff_given),
@@ -2913,9 +2723,6 @@ cmdline_parser_internal (
           else if (strcmp (long_options[option_index].name, "tet_hb") == 0)
           {
           
-            if (args_info->staticProps_group_counter && override)
-              reset_group_staticProps (args_info);
-            args_info->staticProps_group_counter += 1;
           
             if (update_arg( 0 , 
                  0 , &(args_info->tet_hb_given),
@@ -2930,9 +2737,6 @@ cmdline_parser_internal (
           else if (strcmp (long_options[option_index].name, "kirkwoodQ") == 0)
           {
           
-            if (args_info->staticProps_group_counter && override)
-              reset_group_staticProps (args_info);
-            args_info->staticProps_group_counter += 1;
           
             if (update_arg( 0 , 
                  0 , &(args_info->kirkwoodQ_given),
@@ -2947,9 +2751,6 @@ cmdline_parser_internal (
           else if (strcmp (long_options[option_index].name, "densityfield") == 0)
           {
           
-            if (args_info->staticProps_group_counter && override)
-              reset_group_staticProps (args_info);
-            args_info->staticProps_group_counter += 1;
           
             if (update_arg( 0 , 
                  0 , &(args_info->densityfield_given),
@@ -2964,9 +2765,6 @@ cmdline_parser_internal (
           else if (strcmp (long_options[option_index].name, "velocityfield") == 0)
           {
           
-            if (args_info->staticProps_group_counter && override)
-              reset_group_staticProps (args_info);
-            args_info->staticProps_group_counter += 1;
           
             if (update_arg( 0 , 
                  0 , &(args_info->velocityfield_given),
@@ -2989,12 +2787,6 @@ cmdline_parser_internal (
         } /* switch */
     } /* while */
 
-  if (args_info->staticProps_group_counter > 1)
-    {
-      fprintf (stderr, "%s: %d options of group staticProps were given. One is required%s.\n", argv[0], args_info->staticProps_group_counter, (additional_error ? additional_error : ""));
-      error_occurred = 1;
-    }
-  
 
 
   if (check_required)
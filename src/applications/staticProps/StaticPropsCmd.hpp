@@ -263,7 +263,6 @@ struct gengetopt_args_info
 
   char **inputs ; /**< @brief unamed options (options without names) */
   unsigned inputs_num ; /**< @brief unamed options number */
-  int staticProps_group_counter; /**< @brief Counter for group staticProps */
 } ;
 
 /** @brief The additional parameters to pass to parser functions */
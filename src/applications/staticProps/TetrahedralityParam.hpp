@@ -86,7 +86,10 @@ namespace OpenMD {
 			const std::string& sele, double rCut, int nbins);
     
     virtual ~TetrahedralityParam();
-    virtual void process();
+    virtual bool isFrameWise() { return true; }
+    virtual void beginFrames(int nFrames);
+    virtual void processFrame(int frame);
+    virtual void endFrames();
     
   private:
     virtual void initializeHistogram();
@@ -53,10 +53,11 @@ namespace OpenMD {
 					     int storageLayout,
                                              long long int memSize,
                                              int blockCapacity) 
-    : SnapshotManager(storageLayout), info_(info), 
-      blockCapacity_(blockCapacity), memSize_(memSize), 
-      activeBlocks_(blockCapacity_, -1), 
-      activeRefCount_(blockCapacity_, 0) {
+    : SnapshotManager(storageLayout), info_(info), filename_(filename),
+      memSize_(memSize), useClock_(0), prefetchRunning_(false),
+      stopPrefetch_(false), requestedBlock_(-1), readingBlock_(-1),
+      prefetchedBlock_(-1), nHits_(0), nPrefetchHits_(0), nMisses_(0),
+      bytesParsed_(0) {
     
     nAtoms_ = info->getNGlobalAtoms();
     nRigidBodies_ = info->getNGlobalRigidBodies();
@@ -80,14 +81,24 @@ namespace OpenMD {
     //RealType frameCapacity = avaliablePhysMem / bytesPerFrame;
     RealType frameCapacity = (RealType) memSize_ / (RealType) bytesPerFrame;
 
-    // number of frames in each block given the need to hold multiple blocks 
-    // in memory at the same time:
-    nSnapshotPerBlock_ = int(frameCapacity) / blockCapacity_;
+    // The memory is divided into slots: the blocks that must be
+    // co-resident, at least one more to let the LRU cache carry
+    // blocks across consecutive block pairs, and one slot's worth for
+    // the text of the block being prefetched:
+    int nSlots = std::max(blockCapacity + 2, 4);
+    nSnapshotPerBlock_ = int(frameCapacity) / nSlots;
     if (nSnapshotPerBlock_ <= 0) {
       std::cerr << "not enough memory to hold two configs!" << std::endl;
     }
     reader_ = new DumpReader(info, filename);
     nframes_ = reader_->getNFrames();
+
+    // if the whole trajectory fits in the resident slots, use blocks
+    // that are just large enough to hold it:
+    if (nframes_ <= (nSlots - 1) * nSnapshotPerBlock_) {
+      nSnapshotPerBlock_ = (nframes_ + nSlots - 2) / (nSlots - 1);
+    }
+
     int nblocks = nframes_ / nSnapshotPerBlock_;
     if (nframes_ % int(nSnapshotPerBlock_) != 0) {
       ++nblocks;
@@ -101,9 +112,19 @@ namespace OpenMD {
     //to consider this special situation
     blocks_.back().second = nframes_;
 
+    blockCapacity_ = nSlots - 1;
+    activeBlocks_.assign(blockCapacity_, -1);
+    activeRefCount_.assign(blockCapacity_, 0);
+    lastUse_.assign(blockCapacity_, 0);
+
     snapshots_.insert(snapshots_.begin(), nframes_,
                       static_cast<Snapshot*>(NULL));   
 
+    // the parsing thread reads through its own stream so that it
+    // never competes with the prefetch thread for a file position:
+    inFile_ = new std::ifstream(filename_.c_str(), 
+                                std::ifstream::in | std::ifstream::binary);
+
     std::cout << "-----------------------------------------------------"
               << std::endl;
     std::cout << "BlockSnapshotManager memory report:" << std::endl;
@@ -129,6 +150,8 @@ namespace OpenMD {
               << (unsigned long)nSnapshotPerBlock_ << std::endl;
     std::cout << "     Total number of Blocks:\t" 
               << (unsigned long)nblocks << std::endl;
+    std::cout << "       Resident Block Slots:\t" 
+              << (unsigned long)blockCapacity_ << std::endl;
     std::cout << "-----------------------------------------------------"
               << std::endl;
     
@@ -136,15 +159,25 @@ namespace OpenMD {
 
 
   BlockSnapshotManager::~BlockSnapshotManager() {
+    if (prefetchRunning_) {
+      {
+        std::lock_guard<std::mutex> lock(prefetchMutex_);
+        stopPrefetch_ = true;
+      }
+      prefetchCond_.notify_all();
+      prefetchThread_.join();
+    }
+
     currentSnapshot_ = NULL;
     previousSnapshot_ = NULL;
     
     delete reader_;
+    delete inFile_;
 
     std::vector<int>::iterator i;
     for (i = activeBlocks_.begin(); i != activeBlocks_.end(); ++i) {
       if (*i != -1) {
-	unloadBlock(*i);
+	internalUnload(*i);
       }
     }
   }
@@ -172,26 +205,30 @@ namespace OpenMD {
     std::vector<int>::iterator i = findActiveBlock(block);
     bool loadSuccess(false);
     if (i != activeBlocks_.end()) {
-      // If the block is already in memory, just increase the
-      // reference count:
+      // If the block is already in memory (possibly cached with no
+      // references), just increase the reference count:
       ++activeRefCount_[i - activeBlocks_.begin()];
+      lastUse_[i - activeBlocks_.begin()] = ++useClock_;
+      ++nHits_;
       loadSuccess = true;
     } else if (getNActiveBlocks() < blockCapacity_){
       // If the number of active blocks is less than the block
       // capacity, just load the block:
       internalLoad(block);
       loadSuccess = true;
-    } else if ( hasZeroRefBlock() ) {
-      // If we have already reached the block capacity, we need to
-      // unload a block with 0 references:
-      int zeroRefBlock = getFirstZeroRefBlock();
-      assert(zeroRefBlock != -1);
-      internalUnload(zeroRefBlock);
-      internalLoad(block);
     } else {
-      // We have reached capacity and all blocks in memory are have
-      // non-zero references:
-      loadSuccess = false;
+      // If we have already reached the block capacity, we need to
+      // evict the least recently used block with 0 references:
+      int zeroRefBlock = getLeastRecentZeroRefBlock();
+      if (zeroRefBlock != -1) {
+        internalUnload(zeroRefBlock);
+        internalLoad(block);
+        loadSuccess = true;
+      } else {
+        // We have reached capacity and all blocks in memory are have
+        // non-zero references:
+        loadSuccess = false;
+      }
     }    
     return loadSuccess;
   }
@@ -207,9 +244,8 @@ namespace OpenMD {
 	activeRefCount_[i - activeBlocks_.begin()]  = 0;
       }
 
-      if (activeRefCount_[i-activeBlocks_.begin()] == 0) {
-        internalUnload(block);
-      }
+      // a block without references stays cached until its slot is
+      // needed by loadBlock
         
       unloadSuccess = true;
     } else {
@@ -219,10 +255,102 @@ namespace OpenMD {
     return unloadSuccess;
   }
 
+  void BlockSnapshotManager::prefetchBlock(int block) {
+    if (block < 0 || block >= getNBlocks() || isBlockActive(block)) return;
+
+    {
+      std::lock_guard<std::mutex> lock(prefetchMutex_);
+      if (block == prefetchedBlock_ || block == readingBlock_ || 
+          block == requestedBlock_) return;
+      
+      requestedBlock_ = block;
+      
+      if (!prefetchRunning_) {
+        prefetchThread_ = std::thread(&BlockSnapshotManager::prefetchLoop,
+                                      this);
+        prefetchRunning_ = true;
+      }
+    }
+    prefetchCond_.notify_all();
+  }
+
+  void BlockSnapshotManager::prefetchLoop() {
+    std::ifstream prefetchFile(filename_.c_str(), 
+                               std::ifstream::in | std::ifstream::binary);
+    std::vector<std::string> frameText;
+
+    std::unique_lock<std::mutex> lock(prefetchMutex_);
+    while (true) {
+      while (!stopPrefetch_ && requestedBlock_ == -1) 
+        prefetchCond_.wait(lock);
+      if (stopPrefetch_) break;
+
+      int block = requestedBlock_;
+      requestedBlock_ = -1;
+      readingBlock_ = block;
+      lock.unlock();
+
+      // only the disk read happens here; DumpReader::readFrameText
+      // touches nothing but the stream and the frame offsets.
+      frameText.resize(blocks_[block].second - blocks_[block].first);
+      for (int i = blocks_[block].first; i < blocks_[block].second; ++i) {
+        reader_->readFrameText(prefetchFile, i, 
+                               frameText[i - blocks_[block].first]);
+      }
+
+      lock.lock();
+      prefetchText_.swap(frameText);
+      prefetchedBlock_ = block;
+      readingBlock_ = -1;
+      prefetchCond_.notify_all();
+    }
+  }
+
+  std::vector<SnapshotBlock> BlockSnapshotManager::getBlockPairSchedule() {
+    std::vector<SnapshotBlock> schedule;
+    int nblocks = getNBlocks();
+    for (int i = 0; i < nblocks; ++i) {
+      // alternate the sweep direction so the blocks at the end of one
+      // sweep are still cached at the start of the next:
+      if (i % 2 == 0) {
+        for (int j = i; j < nblocks; ++j) 
+          schedule.push_back(SnapshotBlock(i, j));
+      } else {
+        for (int j = nblocks - 1; j >= i; --j) 
+          schedule.push_back(SnapshotBlock(i, j));
+      }
+    }
+    return schedule;
+  }
+
   void BlockSnapshotManager::internalLoad(int block) {
-        
+    std::vector<std::string> frameText;
+    bool prefetched = false;
+    {
+      // wait for a read of this block that is already under way:
+      std::unique_lock<std::mutex> lock(prefetchMutex_);
+      while (readingBlock_ == block || requestedBlock_ == block) 
+        prefetchCond_.wait(lock);
+      if (prefetchedBlock_ == block) {
+        frameText.swap(prefetchText_);
+        prefetchedBlock_ = -1;
+        prefetched = true;
+      }
+    }
+
+    if (prefetched) 
+      ++nPrefetchHits_;
+    else 
+      ++nMisses_;
+
+    std::string text;
     for (int i = blocks_[block].first; i < blocks_[block].second; ++i) {
-      snapshots_[i] = loadFrame(i);
+      if (prefetched) 
+        text.swap(frameText[i - blocks_[block].first]);
+      else 
+        reader_->readFrameText(*inFile_, i, text);
+      bytesParsed_ += text.size();
+      snapshots_[i] = loadFrame(i, text);
     }
     
     std::vector<int>::iterator j;
@@ -230,6 +358,7 @@ namespace OpenMD {
     assert(j != activeBlocks_.end());
     *j = block;    
     ++activeRefCount_[j - activeBlocks_.begin()];
+    lastUse_[j - activeBlocks_.begin()] = ++useClock_;
   }
 
   void BlockSnapshotManager::internalUnload(int block) {
@@ -241,18 +370,17 @@ namespace OpenMD {
     j = std::find(activeBlocks_.begin(), activeBlocks_.end(), block);
     assert(j != activeBlocks_.end());
     *j = -1;
+    activeRefCount_[j - activeBlocks_.begin()] = 0;
   }
 
-  bool BlockSnapshotManager::hasZeroRefBlock(){
-    return std::find(activeRefCount_.begin(), activeRefCount_.end(), 0)
-      != activeRefCount_.end() ?  true : false;
-  }
-  
-  int BlockSnapshotManager::getFirstZeroRefBlock(){
-    std::vector<int>::iterator i = std::find(activeRefCount_.begin(),
-                                             activeRefCount_.end(), 0);
-    return i != activeRefCount_.end() ?
-      activeBlocks_[i - activeRefCount_.begin()] : -1;
+  int BlockSnapshotManager::getLeastRecentZeroRefBlock(){
+    int oldest = -1;
+    for (unsigned int i = 0; i < activeBlocks_.size(); ++i) {
+      if (activeBlocks_[i] != -1 && activeRefCount_[i] == 0) {
+        if (oldest == -1 || lastUse_[i] < lastUse_[oldest]) oldest = i;
+      }
+    }
+    return oldest != -1 ? activeBlocks_[oldest] : -1;
   }
 
   std::vector<int> BlockSnapshotManager::getActiveBlocks() {
@@ -263,14 +391,15 @@ namespace OpenMD {
     return result;    
   }
 
-  Snapshot* BlockSnapshotManager::loadFrame(int frame){
+  Snapshot* BlockSnapshotManager::loadFrame(int frame, 
+                                            const std::string& frameText){
     Snapshot* snapshot = new Snapshot(nAtoms_, nRigidBodies_, nCutoffGroups_, 
                                       getStorageLayout(), usePBC_);
     snapshot->setID(frame);
     snapshot->clearDerivedProperties();
     
     currentSnapshot_ = snapshot;   
-    reader_->readFrame(frame);
+    reader_->readFrame(frame, frameText);
 
     return snapshot;
   }
@@ -283,4 +412,21 @@ namespace OpenMD {
     reader_->setNeedCOMprops(ncp);
   }
 
+  void BlockSnapshotManager::printStatistics() {
+    std::cout << "-----------------------------------------------------"
+              << std::endl;
+    std::cout << "BlockSnapshotManager cache report:" << std::endl;
+    std::cout << "\n";
+    std::cout << "        Resident block hits:\t" 
+              << nHits_ << std::endl;
+    std::cout << "      Prefetched block hits:\t" 
+              << nPrefetchHits_ << std::endl;
+    std::cout << "               Block misses:\t" 
+              << nMisses_ << std::endl;
+    std::cout << "               Bytes parsed:\t" 
+              << bytesParsed_ << std::endl;
+    std::cout << "-----------------------------------------------------"
+              << std::endl;
+  }
+
 }
@@ -41,6 +41,10 @@
  */
 #ifndef BRAINS_BLOCKSNAPSHOTMANAGER_HPP
 #define BRAINS_BLOCKSNAPSHOTMANAGER_HPP
+#include <condition_variable>
+#include <fstream>
+#include <mutex>
+#include <thread>
 #include <vector>
 
 #include "brains/SnapshotManager.hpp"
@@ -53,11 +57,25 @@ namespace OpenMD {
 
   /**
    * @class BlockSnapshotManager
-   * @todo document
+   * @brief Holds a dump file in memory a block of frames at a time.
+   *
+   * The memory budget (memSize) is split into equally sized block
+   * slots.  One slot's worth is set aside for a background thread
+   * that reads the raw text of the next block requested through
+   * prefetchBlock(), and the rest hold parsed blocks.  Blocks whose
+   * reference count drops to zero stay resident until their slot is
+   * needed, and are then evicted in least-recently-used order.
+   * Parsing always happens on the calling thread, since it writes
+   * into the SimInfo's StuntDoubles.
    */
   class BlockSnapshotManager : public SnapshotManager{
 
   public:
+    /**
+     * @param blockCapacity the number of blocks that must be able to
+     * be loaded at the same time.  At least two more slots are
+     * reserved for caching and prefetching.
+     */
     BlockSnapshotManager(SimInfo* info, const std::string& filename,
                          int storageLayout, long long int memSize,
                          int blockCapacity = 2);
@@ -88,6 +106,20 @@ namespace OpenMD {
         
     bool unloadBlock(int block);
 
+    /**
+     * Starts reading a block from disk in the background, so that a
+     * later loadBlock(block) only has to parse it.  Only one block is
+     * prefetched at a time; a new request replaces an older one.
+     */
+    void prefetchBlock(int block);
+
+    /**
+     * Returns every (block1, block2) pair with block2 >= block1, in a
+     * serpentine order where consecutive pairs share their blocks as
+     * much as possible, which minimizes reloads under the LRU policy.
+     */
+    std::vector<SnapshotBlock> getBlockPairSchedule();
+
     std::vector<int> getActiveBlocks();
 
     int getBlockCapacity() {
@@ -95,6 +127,17 @@ namespace OpenMD {
     }
 
     int getNFrames();
+
+    /** Number of loadBlock calls satisfied by a resident block */
+    unsigned long getNHits() { return nHits_; }
+    /** Number of loadBlock calls satisfied by a prefetched block */
+    unsigned long getNPrefetchHits() { return nPrefetchHits_; }
+    /** Number of loadBlock calls that had to read from disk */
+    unsigned long getNMisses() { return nMisses_; }
+    /** Total bytes of dump file text parsed so far */
+    unsigned long long getBytesParsed() { return bytesParsed_; }
+
+    void printStatistics();
         
   private:
 
@@ -102,15 +145,15 @@ namespace OpenMD {
       return std::find(activeBlocks_.begin(), activeBlocks_.end(), block);
     }
 
-    bool hasZeroRefBlock();
-
-    int getFirstZeroRefBlock();
+    int getLeastRecentZeroRefBlock();
 
     void internalLoad(int block);
     void internalUnload(int block);
-    Snapshot* loadFrame(int frame);
+    Snapshot* loadFrame(int frame, const std::string& frameText);
+    void prefetchLoop();
         
     SimInfo* info_;
+    std::string filename_;
     int blockCapacity_;
     long long int memSize_;
 
@@ -118,6 +161,8 @@ namespace OpenMD {
     std::vector<SnapshotBlock> blocks_;        
     std::vector<int> activeBlocks_;
     std::vector<int> activeRefCount_;
+    std::vector<unsigned long> lastUse_;
+    unsigned long useClock_;
         
     int nAtoms_;
     int nRigidBodies_;
@@ -125,9 +170,25 @@ namespace OpenMD {
     bool usePBC_;
     
     DumpReader* reader_;
+    std::ifstream* inFile_;
     int nframes_;
     int nSnapshotPerBlock_;
 
+    // background reader state, guarded by prefetchMutex_:
+    std::thread prefetchThread_;
+    std::mutex prefetchMutex_;
+    std::condition_variable prefetchCond_;
+    bool prefetchRunning_;
+    bool stopPrefetch_;
+    int requestedBlock_;
+    int readingBlock_;
+    int prefetchedBlock_;
+    std::vector<std::string> prefetchText_;
+
+    unsigned long nHits_;
+    unsigned long nPrefetchHits_;
+    unsigned long nMisses_;
+    unsigned long long bytesParsed_;
   };
 
 }
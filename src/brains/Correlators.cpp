@@ -0,0 +1,193 @@
+/*
+ * Copyright (c) 2018 The University of Notre Dame. All Rights Reserved.
+ *
+ * The University of Notre Dame grants you ("Licensee") a
+ * non-exclusive, royalty free, license to use, modify and
+ * redistribute this software in source and binary code form, provided
+ * that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the
+ *    distribution.
+ *
+ * This software is provided "AS IS," without a warranty of any
+ * kind. All express or implied conditions, representations and
+ * warranties, including any implied warranty of merchantability,
+ * fitness for a particular purpose or non-infringement, are hereby
+ * excluded.  The University of Notre Dame and its licensors shall not
+ * be liable for any damages suffered by licensee as a result of
+ * using, modifying or distributing the software or its
+ * derivatives. In no event will the University of Notre Dame or its
+ * licensors be liable for any lost revenue, profit or data, or for
+ * direct, indirect, special, consequential, incidental or punitive
+ * damages, however caused and regardless of the theory of liability,
+ * arising out of the use of or inability to use software, even if the
+ * University of Notre Dame has been advised of the possibility of
+ * such damages.
+ *
+ * SUPPORT OPEN SCIENCE!  If you use OpenMD or its source code in your
+ * research, please cite the appropriate papers when you publish your
+ * work.  Good starting points are:
+ *                                                                      
+ * [1]  Meineke, et al., J. Comp. Chem. 26, 252-271 (2005).             
+ * [2]  Fennell & Gezelter, J. Chem. Phys. 124, 234104 (2006).          
+ * [3]  Sun, Lin & Gezelter, J. Chem. Phys. 128, 234107 (2008).          
+ * [4]  Kuang & Gezelter,  J. Chem. Phys. 133, 164101 (2010).
+ * [5]  Vardeman, Stocker & Gezelter, J. Chem. Theory Comput. 7, 834 (2011).
+ */
+
+#ifdef IS_MPI
+#include <mpi.h>
+#endif
+
+#include <fstream>
+
+#include "brains/Correlators.hpp"
+#include "utils/StringTokenizer.hpp"
+#include "utils/StringUtils.hpp"
+#include "utils/simError.h"
+
+namespace OpenMD {
+
+  Correlators::Correlators(SimInfo* info) : info_(info), thermo_(info) {
+    Globals* simParams = info->getSimParams();
+
+    if (simParams->haveCorrelatorSampleTime()) 
+      sampleTime_ = simParams->getCorrelatorSampleTime();
+    else 
+      sampleTime_ = simParams->getDt();
+
+    int nPoints = simParams->getCorrelatorPoints();
+    int nAverage = simParams->getCorrelatorAveraging();
+    if (nPoints % nAverage != 0) {
+      sprintf(painCave.errMsg,
+              "Correlators: correlatorPoints (%d) must be a multiple of\n"
+              "\tcorrelatorAveraging (%d).\n", nPoints, nAverage);
+      painCave.isFatal = 1;
+      simError();
+    }
+
+    outputFileName_ = getPrefix(info->getFinalConfigFileName()) + ".acf";
+
+    StringTokenizer tokenizer(simParams->getCorrelators(), " ,;|\t\n\r");
+    while (tokenizer.hasMoreTokens()) {
+      std::string token = UpperCase(tokenizer.nextToken());
+      int nComponents;
+      if (token == "STRESS" || token == "PRESSURE_TENSOR") {
+        types_.push_back(STRESS);
+        nComponents = 6;
+      } else if (token == "HEAT_FLUX" || token == "HEATFLUX") {
+        types_.push_back(HEAT_FLUX);
+        nComponents = 3;
+      } else if (token == "SYSTEM_DIPOLE" || token == "DIPOLE") {
+        types_.push_back(SYSTEM_DIPOLE);
+        nComponents = 3;
+      } else {
+        sprintf(painCave.errMsg,
+                "Correlators: \"%s\" is not a recognized correlator.\n"
+                "\tChoose from STRESS, HEAT_FLUX and SYSTEM_DIPOLE.\n",
+                token.c_str());
+        painCave.isFatal = 1;
+        simError();
+        continue;
+      }
+      correlators_.push_back(new MultiTauCorrelator(nComponents, nPoints,
+                                                    nAverage));
+    }
+  }
+
+  Correlators::~Correlators() {
+    for (unsigned int i = 0; i < correlators_.size(); i++) 
+      delete correlators_[i];
+  }
+
+  void Correlators::collectData() {
+    RealType values[6];
+
+    for (unsigned int i = 0; i < types_.size(); i++) {
+      switch (types_[i]) {
+      case STRESS: {
+        // the six independent elements of the pressure tensor, in the
+        // units of the .stat file:
+        Mat3x3d p = thermo_.getPressureTensor();
+        values[0] = p(0, 0);
+        values[1] = p(1, 1);
+        values[2] = p(2, 2);
+        values[3] = p(0, 1);
+        values[4] = p(0, 2);
+        values[5] = p(1, 2);
+        break;
+      }
+      case HEAT_FLUX: {
+        Vector3d j = thermo_.getHeatFlux();
+        for (int k = 0; k < 3; k++) values[k] = j[k];
+        break;
+      }
+      case SYSTEM_DIPOLE: {
+        Vector3d m = thermo_.getSystemDipole();
+        for (int k = 0; k < 3; k++) values[k] = m[k];
+        break;
+      }
+      }
+      correlators_[i]->addSample(values);
+    }
+  }
+
+  void Correlators::writeOutputFile() {
+    if (correlators_.empty() || correlators_[0]->getNSamples() == 0) return;
+
+#ifdef IS_MPI
+    if (worldRank == 0) {
+#endif
+      std::ofstream acfFile(outputFileName_.c_str(), 
+                            std::ios::out | std::ios::trunc);
+      if (!acfFile) {
+        sprintf(painCave.errMsg,
+                "Could not open \"%s\" for correlator output.\n",
+                outputFileName_.c_str());
+        painCave.isFatal = 1;
+        simError();
+      }
+
+      acfFile << "# On-the-fly multi-tau autocorrelation functions\n";
+      acfFile << "# samples taken every " << sampleTime_ << " fs, "
+              << correlators_[0]->getNSamples() << " samples\n";
+      acfFile << "# time(fs)";
+      for (unsigned int i = 0; i < types_.size(); i++) {
+        switch (types_[i]) {
+        case STRESS:
+          acfFile << "\tPxx\tPyy\tPzz\tPxy\tPxz\tPyz";
+          break;
+        case HEAT_FLUX:
+          acfFile << "\tJx\tJy\tJz";
+          break;
+        case SYSTEM_DIPOLE:
+          acfFile << "\tMx\tMy\tMz";
+          break;
+        }
+      }
+      acfFile << "\n";
+
+      // every correlator shares the same sampling, and hence the same lags:
+      std::vector<RealType> lags;
+      std::vector<std::vector<std::vector<RealType> > > corr(correlators_.size());
+      for (unsigned int i = 0; i < correlators_.size(); i++) 
+        correlators_[i]->getCorrelation(lags, corr[i]);
+
+      for (unsigned int n = 0; n < lags.size(); n++) {
+        acfFile << lags[n] * sampleTime_;
+        for (unsigned int i = 0; i < correlators_.size(); i++) 
+          for (unsigned int k = 0; k < corr[i][n].size(); k++) 
+            acfFile << "\t" << corr[i][n][k];
+        acfFile << "\n";
+      }
+      acfFile.close();
+#ifdef IS_MPI
+    }
+#endif
+  }
+}
@@ -70,6 +70,7 @@
 #include "io/ShapeAtomTypesSectionParser.hpp"
 #include "io/StickyAtomTypesSectionParser.hpp"
 #include "io/StickyPowerAtomTypesSectionParser.hpp"
+#include "io/TabulatedInteractionsSectionParser.hpp"
 #include "io/TorsionTypesSectionParser.hpp"
 
 #include "types/LennardJonesAdapter.hpp"
@@ -139,6 +140,7 @@ namespace OpenMD {
     spMan_.push_back(new InversionTypesSectionParser(forceFieldOptions_));
 
     spMan_.push_back(new NonBondedInteractionsSectionParser(forceFieldOptions_));    
+    spMan_.push_back(new TabulatedInteractionsSectionParser(forceFieldOptions_));
   }
 
   void ForceField::parse(const std::string& filename) {
@@ -52,6 +52,8 @@
 #include "primitives/Molecule.hpp"
 #define __OPENMD_C
 #include "utils/simError.h"
+#include "utils/TimerRegistry.hpp"
+#include "utils/PerformanceCounters.hpp"
 #include "primitives/Bond.hpp"
 #include "primitives/Bend.hpp"
 #include "primitives/Torsion.hpp"
@@ -68,7 +70,9 @@
 using namespace std;
 namespace OpenMD {
 
-  ForceManager::ForceManager(SimInfo * info) : initialized_(false), info_(info),
+  ForceManager::ForceManager(SimInfo * info) : initialized_(false), 
+                                               forceTiers_(ALL_TIERS), 
+                                               info_(info),
                                                switcher_(NULL), seleMan_(info), evaluator_(info) {
     forceField_ = info_->getForceField();
     interactionMan_ = new InteractionManager();
@@ -371,6 +375,7 @@ namespace OpenMD {
       doElectricField_ = info_->getSimParams()->getOutputElectricField();
       doSitePotential_ = info_->getSimParams()->getOutputSitePotential();
 
+      PerformanceCounters::getInstance()->setEnabled(info_->getSimParams()->getPerformanceCounters());
     }
 
     ForceFieldOptions& fopts = forceField_->getForceFieldOptions();
@@ -431,12 +436,33 @@ namespace OpenMD {
   }
 
   void ForceManager::calcForces() {
+    TimerRegistry* timers = TimerRegistry::getInstance();
+    static int forceTimer = timers->getTimerID("Force");
+    static int preTimer = timers->getTimerID("Force/PreCalculation");
+    static int shortTimer = timers->getTimerID("Force/ShortRange");
+    static int longTimer = timers->getTimerID("Force/LongRange");
+    static int postTimer = timers->getTimerID("Force/PostCalculation");
+    ScopedTimer forceScope(forceTimer);
 
     if (!initialized_) initialize();
+
+    timers->start(preTimer);
     preCalculation();
+    timers->stop(preTimer);
+
+    timers->start(shortTimer);
     shortRangeInteractions();
-    longRangeInteractions();
+    timers->stop(shortTimer);
+
+    if (forceTiers_ & (NONBONDED_TIER | RECIPROCAL_TIER)) {
+      timers->start(longTimer);
+      longRangeInteractions();
+      timers->stop(longTimer);
+    }
+
+    timers->start(postTimer);
     postCalculation();
+    timers->stop(postTimer);
   }
 
   void ForceManager::preCalculation() {
@@ -532,6 +558,8 @@ namespace OpenMD {
         rb->updateAtoms();
       }
 
+      if (!(forceTiers_ & BONDED_TIER)) continue;
+
       for (bond = mol->beginBond(bondIter); bond != NULL;
            bond = mol->nextBond(bondIter)) {
         bond->calcForce(doParticlePot_);
@@ -674,6 +702,31 @@ namespace OpenMD {
   }
 
   void ForceManager::longRangeInteractions() {
+    TimerRegistry* timers = TimerRegistry::getInstance();
+    static int neighborTimer = 
+      timers->getTimerID("Force/LongRange/NeighborList");
+    static int pairTimer = timers->getTimerID("Force/LongRange/PairLoop");
+    static int collectTimer = 
+      timers->getTimerID("Force/LongRange/CollectData");
+    static int reciprocalTimer = 
+      timers->getTimerID("Force/LongRange/ReciprocalSpace");
+
+    PerformanceCounters* counters = PerformanceCounters::getInstance();
+    static int groupPairsVisited = 
+      counters->getCounterID("PairLoop/GroupPairsVisited");
+    static int groupPairsInCutoff = 
+      counters->getCounterID("PairLoop/GroupPairsInCutoff");
+    static int atomPairsVisited = 
+      counters->getCounterID("PairLoop/AtomPairsVisited");
+    static int atomPairsInCutoff = 
+      counters->getCounterID("PairLoop/AtomPairsInCutoff");
+    static int neighborChecks = 
+      counters->getCounterID("NeighborList/Checks");
+    static int neighborRebuilds = 
+      counters->getCounterID("NeighborList/Rebuilds");
+    // plain local tallies are cheaper than testing isEnabled() per pair:
+    long long nGroupPairs(0), nGroupPairsIn(0);
+    long long nAtomPairs(0), nAtomPairsIn(0);
 
     Snapshot* curSnapshot = info_->getSnapshotManager()->getCurrentSnapshot();
     DataStorage* config = &(curSnapshot->atomData);
@@ -768,17 +821,29 @@ namespace OpenMD {
     } else {
       loopStart = PAIR_LOOP;
     }
+    // the pair loop is skipped when only the reciprocal-space tier
+    // was requested:
+    if (!(forceTiers_ & NONBONDED_TIER)) loopEnd = loopStart - 1;
+
     for (int iLoop = loopStart; iLoop <= loopEnd; iLoop++) {
 
       if (iLoop == loopStart) {
+        timers->start(neighborTimer);
         bool update_nlist = fDecomp_->checkNeighborList();
+        if (counters->isEnabled()) {
+          counters->add(neighborChecks, 1);
+          if (update_nlist) counters->add(neighborRebuilds, 1);
+        }
         if (update_nlist) {
           if (!usePeriodicBoundaryConditions_)
             Mat3x3d bbox = thermo->getBoundingBox();
           fDecomp_->buildNeighborList(neighborList_, point_);
         }
+        timers->stop(neighborTimer);
       }
 
+      timers->start(pairTimer);
+      if (iLoop == PAIR_LOOP) counters->startHardwareCounters();
       for (cg1 = 0; cg1 < int(point_.size()) - 1; cg1++) {
 
         atomListRow = fDecomp_->getAtomsInGroupRow(cg1);
@@ -793,9 +858,11 @@ namespace OpenMD {
           // already wrapped in the getIntergroupVector call:
           // curSnapshot->wrapVector(d_grp);
           rgrpsq = d_grp.lengthSquare();
+          if (iLoop == PAIR_LOOP) nGroupPairs++;
 
           if (rgrpsq < rCutSq_) {
             if (iLoop == PAIR_LOOP) {
+              nGroupPairsIn++;
               vij = 0.0;
               fij.zero();
               eField1.zero();
@@ -863,6 +930,10 @@ namespace OpenMD {
 
                   r = sqrt( *(idat.r2) );
                   idat.rij = &r;
+                  if (iLoop == PAIR_LOOP) {
+                    nAtomPairs++;
+                    if (*(idat.r2) < rCutSq_) nAtomPairsIn++;
+                  }
 
                   if (iLoop == PREPAIR_LOOP) {
                     interactionMan_->doPrePair(idat);
@@ -965,19 +1036,32 @@ namespace OpenMD {
 
         }
       }
+      if (iLoop == PAIR_LOOP) counters->stopHardwareCounters("PairLoop");
+      timers->stop(pairTimer);
+    }
+
+    if (counters->isEnabled()) {
+      counters->add(groupPairsVisited, nGroupPairs);
+      counters->add(groupPairsInCutoff, nGroupPairsIn);
+      counters->add(atomPairsVisited, nAtomPairs);
+      counters->add(atomPairsInCutoff, nAtomPairsIn);
     }
 
     // collects pairwise information
+    timers->start(collectTimer);
     fDecomp_->collectData();
-    if (cutoffMethod_ == EWALD_FULL) {
+    timers->stop(collectTimer);
+    if (cutoffMethod_ == EWALD_FULL && (forceTiers_ & RECIPROCAL_TIER)) {
+      timers->start(reciprocalTimer);
       interactionMan_->doReciprocalSpaceSum(reciprocalPotential);
       curSnapshot->setReciprocalPotential(reciprocalPotential);
 
       // interactionMan_->doSurfaceTerm(surfacePotential);
       curSnapshot->setSurfacePotential(surfacePotential);
+      timers->stop(reciprocalTimer);
     }
 
-    if (info_->requiresSelfCorrection()) {
+    if (info_->requiresSelfCorrection() && (forceTiers_ & NONBONDED_TIER)) {
       for (unsigned int atom1 = 0; atom1 < info_->getNAtoms(); atom1++) {
         if (doPotentialSelection_) {
           gid1 = fDecomp_->getGlobalID(atom1);
@@ -1010,9 +1094,12 @@ namespace OpenMD {
 
   void ForceManager::postCalculation() {
 
+    // external perturbations are evaluated with the non-bonded tier:
     vector<Perturbation*>::iterator pi;
-    for (pi = perturbations_.begin(); pi != perturbations_.end(); ++pi) {
-      (*pi)->applyPerturbation();
+    if (forceTiers_ & NONBONDED_TIER) {
+      for (pi = perturbations_.begin(); pi != perturbations_.end(); ++pi) {
+        (*pi)->applyPerturbation();
+      }
     }
 
     SimInfo::MoleculeIterator mi;
@@ -78,14 +78,56 @@ namespace OpenMD {
   class ForceManager {
 
   public:
+    /**
+     * Force tiers which can be evaluated separately by multiple time
+     * step integrators: bonded (fast), real-space non-bonded (medium)
+     * and reciprocal-space (slow) interactions.
+     */
+    enum ForceTier {
+      BONDED_TIER = 1,
+      NONBONDED_TIER = 2,
+      RECIPROCAL_TIER = 4,
+      ALL_TIERS = 7
+    };
+
     ForceManager(SimInfo * info);                          
     virtual ~ForceManager();
     virtual void calcForces();
     virtual void calcSelectedForces(Molecule* mol1, Molecule* mol2);
     void initialize();
 
+    /** Restricts calcForces to a combination of ForceTier flags */
+    void setForceTiers(int tiers) { forceTiers_ = tiers; }
+    int getForceTiers() { return forceTiers_; }
+    /** Returns true if a reciprocal-space sum is part of the forces */
+    bool usesReciprocalSpace() { return cutoffMethod_ == EWALD_FULL; }
+
+    /**
+     * Writes the neighbor list and the positions it was built from.
+     * Checkpoints keep these so that a resumed run rebuilds its list
+     * at the same steps, and sums the pairs in the same order, as the
+     * uninterrupted run.
+     */
+    void saveNeighborList(std::ostream& os) {
+      writeBinary(os, neighborList_);
+      writeBinary(os, point_);
+      fDecomp_->saveNeighborListState(os);
+    }
+    /** Restores the neighbor list written by saveNeighborList */
+    void loadNeighborList(std::istream& is) {
+      readBinary(is, neighborList_);
+      readBinary(is, point_);
+      fDecomp_->loadNeighborListState(is);
+    }
+
+    /** Writes any internal state (e.g. random number streams) */
+    virtual void saveState(std::ostream&) {}
+    /** Restores the state written by saveState */
+    virtual void loadState(std::istream&) {}
+
   protected: 
     bool initialized_; 
+    int forceTiers_;
     bool doParticlePot_;
     bool doElectricField_;
     bool doSitePotential_;
@@ -0,0 +1,108 @@
+/*
+ * Copyright (c) 2018 The University of Notre Dame. All Rights Reserved.
+ *
+ * The University of Notre Dame grants you ("Licensee") a
+ * non-exclusive, royalty free, license to use, modify and
+ * redistribute this software in source and binary code form, provided
+ * that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the
+ *    distribution.
+ *
+ * This software is provided "AS IS," without a warranty of any
+ * kind. All express or implied conditions, representations and
+ * warranties, including any implied warranty of merchantability,
+ * fitness for a particular purpose or non-infringement, are hereby
+ * excluded.  The University of Notre Dame and its licensors shall not
+ * be liable for any damages suffered by licensee as a result of
+ * using, modifying or distributing the software or its
+ * derivatives. In no event will the University of Notre Dame or its
+ * licensors be liable for any lost revenue, profit or data, or for
+ * direct, indirect, special, consequential, incidental or punitive
+ * damages, however caused and regardless of the theory of liability,
+ * arising out of the use of or inability to use software, even if the
+ * University of Notre Dame has been advised of the possibility of
+ * such damages.
+ *
+ * SUPPORT OPEN SCIENCE!  If you use OpenMD or its source code in your
+ * research, please cite the appropriate papers when you publish your
+ * work.  Good starting points are:
+ *                                                                      
+ * [1]  Meineke, et al., J. Comp. Chem. 26, 252-271 (2005).             
+ * [2]  Fennell & Gezelter, J. Chem. Phys. 124, 234104 (2006).          
+ * [3]  Sun, Lin & Gezelter, J. Chem. Phys. 128, 234107 (2008).          
+ * [4]  Kuang & Gezelter,  J. Chem. Phys. 133, 164101 (2010).
+ * [5]  Vardeman, Stocker & Gezelter, J. Chem. Theory Comput. 7, 834 (2011).
+ */
+ 
+#include "brains/IntegrableObjectIndex.hpp"
+#include "brains/SimInfo.hpp"
+#include "primitives/Molecule.hpp"
+
+namespace OpenMD {
+
+  IntegrableObjectIndex::IntegrableObjectIndex(SimInfo* info) : 
+    info_(info), needsUpdate_(true), nObjects_(0) {
+    
+    spans_[ioAtom].storage = &Snapshot::atomData;
+    spans_[ioAtom].directional = false;
+    spans_[ioDirectionalAtom].storage = &Snapshot::atomData;
+    spans_[ioDirectionalAtom].directional = true;
+    spans_[ioRigidBody].storage = &Snapshot::rigidbodyData;
+    spans_[ioRigidBody].directional = true;
+  }
+
+  void IntegrableObjectIndex::update() {
+    SimInfo::MoleculeIterator mi;
+    Molecule::IntegrableObjectIterator ioi;
+    Molecule* mol;
+    StuntDouble* sd;
+    
+    for (int t = 0; t < ioNSpanTypes; t++) {
+      spans_[t].localIndex.clear();
+      spans_[t].mass.clear();
+      spans_[t].invI.clear();
+      spans_[t].sd.clear();
+    }
+
+    for (mol = info_->beginMolecule(mi); mol != NULL; 
+         mol = info_->nextMolecule(mi)) {
+      for (sd = mol->beginIntegrableObject(ioi); sd != NULL;
+           sd = mol->nextIntegrableObject(ioi)) {
+
+        int t;
+        if (sd->isRigidBody()) 
+          t = ioRigidBody;
+        else if (sd->isDirectionalAtom()) 
+          t = ioDirectionalAtom;
+        else 
+          t = ioAtom;
+
+        Vector3d invI(0.0);
+        if (sd->isDirectional()) {
+          Mat3x3d I = sd->getI();
+          for (int k = 0; k < 3; k++) 
+            if (!sd->isLinear() || k != sd->linearAxis()) 
+              invI[k] = 1.0 / I(k, k);
+        }
+
+        spans_[t].localIndex.push_back(sd->getLocalIndex());
+        spans_[t].mass.push_back(sd->getMass());
+        spans_[t].invI.push_back(invI);
+        spans_[t].sd.push_back(sd);
+      }
+    }
+
+    nObjects_ = 0;
+    for (int t = 0; t < ioNSpanTypes; t++) {
+      spans_[t].offset = nObjects_;
+      nObjects_ += spans_[t].size();
+    }
+    needsUpdate_ = false;
+  }
+}
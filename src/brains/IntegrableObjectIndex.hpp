@@ -0,0 +1,117 @@
+/*
+ * Copyright (c) 2018 The University of Notre Dame. All Rights Reserved.
+ *
+ * The University of Notre Dame grants you ("Licensee") a
+ * non-exclusive, royalty free, license to use, modify and
+ * redistribute this software in source and binary code form, provided
+ * that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the
+ *    distribution.
+ *
+ * This software is provided "AS IS," without a warranty of any
+ * kind. All express or implied conditions, representations and
+ * warranties, including any implied warranty of merchantability,
+ * fitness for a particular purpose or non-infringement, are hereby
+ * excluded.  The University of Notre Dame and its licensors shall not
+ * be liable for any damages suffered by licensee as a result of
+ * using, modifying or distributing the software or its
+ * derivatives. In no event will the University of Notre Dame or its
+ * licensors be liable for any lost revenue, profit or data, or for
+ * direct, indirect, special, consequential, incidental or punitive
+ * damages, however caused and regardless of the theory of liability,
+ * arising out of the use of or inability to use software, even if the
+ * University of Notre Dame has been advised of the possibility of
+ * such damages.
+ *
+ * SUPPORT OPEN SCIENCE!  If you use OpenMD or its source code in your
+ * research, please cite the appropriate papers when you publish your
+ * work.  Good starting points are:
+ *                                                                      
+ * [1]  Meineke, et al., J. Comp. Chem. 26, 252-271 (2005).             
+ * [2]  Fennell & Gezelter, J. Chem. Phys. 124, 234104 (2006).          
+ * [3]  Sun, Lin & Gezelter, J. Chem. Phys. 128, 234107 (2008).          
+ * [4]  Kuang & Gezelter,  J. Chem. Phys. 133, 164101 (2010).
+ * [5]  Vardeman, Stocker & Gezelter, J. Chem. Theory Comput. 7, 834 (2011).
+ */
+ 
+#ifndef BRAINS_INTEGRABLEOBJECTINDEX_HPP
+#define BRAINS_INTEGRABLEOBJECTINDEX_HPP
+
+#include <vector>
+#include "brains/Snapshot.hpp"
+#include "primitives/StuntDouble.hpp"
+
+namespace OpenMD {
+
+  class SimInfo;
+
+  /**
+   * @class IntegrableObjectIndex IntegrableObjectIndex.hpp "brains/IntegrableObjectIndex.hpp"
+   * A flat index of the local integrable objects.
+   *
+   * The integrable objects are grouped into three spans (point atoms,
+   * directional atoms and rigid bodies).  Each span records the local
+   * indices into the DataStorage that holds its objects, along with
+   * the masses and inverse principal moments, so that the integrators
+   * and Thermo can stream over the snapshot arrays directly instead of
+   * walking the molecule iterators and calling the StuntDouble
+   * accessors for every get and set.
+   *
+   * The flat ordering of the integrable objects (used by integrators
+   * that keep per-object scratch arrays) is atoms, then directional
+   * atoms, then rigid bodies; Span::offset gives the position of the
+   * first object of a span in that ordering.
+   */
+  class IntegrableObjectIndex {
+  public:
+    enum SpanType {
+      ioAtom = 0,
+      ioDirectionalAtom,
+      ioRigidBody,
+      ioNSpanTypes
+    };
+
+    struct Span {
+      DataStoragePointer storage;
+      bool directional;
+      int offset;
+      std::vector<int> localIndex;
+      std::vector<RealType> mass;
+      std::vector<Vector3d> invI;  /**< zero along the axis of a linear object */
+      std::vector<StuntDouble*> sd;
+      int size() const { return localIndex.size(); }
+    };
+
+    IntegrableObjectIndex(SimInfo* info);
+
+    /** Marks the index as stale (molecules were added or removed) */
+    void invalidate() { needsUpdate_ = true; }
+
+    /** Returns one of the three spans, rebuilding the index if needed */
+    Span& getSpan(int type) {
+      if (needsUpdate_) update();
+      return spans_[type];
+    }
+
+    /** Returns the number of local integrable objects in the index */
+    int getNIntegrableObjects() {
+      if (needsUpdate_) update();
+      return nObjects_;
+    }
+
+  private:
+    void update();
+
+    SimInfo* info_;
+    bool needsUpdate_;
+    int nObjects_;
+    Span spans_[ioNSpanTypes];
+  };
+}
+#endif
@@ -50,6 +50,7 @@
 #include <cassert>
 #include <typeinfo>
 #include <set>
+#include <map>
 
 #include "brains/MoleculeCreator.hpp"
 #include "primitives/GhostBend.hpp"
@@ -738,5 +739,59 @@ namespace OpenMD {
 	mol->addConstraintElem(new ConstraintElem(sdB));
       }      
     }
+
+    // group the constraint pairs into clusters of pairs that share
+    // elements (union-find over the StuntDoubles):
+    std::map<StuntDouble*, int> sdIndex;
+    std::vector<int> parent;
+    for (consPair = mol->beginConstraintPair(cpi); consPair != NULL; 
+         consPair = mol->nextConstraintPair(cpi)) {
+      StuntDouble* sds[2] = {consPair->getConsElem1()->getStuntDouble(),
+                             consPair->getConsElem2()->getStuntDouble()};
+      int roots[2];
+      for (int j = 0; j < 2; j++) {
+        std::map<StuntDouble*, int>::iterator si = sdIndex.find(sds[j]);
+        if (si == sdIndex.end()) {
+          si = sdIndex.insert(std::make_pair(sds[j], 
+                                             int(parent.size()))).first;
+          parent.push_back(si->second);
+        }
+        int r = si->second;
+        while (parent[r] != r) r = parent[r];
+        roots[j] = r;
+      }
+      parent[roots[1]] = roots[0];
+    }
+
+    std::map<int, ConstraintCluster*> clusters;
+    for (consPair = mol->beginConstraintPair(cpi); consPair != NULL; 
+         consPair = mol->nextConstraintPair(cpi)) {
+      int r = sdIndex[consPair->getConsElem1()->getStuntDouble()];
+      while (parent[r] != r) r = parent[r];
+      
+      std::map<int, ConstraintCluster*>::iterator ci = clusters.find(r);
+      if (ci == clusters.end()) {
+        ci = clusters.insert(std::make_pair(r, new ConstraintCluster())).first;
+        mol->addConstraintCluster(ci->second);
+      }
+      ci->second->addConstraintPair(consPair);
+    }
+
+    // select the solver for each cluster: rigid isosceles triangles
+    // (water) are solved analytically, small coupled networks with a
+    // matrix solve, and isolated pairs or very large networks with the
+    // iterative pair sweep.
+    ConstraintCluster* cluster;
+    Molecule::ConstraintClusterIterator cci;
+    for (cluster = mol->beginConstraintCluster(cci); cluster != NULL;
+         cluster = mol->nextConstraintCluster(cci)) {
+      int nPairs = cluster->getNConstraintPairs();
+      if (cluster->setupTriangle()) 
+        cluster->setType(ConstraintCluster::ccTriangle);
+      else if (nPairs > 1 && nPairs <= ConstraintCluster::maxMatrixPairs)
+        cluster->setType(ConstraintCluster::ccMatrix);
+      else
+        cluster->setType(ConstraintCluster::ccIterative);
+    }
   }
 }
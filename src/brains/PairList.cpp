@@ -40,6 +40,7 @@
  * [5]  Vardeman, Stocker & Gezelter, J. Chem. Theory Comput. 7, 834 (2011).
  */
  
+#include <algorithm>
 #include <functional>
 #include <iterator>
 #include <utility>
@@ -48,36 +49,18 @@
 
 namespace OpenMD {
   
-  int *PairList::getPairList() {
-
-    if (modified_) {
-      pairList_.clear();
-      
-      for (std::set<std::pair<int,int> >::iterator i = pairSet_.begin();
-           i != pairSet_.end(); ++i) {
-	pairList_.push_back(i->first + 1);
-	pairList_.push_back(i->second + 1);            
-      }
-      modified_ = false;
-    } 
-    
-    return pairList_.empty() ? NULL : &(pairList_[0]);
-  }
-  
   void PairList::addPair(int i, int j) {
     
-    if (i == j) {
+    if (i == j || i < 0 || j < 0) {
       return;
     } else if (i > j) {
       std::swap(i, j);
     }
-    
-    std::set<std::pair<int, int> >::iterator iter = pairSet_.find(std::make_pair(i, j));
-    
-    if (iter == pairSet_.end()) {
-      pairSet_.insert(std::make_pair(i, j));
-      modified_ = true;
-    }
+
+    // a pending removal has to be applied before the pair can come
+    // back:
+    if (!removed_.empty()) compact();
+    added_.push_back(std::make_pair(i, j));
   }
   
   void PairList::addPairs(std::set<int>& set1, std::set<int>& set2) {
@@ -100,19 +83,14 @@ namespace OpenMD {
   }
 
   void PairList::removePair(int i, int j) {    
-    if (i == j) {
+    if (i == j || i < 0 || j < 0) {
       return;
     } else if (i > j) {
       std::swap(i, j);
     }
 
-
-    std::set<std::pair<int, int> >::iterator iter = pairSet_.find(std::make_pair(i, j));
-    
-    if (iter != pairSet_.end()) {
-      pairSet_.erase(iter);
-      modified_ = true;
-    }
+    if (!added_.empty()) compact();
+    removed_.push_back(std::make_pair(i, j));
   }
 
   void PairList::removePairs(std::set<int>& set1, std::set<int>& set2) {
@@ -134,6 +112,61 @@ namespace OpenMD {
     }
   }
 
+  /**
+   * Merges the buffered additions or removals into the CSR arrays.
+   * Both the existing rows and the sorted buffer are ordered by (i,
+   * j), so a single sweep produces the new arrays.
+   */
+  void PairList::compact() {
+    if (added_.empty() && removed_.empty()) return;
+
+    std::vector<std::pair<int, int> >& pending = added_.empty() ? removed_ : added_;
+    bool adding = !added_.empty();
+
+    std::sort(pending.begin(), pending.end());
+    pending.erase(std::unique(pending.begin(), pending.end()), pending.end());
+
+    int nRows = rowStart_.empty() ? 0 : rowStart_.size() - 1;
+    if (adding) nRows = std::max(nRows, pending.back().first + 1);
+
+    std::vector<int> newStart(nRows + 1, 0);
+    std::vector<int> newPartners;
+    newPartners.reserve(adding ? partners_.size() + pending.size() 
+                        : partners_.size());
+
+    std::vector<std::pair<int, int> >::iterator p = pending.begin();
+    int nOld = static_cast<int>(rowStart_.size()) - 1;
+
+    for (int i = 0; i < nRows; i++) {
+      int k = 0, kEnd = 0;
+      if (i < nOld) {
+        k = rowStart_[i];
+        kEnd = rowStart_[i+1];
+      }
+      
+      while (k < kEnd || (p != pending.end() && p->first == i)) {
+        bool havePending = (p != pending.end() && p->first == i);
+        if (k < kEnd && (!havePending || partners_[k] < p->second)) {
+          newPartners.push_back(partners_[k++]);
+        } else if (k < kEnd && partners_[k] == p->second) {
+          // present in both: keep it when adding, drop it when removing
+          if (adding) newPartners.push_back(partners_[k]);
+          ++k;
+          ++p;
+        } else {
+          if (adding) newPartners.push_back(p->second);
+          ++p;
+        }
+      }
+      newStart[i+1] = newPartners.size();
+    }
+
+    rowStart_.swap(newStart);
+    partners_.swap(newPartners);
+    std::vector<std::pair<int, int> >().swap(added_);
+    std::vector<std::pair<int, int> >().swap(removed_);
+  }
+
   bool PairList::hasPair(int i, int j) {
     
     if (i == j) {
@@ -141,31 +174,51 @@ namespace OpenMD {
     } else if (i > j) {
       std::swap(i, j);
     }
+
+    compact();
+    if (i < 0 || i >= getNRows()) return false;
     
-    std::set<std::pair<int, int> >::iterator  iter = pairSet_.find(std::make_pair(i, j));
-    return iter == pairSet_.end() ? false : true; 
+    std::vector<int>::const_iterator first = partners_.begin() + rowStart_[i];
+    std::vector<int>::const_iterator last = partners_.begin() + rowStart_[i+1];
+    return std::binary_search(first, last, j);
   }
   
   int PairList::getSize() {
-    return pairSet_.size();
+    compact();
+    return partners_.size();
+  }
+
+  int PairList::getNRows() {
+    compact();
+    return rowStart_.empty() ? 0 : rowStart_.size() - 1;
+  }
+
+  const std::vector<int>& PairList::getRowOffsets() {
+    compact();
+    if (rowStart_.empty()) rowStart_.push_back(0);
+    return rowStart_;
+  }
+
+  const std::vector<int>& PairList::getPartners() {
+    compact();
+    return partners_;
   }
 
   std::ostream& operator <<(std::ostream& o, PairList& e) {
-    std::set<std::pair<int, int> >::iterator i;
+    const std::vector<int>& start = e.getRowOffsets();
+    const std::vector<int>& partners = e.getPartners();
     
-    int index;
+    int index = 0;
     
-    index = 0;
-    
-    for(i = e.pairSet_.begin(); i != e.pairSet_.end(); ++i) {
-      o << "pairList[" << index << "] i, j: " << (*i).first << " - "
-	<< (*i).second << "\n";
-      index++;
+    for (int i = 0; i < static_cast<int>(start.size()) - 1; ++i) {
+      for (int k = start[i]; k < start[i+1]; ++k) {
+        o << "pairList[" << index << "] i, j: " << i << " - "
+          << partners[k] << "\n";
+        index++;
+      }
     }
     
     return o;
   }
   
 }
-
-  
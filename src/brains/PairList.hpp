@@ -57,12 +57,19 @@ namespace OpenMD {
    * pairs using the global indices of the atoms.  This structure is
    * the general form for exclude lists as well as 1-4, 1-3, and 1-2 
    * lists.
+   *
+   * Pairs are stored once, as (i, j) with i < j, in compressed sparse
+   * row form: the partners of atom i are the sorted entries
+   * [getRowOffsets()[i], getRowOffsets()[i+1]) of getPartners().
+   * Additions and removals are buffered and merged into the CSR
+   * arrays in bulk the next time the list is queried, so building
+   * the list for a whole system costs O(P log P) and each pair costs
+   * a single int of storage.
    */
   class PairList {
   public:
 
-    PairList() : modified_(false) {}
-
+    PairList() {}
 
     /** Adds a pair into this PairList class */
     void addPair(int i, int j);
@@ -84,20 +91,27 @@ namespace OpenMD {
     /** Returns the number of pairs in the list */
     int getSize();
 
-    /** Returns the size of PairList */
-    int getSizeOfPairList();
+    /** Returns the number of CSR rows (one more than the largest
+        first index in the list) */
+    int getNRows();
+
+    /** Returns the CSR row offsets (getNRows() + 1 entries) */
+    const std::vector<int>& getRowOffsets();
 
-    /** Returns the pairs in a plain array*/
-    int *getPairList();
+    /** Returns the CSR partner indices, sorted within each row */
+    const std::vector<int>& getPartners();
 
     /** write out the exclusion list to an ostream */
     friend std::ostream& operator <<(std::ostream& o, PairList& e);
 
   private:
 
-    std::set < std::pair<int, int> > pairSet_;
-    std::vector <int> pairList_;
-    bool modified_;
+    void compact();
+
+    std::vector<int> rowStart_;
+    std::vector<int> partners_;
+    std::vector<std::pair<int, int> > added_;
+    std::vector<std::pair<int, int> > removed_;
   };
 
 }      //end namespace OpenMD
@@ -56,6 +56,7 @@
 #include "integrators/NPA.hpp"
 #include "integrators/NgammaT.hpp"
 #include "integrators/LangevinDynamics.hpp"
+#include "integrators/RESPA.hpp"
 #if defined(HAVE_QHULL)
 #include "integrators/LangevinHullDynamics.hpp"
 #endif
@@ -66,6 +67,7 @@
 #include "optimization/SteepestDescent.hpp"
 #include "optimization/ConjugateGradient.hpp"
 #include "optimization/BFGS.hpp"
+#include "optimization/FIRE.hpp"
 
 #include "lattice/LatticeFactory.hpp"
 #include "lattice/LatticeCreator.hpp"
@@ -90,6 +92,7 @@ namespace OpenMD {
     IntegratorFactory::getInstance()->registerIntegrator(new IntegratorBuilder<NgammaT>("NGAMMAT"));
     IntegratorFactory::getInstance()->registerIntegrator(new IntegratorBuilder<LangevinDynamics>("LANGEVINDYNAMICS"));
     IntegratorFactory::getInstance()->registerIntegrator(new IntegratorBuilder<LangevinDynamics>("LD"));
+    IntegratorFactory::getInstance()->registerIntegrator(new IntegratorBuilder<RESPA>("RESPA"));
 #if defined(HAVE_QHULL)
     IntegratorFactory::getInstance()->registerIntegrator(new IntegratorBuilder<LangevinHullDynamics>("LHULL"));
     IntegratorFactory::getInstance()->registerIntegrator(new IntegratorBuilder<LangevinHullDynamics>("LANGEVINHULL"));
@@ -101,6 +104,7 @@ namespace OpenMD {
     OptimizationFactory::getInstance()->registerOptimization(new OptimizationBuilder<QuantLib::SteepestDescent>("SD"));
     OptimizationFactory::getInstance()->registerOptimization(new OptimizationBuilder<QuantLib::ConjugateGradient>("CG"));
     OptimizationFactory::getInstance()->registerOptimization(new OptimizationBuilder<QuantLib::BFGS>("BFGS"));
+    OptimizationFactory::getInstance()->registerOptimization(new SimOptimizationBuilder<FIRE>("FIRE"));
   }
 
   void registerLattice(){
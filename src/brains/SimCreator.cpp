@@ -61,6 +61,7 @@
 #include "brains/SimCreator.hpp"
 #include "brains/SimSnapshotManager.hpp"
 #include "io/DumpReader.hpp"
+#include "io/Checkpoint.hpp"
 #include "brains/ForceField.hpp"
 #include "utils/simError.h"
 #include "utils/StringUtils.hpp"
@@ -408,44 +409,49 @@ namespace OpenMD {
     Globals* simParams = parseFile(rawMetaDataStream, mdFileName, mdFileVersion,
                                    metaDataBlockStart + 1);
     
-    //create the force field
-    ForceField * ff = new ForceField(simParams->getForceField());
+    //create the force field (unless one is being shared)
+    ForceField * ff = sharedForceField_;
 
     if (ff == NULL) {
-      sprintf(painCave.errMsg, 
-              "ForceField Factory can not create %s force field\n",
-              simParams->getForceField().c_str());
-      painCave.isFatal = 1;
-      simError();
-    }
+      ff = new ForceField(simParams->getForceField());
+
+      if (ff == NULL) {
+        sprintf(painCave.errMsg, 
+                "ForceField Factory can not create %s force field\n",
+                simParams->getForceField().c_str());
+        painCave.isFatal = 1;
+        simError();
+      }
     
-    if (simParams->haveForceFieldFileName()) {
-      ff->setForceFieldFileName(simParams->getForceFieldFileName());
-    }
+      if (simParams->haveForceFieldFileName()) {
+        ff->setForceFieldFileName(simParams->getForceFieldFileName());
+      }
     
-    std::string forcefieldFileName;
-    forcefieldFileName = ff->getForceFieldFileName();
+      std::string forcefieldFileName;
+      forcefieldFileName = ff->getForceFieldFileName();
     
-    if (simParams->haveForceFieldVariant()) {
-      //If the force field has variant, the variant force field name will be
-      //Base.variant.frc. For exampel EAM.u6.frc
+      if (simParams->haveForceFieldVariant()) {
+        //If the force field has variant, the variant force field name will be
+        //Base.variant.frc. For exampel EAM.u6.frc
       
-      std::string variant = simParams->getForceFieldVariant();
+        std::string variant = simParams->getForceFieldVariant();
       
-      std::string::size_type pos = forcefieldFileName.rfind(".frc");
-      variant = "." + variant;
-      if (pos != std::string::npos) {
-        forcefieldFileName.insert(pos, variant);
-      } else {
-        // If the default force field file name does not containt .frc suffix,
-        // just append the .variant
-        forcefieldFileName.append(variant);
-      }
-    } 
+        std::string::size_type pos = forcefieldFileName.rfind(".frc");
+        variant = "." + variant;
+        if (pos != std::string::npos) {
+          forcefieldFileName.insert(pos, variant);
+        } else {
+          // If the default force field file name does not containt .frc suffix,
+          // just append the .variant
+          forcefieldFileName.append(variant);
+        }
+      } 
     
-    ff->parse(forcefieldFileName);
+      ff->parse(forcefieldFileName);
+    }
     //create SimInfo
     SimInfo * info = new SimInfo(ff, simParams);
+    if (sharedForceField_ != NULL) info->setOwnsForceField(false);
 
     info->setRawMetaData(mdRawData);
      
@@ -515,6 +521,7 @@ namespace OpenMD {
       info->setStatFileName(prefix + ".stat");
       info->setReportFileName(prefix + ".report");
       info->setRestFileName(prefix + ".zang");
+      info->setCheckpointFileName(prefix + ".chk");
       
 #ifdef IS_MPI      
     }    
@@ -1014,6 +1021,16 @@ namespace OpenMD {
   
   void SimCreator::loadCoordinates(SimInfo* info,
                                    const std::string& mdFileName) {
+
+    Globals* simParams = info->getSimParams();
+    if (simParams->haveRestartCheckpoint()) {
+      // the checkpoint replaces the configuration in the .omd file:
+      Checkpoint checkpoint(info, simParams->getRestartCheckpoint());
+      checkpoint.readSnapshot();
+      //copy the current snapshot to previous snapshot
+      info->getSnapshotManager()->advance();
+      return;
+    }
     
     DumpReader reader(info, mdFileName);
     int nframes = reader.getNFrames();
@@ -68,6 +68,7 @@ namespace OpenMD {
   class SimCreator {
   public:
 
+    SimCreator() : sharedForceField_(NULL) {}
     virtual ~SimCreator() {}
 
     /**
@@ -77,8 +78,19 @@ namespace OpenMD {
      * @param loadInitCoords should the initial coordinates be loaded from a file?
      */
     SimInfo* createSim(const std::string & mdFileName, bool loadInitCoords = true);
+
+    /**
+     * Uses an already parsed force field for the systems created
+     * after this call instead of reading the force field file again.
+     * Those SimInfos do not delete the force field, so it must
+     * outlive them.
+     * @param ff the shared force field (NULL to go back to parsing)
+     */
+    void setSharedForceField(ForceField* ff) { sharedForceField_ = ff; }
         
   private:
+
+    ForceField* sharedForceField_;
         
     /**
      * Parses the meta-data file
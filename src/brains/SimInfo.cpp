@@ -58,6 +58,7 @@
 #include "math/Vector3.hpp"
 #include "primitives/Molecule.hpp"
 #include "primitives/StuntDouble.hpp"
+#include "brains/IntegrableObjectIndex.hpp"
 #include "utils/MemoryUtils.hpp"
 #include "utils/simError.h"
 #include "selection/SelectionManager.hpp"
@@ -69,7 +70,7 @@ using namespace std;
 namespace OpenMD {
   
   SimInfo::SimInfo(ForceField* ff, Globals* simParams) : 
-    forceField_(ff), simParams_(simParams), 
+    forceField_(ff), ownsForceField_(true), simParams_(simParams), 
     nAtoms_(0), nBonds_(0), nBends_(0), nTorsions_(0), nInversions_(0), 
     nRigidBodies_(0), nIntegrableObjects_(0), nCutoffGroups_(0), 
     nConstraints_(0), nFluctuatingCharges_(0),     
@@ -79,7 +80,7 @@ namespace OpenMD {
     nGlobalTorsions_(0), nGlobalInversions_(0), nGlobalConstraints_(0),
     hasNGlobalConstraints_(false),
     ndf_(0), fdf_local(0), ndfRaw_(0), ndfTrans_(0), nZconstraint_(0),
-    sman_(NULL), topologyDone_(false), calcBoxDipole_(false), 
+    sman_(NULL), ioIndex_(NULL), topologyDone_(false), calcBoxDipole_(false), 
     calcBoxQuadrupole_(false), useAtomicVirial_(true) {    
     
     MoleculeStamp* molStamp;
@@ -168,8 +169,9 @@ namespace OpenMD {
     molecules_.clear();
        
     delete sman_;
+    delete ioIndex_;
     delete simParams_;
-    delete forceField_;
+    if (ownsForceField_) delete forceField_;
   }
 
 
@@ -192,6 +194,7 @@ namespace OpenMD {
       nConstraints_ += mol->getNConstraintPairs();
       
       addInteractionPairs(mol);
+      if (ioIndex_) ioIndex_->invalidate();
       
       return true;
     } else {
@@ -199,6 +202,12 @@ namespace OpenMD {
     }
   }
   
+  IntegrableObjectIndex* SimInfo::getIntegrableObjectIndex() {
+    if (ioIndex_ == NULL) 
+      ioIndex_ = new IntegrableObjectIndex(this);
+    return ioIndex_;
+  }
+  
   bool SimInfo::removeMolecule(Molecule* mol) {
     MoleculeIterator i;
     i = molecules_.find(mol->getGlobalIndex());
@@ -219,6 +228,7 @@ namespace OpenMD {
 
       removeInteractionPairs(mol);
       molecules_.erase(mol->getGlobalIndex());
+      if (ioIndex_) ioIndex_->invalidate();
 
       delete mol;
         
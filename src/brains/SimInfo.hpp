@@ -72,6 +72,7 @@ namespace OpenMD{
   class Molecule;
   class SelectionManager;
   class StuntDouble;
+  class IntegrableObjectIndex;
 
   /**
    * @class SimInfo SimInfo.hpp "brains/SimInfo.hpp"
@@ -293,6 +294,10 @@ namespace OpenMD{
     SnapshotManager* getSnapshotManager() {
       return sman_;
     }
+
+    /** Returns the flat index of the local integrable objects */
+    IntegrableObjectIndex* getIntegrableObjectIndex();
+
     /** Returns the storage layout (computed by SimCreator) */
     int getStorageLayout() {
       return storageLayout_;
@@ -310,6 +315,14 @@ namespace OpenMD{
       return forceField_;
     }
 
+    /** 
+     * A force field shared by several SimInfos (see
+     * SimCreator::setSharedForceField) is left for its owner to delete.
+     */
+    void setOwnsForceField(bool owns) {
+      ownsForceField_ = owns;
+    }
+
     Globals* getSimParams() {
       return simParams_;
     }
@@ -418,6 +431,14 @@ namespace OpenMD{
       restFileName_ = fileName;
     }
 
+    string getCheckpointFileName() {
+      return checkpointFileName_;
+    }
+        
+    void setCheckpointFileName(const string& fileName) {
+      checkpointFileName_ = fileName;
+    }
+
     /** 
      * Sets GlobalGroupMembership
      */  
@@ -530,6 +551,7 @@ namespace OpenMD{
 
     // Other classes holdingn important information
     ForceField* forceField_; /**< provides access to defined atom types, bond types, etc. */
+    bool ownsForceField_;    /**< should forceField_ be deleted with this SimInfo? */
     Globals* simParams_;     /**< provides access to simulation parameters set by user */
 
     ///  Counts of local objects
@@ -661,6 +683,7 @@ namespace OpenMD{
 
     PropertyMap properties_;       /**< Generic Properties can be added */
     SnapshotManager* sman_;        /**< SnapshotManager (handles particle positions, etc.) */
+    IntegrableObjectIndex* ioIndex_; /**< flat index of the local integrable objects */
     int storageLayout_;            /**< Bits to tell how much data to store on each object */
 
     /** 
@@ -682,6 +705,7 @@ namespace OpenMD{
     string statFileName_;
     string reportFileName_;
     string restFileName_;
+    string checkpointFileName_;
 
     bool topologyDone_;  /** flag to indicate whether the topology has
                              been scanned and all the relevant
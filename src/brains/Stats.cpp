@@ -42,6 +42,7 @@
   
 #include "brains/Stats.hpp"
 #include "brains/Thermo.hpp"
+#include "utils/TimerRegistry.hpp"
 #include <sstream>
 #include <iomanip>
 
@@ -387,6 +388,22 @@ namespace OpenMD {
     data_[CHARGE_MOMENTUM] = chargeMomentum;
     statsMap_["CHARGE_MOMENTUM"] = CHARGE_MOMENTUM;
 
+    StatsData wallTime;
+    wallTime.units = "s";
+    wallTime.title =  "Wall Time";  
+    wallTime.dataType = "RealType";
+    wallTime.accumulator = new Accumulator();
+    data_[WALL_TIME] = wallTime;
+    statsMap_["WALL_TIME"] = WALL_TIME;
+
+    StatsData forceTime;
+    forceTime.units = "s";
+    forceTime.title =  "Force Time";  
+    forceTime.dataType = "RealType";
+    forceTime.accumulator = new Accumulator();
+    data_[FORCE_TIME] = forceTime;
+    statsMap_["FORCE_TIME"] = FORCE_TIME;
+
     // Now, set some defaults in the mask:
 
     Globals* simParams = info_->getSimParams();
@@ -614,6 +631,12 @@ namespace OpenMD {
         case CHARGE_MOMENTUM:
           dynamic_cast<Accumulator *>(data_[i].accumulator)->add(thermo.getChargeMomentum());
           break; 
+        case WALL_TIME:
+          dynamic_cast<Accumulator *>(data_[i].accumulator)->add(TimerRegistry::getInstance()->getWallTime());
+          break; 
+        case FORCE_TIME:
+          dynamic_cast<Accumulator *>(data_[i].accumulator)->add(TimerRegistry::getInstance()->getTime("Force"));
+          break; 
 
           /*
             case SHADOWH:
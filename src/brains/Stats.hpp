@@ -99,6 +99,8 @@ namespace OpenMD {
       POTENTIAL_SELECTION,
       NET_CHARGE,
       CHARGE_MOMENTUM,
+      WALL_TIME,
+      FORCE_TIME,
       ENDINDEX  //internal use
     };
 
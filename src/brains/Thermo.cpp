@@ -48,6 +48,7 @@
 #include <iostream>
 
 #include "brains/Thermo.hpp"
+#include "brains/IntegrableObjectIndex.hpp"
 #include "primitives/Molecule.hpp"
 #include "utils/simError.h"
 #include "utils/Constants.hpp"
@@ -65,90 +66,58 @@ namespace OpenMD {
   RealType Thermo::getTranslationalKinetic() {
     Snapshot* snap = info_->getSnapshotManager()->getCurrentSnapshot();
 
-    if (!snap->hasTranslationalKineticEnergy) {
-      SimInfo::MoleculeIterator miter;
-      vector<StuntDouble*>::iterator iiter;
-      Molecule* mol;
-      StuntDouble* sd;    
-      Vector3d vel;
-      RealType mass;
-      RealType kinetic(0.0);
-      
-      for (mol = info_->beginMolecule(miter); mol != NULL; 
-           mol = info_->nextMolecule(miter)) {
-        
-        for (sd = mol->beginIntegrableObject(iiter); sd != NULL; 
-             sd = mol->nextIntegrableObject(iiter)) {
-          
-          mass = sd->getMass();
-          vel = sd->getVel();
-          
-          kinetic += mass * (vel[0]*vel[0] + vel[1]*vel[1] + vel[2]*vel[2]);
-          
-        }
-      }
-      
-#ifdef IS_MPI
-      MPI_Allreduce(MPI_IN_PLACE, &kinetic, 1, MPI_REALTYPE, 
-                    MPI_SUM, MPI_COMM_WORLD);
-#endif
-      
-      kinetic = kinetic * 0.5 / Constants::energyConvert;
-      
-      
-      snap->setTranslationalKineticEnergy(kinetic);
-    }
+    if (!snap->hasTranslationalKineticEnergy) computeKinetic();
+
     return snap->getTranslationalKineticEnergy();
   }
 
   RealType Thermo::getRotationalKinetic() {
     Snapshot* snap = info_->getSnapshotManager()->getCurrentSnapshot();
 
-    if (!snap->hasRotationalKineticEnergy) {
-      SimInfo::MoleculeIterator miter;
-      vector<StuntDouble*>::iterator iiter;
-      Molecule* mol;
-      StuntDouble* sd;    
-      Vector3d angMom;
-      Mat3x3d I;
-      int i, j, k;
-      RealType kinetic(0.0);
+    if (!snap->hasRotationalKineticEnergy) computeKinetic();
+
+    return snap->getRotationalKineticEnergy();
+  }
+
+  /**
+   * Computes the translational and rotational kinetic energies in a
+   * single pass over the integrable object arrays in the snapshot.
+   */
+  void Thermo::computeKinetic() {
+    Snapshot* snap = info_->getSnapshotManager()->getCurrentSnapshot();
+    IntegrableObjectIndex* ioIndex = info_->getIntegrableObjectIndex();
+    RealType kinetic[2] = {0.0, 0.0};
+    
+    for (int t = 0; t < IntegrableObjectIndex::ioNSpanTypes; t++) {
+      IntegrableObjectIndex::Span& span = ioIndex->getSpan(t);
+      DataStorage& data = snap->*(span.storage);
       
-      for (mol = info_->beginMolecule(miter); mol != NULL; 
-           mol = info_->nextMolecule(miter)) {
+      for (int n = 0; n < span.size(); n++) {
+        int idx = span.localIndex[n];
+        const Vector3d& vel = data.velocity[idx];
         
-        for (sd = mol->beginIntegrableObject(iiter); sd != NULL; 
-             sd = mol->nextIntegrableObject(iiter)) {
-          
-          if (sd->isDirectional()) {
-            angMom = sd->getJ();
-            I = sd->getI();
-            
-            if (sd->isLinear()) {
-              i = sd->linearAxis();
-              j = (i + 1) % 3;
-              k = (i + 2) % 3;
-              kinetic += angMom[j] * angMom[j] / I(j, j) 
-                + angMom[k] * angMom[k] / I(k, k);
-            } else {                        
-              kinetic += angMom[0]*angMom[0]/I(0, 0) 
-                + angMom[1]*angMom[1]/I(1, 1) 
-                + angMom[2]*angMom[2]/I(2, 2);
-            }
-          }           
+        kinetic[0] += span.mass[n] * 
+          (vel[0]*vel[0] + vel[1]*vel[1] + vel[2]*vel[2]);
+        
+        if (span.directional) {
+          const Vector3d& angMom = data.angularMomentum[idx];
+          const Vector3d& invI = span.invI[n];
+          kinetic[1] += angMom[0]*angMom[0]*invI[0] 
+            + angMom[1]*angMom[1]*invI[1] 
+            + angMom[2]*angMom[2]*invI[2];
         }
       }
+    }
       
 #ifdef IS_MPI
-      MPI_Allreduce(MPI_IN_PLACE, &kinetic, 1, MPI_REALTYPE, 
-                    MPI_SUM, MPI_COMM_WORLD);
+    MPI_Allreduce(MPI_IN_PLACE, kinetic, 2, MPI_REALTYPE, 
+                  MPI_SUM, MPI_COMM_WORLD);
 #endif
-      
-      kinetic = kinetic * 0.5 / Constants::energyConvert;
-           
-      snap->setRotationalKineticEnergy(kinetic);
-    }
-    return snap->getRotationalKineticEnergy();
+    
+    snap->setTranslationalKineticEnergy(kinetic[0] * 0.5 / 
+                                        Constants::energyConvert);
+    snap->setRotationalKineticEnergy(kinetic[1] * 0.5 / 
+                                     Constants::energyConvert);
   }
 
       
@@ -690,18 +659,18 @@ namespace OpenMD {
 
     if (!snap->hasCOMvel) {
 
-      SimInfo::MoleculeIterator i;
-      Molecule* mol;
-      
+      IntegrableObjectIndex* ioIndex = info_->getIntegrableObjectIndex();
       Vector3d comVel(0.0);
       RealType totalMass(0.0);
       
-      for (mol = info_->beginMolecule(i); mol != NULL; 
-           mol = info_->nextMolecule(i)) {
-        RealType mass = mol->getMass();
-        totalMass += mass;
-        comVel += mass * mol->getComVel();
-      }  
+      for (int t = 0; t < IntegrableObjectIndex::ioNSpanTypes; t++) {
+        IntegrableObjectIndex::Span& span = ioIndex->getSpan(t);
+        DataStorage& data = snap->*(span.storage);
+        for (int n = 0; n < span.size(); n++) {
+          totalMass += span.mass[n];
+          comVel += span.mass[n] * data.velocity[span.localIndex[n]];
+        }
+      }
       
 #ifdef IS_MPI
       MPI_Allreduce(MPI_IN_PLACE, &totalMass, 1, MPI_REALTYPE, 
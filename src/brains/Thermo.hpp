@@ -122,6 +122,8 @@ namespace OpenMD {
     RealType getTaggedAtomPairDistance();
     
   private:    
+    void computeKinetic();
+
     SimInfo* info_;
   };
   
@@ -40,8 +40,13 @@
  * [5]  Vardeman, Stocker & Gezelter, J. Chem. Theory Comput. 7, 834 (2011).
  */
 
+#ifdef IS_MPI
+#include <mpi.h>
+#endif
+
 #include "brains/Velocitizer.hpp"
 #include "brains/Thermo.hpp"
+#include "brains/IntegrableObjectIndex.hpp"
 #include "math/SquareMatrix3.hpp"
 #include "utils/Constants.hpp"
 #include "primitives/Molecule.hpp"
@@ -82,31 +87,36 @@ namespace OpenMD {
   }
 
   void Velocitizer::scale(RealType lambda) {
-    SimInfo::MoleculeIterator mi;
-    Molecule::IntegrableObjectIterator ioi;
-    Molecule * mol;
-    StuntDouble * sd;
-    Vector3d v, j;
-    
-    for( mol = info_->beginMolecule(mi); mol != NULL;
-	 mol = info_->nextMolecule(mi) ) {
-      
-      for( sd = mol->beginIntegrableObject(ioi); sd != NULL;
-	   sd = mol->nextIntegrableObject(ioi) ) {
+    Snapshot* snap = info_->getSnapshotManager()->getCurrentSnapshot();
+    IntegrableObjectIndex* ioIndex = info_->getIntegrableObjectIndex();
+
+    // scale the velocities and accumulate the momentum in the same
+    // pass, so the drift can be removed without another reduction
+    // sweep:
+    RealType mp[4] = {0.0, 0.0, 0.0, 0.0};
+
+    for (int t = 0; t < IntegrableObjectIndex::ioNSpanTypes; t++) {
+      IntegrableObjectIndex::Span& span = ioIndex->getSpan(t);
+      DataStorage& data = snap->*(span.storage);
 
-	v = sd->getVel();	
+      for (int n = 0; n < span.size(); n++) {
+        int idx = span.localIndex[n];
+        Vector3d& v = data.velocity[idx];
         v *= lambda;
-	sd->setVel(v);
+        mp[0] += span.mass[n] * v[0];
+        mp[1] += span.mass[n] * v[1];
+        mp[2] += span.mass[n] * v[2];
+        mp[3] += span.mass[n];
 
-	if (sd->isDirectional()) {
-          j = sd->getJ();
-          j *= lambda;
-	  sd->setJ(j);
-	}	
+        if (span.directional) data.angularMomentum[idx] *= lambda;
       }
     }
-    
-    removeComDrift();
+
+#ifdef IS_MPI
+    MPI_Allreduce(MPI_IN_PLACE, mp, 4, MPI_REALTYPE, MPI_SUM, MPI_COMM_WORLD);
+#endif
+
+    subtractDrift(Vector3d(mp[0], mp[1], mp[2]) / mp[3]);
     
     // Remove angular drift if we are not using periodic boundary
     // conditions:
@@ -189,23 +199,20 @@ namespace OpenMD {
     // Get the Center of Mass drift velocity.
     Vector3d vdrift = thermo_.getComVel();
     
-    SimInfo::MoleculeIterator mi;
-    Molecule::IntegrableObjectIterator ioi;
-    Molecule * mol;
-    StuntDouble * sd;
-    
     //  Corrects for the center of mass drift.
-    // sums all the momentum and divides by total mass.
-    for( mol = info_->beginMolecule(mi); mol != NULL;
-         mol = info_->nextMolecule(mi) ) {
+    subtractDrift(vdrift);
+  }
 
-      for( sd = mol->beginIntegrableObject(ioi); sd != NULL;
-	   sd = mol->nextIntegrableObject(ioi) ) {
-        
-	sd->setVel(sd->getVel() - vdrift);
+  void Velocitizer::subtractDrift(const Vector3d& vdrift) {
+    Snapshot* snap = info_->getSnapshotManager()->getCurrentSnapshot();
+    IntegrableObjectIndex* ioIndex = info_->getIntegrableObjectIndex();
 
-      }
-    }    
+    for (int t = 0; t < IntegrableObjectIndex::ioNSpanTypes; t++) {
+      IntegrableObjectIndex::Span& span = ioIndex->getSpan(t);
+      DataStorage& data = snap->*(span.storage);
+      for (int n = 0; n < span.size(); n++) 
+        data.velocity[span.localIndex[n]] -= vdrift;
+    }
   }
     
   void Velocitizer::removeAngularDrift() {
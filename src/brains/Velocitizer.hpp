@@ -84,8 +84,15 @@ namespace OpenMD {
      * non-periodic simulations).
      */
     void removeAngularDrift();
+
+    /** Writes the state of the random number stream */
+    void saveState(std::ostream& os) { randNumGen_->saveState(os); }
+    /** Restores the random number stream written by saveState */
+    void loadState(std::istream& is) { randNumGen_->loadState(is); }
         
   private:        
+    void subtractDrift(const Vector3d& vdrift);
+
     SimInfo* info_;
     Globals* globals_;
     Thermo thermo_;
@@ -12,6 +12,11 @@
 /* Is defined if OpenMD should be compiled with single precision arithmetic. */
 #cmakedefine SINGLE_PRECISION
 
+/* Is defined if the pair force kernels should be compiled in single
+   precision while positions, forces, energies and the virial are
+   accumulated in double precision. */
+#cmakedefine MIXED_PRECISION
+
 #ifdef _MSC_VER
 #define _USE_MATH_DEFINES
 #pragma warning( disable : 4996 )
@@ -37,6 +42,9 @@
 /* have <conio.h> */
 #cmakedefine HAVE_CONIO_H 1
 
+/* have <linux/perf_event.h> */
+#cmakedefine HAVE_LINUX_PERF_EVENT_H 1
+
 /* have symbol strncasecmp */
 #cmakedefine HAVE_STRNCASECMP 1
 
@@ -87,4 +95,11 @@ typedef double RealType;
 #endif
 #endif
 
+/* PairRealType is the precision used inside the pair force kernels. */
+#if defined(MIXED_PRECISION) && !defined(SINGLE_PRECISION)
+typedef float PairRealType;
+#else
+typedef RealType PairRealType;
+#endif
+
 #endif // __CONFIG_H
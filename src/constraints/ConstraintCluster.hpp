@@ -0,0 +1,187 @@
+/*
+ * Copyright (c) 2018 The University of Notre Dame. All Rights Reserved.
+ *
+ * The University of Notre Dame grants you ("Licensee") a
+ * non-exclusive, royalty free, license to use, modify and
+ * redistribute this software in source and binary code form, provided
+ * that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the
+ *    distribution.
+ *
+ * This software is provided "AS IS," without a warranty of any
+ * kind. All express or implied conditions, representations and
+ * warranties, including any implied warranty of merchantability,
+ * fitness for a particular purpose or non-infringement, are hereby
+ * excluded.  The University of Notre Dame and its licensors shall not
+ * be liable for any damages suffered by licensee as a result of
+ * using, modifying or distributing the software or its
+ * derivatives. In no event will the University of Notre Dame or its
+ * licensors be liable for any lost revenue, profit or data, or for
+ * direct, indirect, special, consequential, incidental or punitive
+ * damages, however caused and regardless of the theory of liability,
+ * arising out of the use of or inability to use software, even if the
+ * University of Notre Dame has been advised of the possibility of
+ * such damages.
+ *
+ * SUPPORT OPEN SCIENCE!  If you use OpenMD or its source code in your
+ * research, please cite the appropriate papers when you publish your
+ * work.  Good starting points are:
+ *                                                                      
+ * [1]  Meineke, et al., J. Comp. Chem. 26, 252-271 (2005).             
+ * [2]  Fennell & Gezelter, J. Chem. Phys. 124, 234104 (2006).          
+ * [3]  Sun, Lin & Gezelter, J. Chem. Phys. 128, 234107 (2008).          
+ * [4]  Kuang & Gezelter,  J. Chem. Phys. 133, 164101 (2010).
+ * [5]  Vardeman, Stocker & Gezelter, J. Chem. Theory Comput. 7, 834 (2011).
+ */
+ 
+
+#ifndef CONSTRAINTS_CONSTRAINTCLUSTER_HPP
+#define CONSTRAINTS_CONSTRAINTCLUSTER_HPP
+
+#include <vector>
+#include <cmath>
+#include "constraints/ConstraintPair.hpp"
+
+namespace OpenMD {
+
+  /**
+   * @class ConstraintCluster ConstraintCluster.hpp "constraints/ConstraintCluster.hpp"
+   * A set of constraint pairs which are coupled through shared
+   * elements.  Each cluster is solved by one of three methods:
+   *
+   *  - ccIterative: the usual pair-by-pair RATTLE sweep (single
+   *    pairs, small chains, or clusters too large for a dense solve)
+   *  - ccTriangle: an analytic SETTLE solution for a rigid triangle
+   *    with an apex and two equal-mass, equidistant base sites (water)
+   *  - ccMatrix: a Newton iteration on the coupled Lagrange
+   *    multipliers of the whole cluster (M-SHAKE / LINCS-like)
+   */
+  class ConstraintCluster {
+  public:
+    enum ClusterType {
+      ccIterative,
+      ccTriangle,
+      ccMatrix
+    };
+
+    /** largest cluster that is handed to the dense matrix solver */
+    enum { maxMatrixPairs = 64 };
+
+    ConstraintCluster() : type_(ccIterative), apex_(-1), ra_(0.0),
+                          rb_(0.0), rc_(0.0) {}
+
+    /** adds a constraint pair, registering any new elements */
+    void addConstraintPair(ConstraintPair* cp) {
+      pairs_.push_back(cp);
+      first_.push_back(addElem(cp->getConsElem1()->getStuntDouble()));
+      second_.push_back(addElem(cp->getConsElem2()->getStuntDouble()));
+    }
+
+    ClusterType getType() { return type_; }
+    void setType(ClusterType type) { type_ = type; }
+
+    int getNConstraintPairs() { return pairs_.size(); }
+    int getNElems() { return sds_.size(); }
+
+    ConstraintPair* getConstraintPair(int k) { return pairs_[k]; }
+    StuntDouble* getStuntDouble(int e) { return sds_[e]; }
+    /** index of the first element of constraint pair k */
+    int getFirst(int k) { return first_[k]; }
+    /** index of the second element of constraint pair k */
+    int getSecond(int k) { return second_[k]; }
+
+    std::vector<ConstraintPair*>::iterator beginPairs() { return pairs_.begin(); }
+    std::vector<ConstraintPair*>::iterator endPairs() { return pairs_.end(); }
+
+    /**
+     * Tests whether this cluster is a triangle that can be solved
+     * with SETTLE, and if it is, stores the canonical geometry.  The
+     * apex must be equidistant from the two base sites, and the
+     * base sites must have equal masses.
+     */
+    bool setupTriangle() {
+      if (pairs_.size() != 3 || sds_.size() != 3) return false;
+
+      for (int a = 0; a < 3; a++) {
+        int b = (a + 1) % 3;
+        int c = (a + 2) % 3;
+        RealType dab2 = getConsDistSquare(a, b);
+        RealType dac2 = getConsDistSquare(a, c);
+        RealType dbc2 = getConsDistSquare(b, c);
+        if (dab2 <= 0.0 || dac2 <= 0.0 || dbc2 <= 0.0) return false;
+
+        RealType dab = std::sqrt(dab2);
+        RealType dac = std::sqrt(dac2);
+        RealType dbc = std::sqrt(dbc2);
+        RealType mb = sds_[b]->getMass();
+        RealType mc = sds_[c]->getMass();
+
+        if (std::fabs(dab - dac) <= 1.0e-8 * dab && dbc < 2.0 * dab &&
+            std::fabs(mb - mc) <= 1.0e-8 * mb) {
+          RealType ma = sds_[a]->getMass();
+          RealType mt = ma + mb + mc;
+          apex_ = a;
+          rc_ = 0.5 * dbc;
+          RealType h = std::sqrt(dab * dab - rc_ * rc_);
+          ra_ = 2.0 * mb * h / mt;
+          rb_ = h - ra_;
+          return true;
+        }
+      }
+      return false;
+    }
+
+    /** index of the apex element of a SETTLE triangle */
+    int getApex() { return apex_; }
+    /** distance from the center of mass to the apex */
+    RealType getRa() { return ra_; }
+    /** distance from the center of mass to the base */
+    RealType getRb() { return rb_; }
+    /** half of the base length */
+    RealType getRc() { return rc_; }
+
+    /** constraint pair index joining elements e1 and e2, or -1 */
+    int findPair(int e1, int e2) {
+      for (unsigned int k = 0; k < pairs_.size(); k++) {
+        if ((first_[k] == e1 && second_[k] == e2) ||
+            (first_[k] == e2 && second_[k] == e1))
+          return k;
+      }
+      return -1;
+    }
+
+  private:
+    int addElem(StuntDouble* sd) {
+      for (unsigned int e = 0; e < sds_.size(); e++)
+        if (sds_[e] == sd) return e;
+      sds_.push_back(sd);
+      return sds_.size() - 1;
+    }
+
+    RealType getConsDistSquare(int e1, int e2) {
+      int k = findPair(e1, e2);
+      return (k < 0) ? -1.0 : pairs_[k]->getConsDistSquare();
+    }
+
+    ClusterType type_;
+    std::vector<ConstraintPair*> pairs_;
+    std::vector<StuntDouble*> sds_;
+    std::vector<int> first_;
+    std::vector<int> second_;
+
+    // SETTLE geometry
+    int apex_;
+    RealType ra_;
+    RealType rb_;
+    RealType rc_;
+  };
+
+}
+
+#endif
@@ -43,6 +43,9 @@
 #include "constraints/Rattle.hpp"
 #include "primitives/Molecule.hpp"
 #include "utils/simError.h"
+#include "utils/TimerRegistry.hpp"
+#include "math/DynamicRectMatrix.hpp"
+#include "math/LU.hpp"
 #include <cmath>
 #ifdef IS_MPI
 #include <mpi.h>
@@ -94,10 +97,18 @@ namespace OpenMD {
 
   void Rattle::constraintA() {
     if (!doRattle_) return;
+    static int timer = 
+      TimerRegistry::getInstance()->getTimerID("Integrate/Constraints");
+    ScopedTimer scope(timer);
+    doClusterConstraints(true);
     doConstraint(&Rattle::constraintPairA);
   }
   void Rattle::constraintB() {
     if (!doRattle_) return;    
+    static int timer = 
+      TimerRegistry::getInstance()->getTimerID("Integrate/Constraints");
+    ScopedTimer scope(timer);
+    doClusterConstraints(false);
     doConstraint(&Rattle::constraintPairB);
 
     if (currentSnapshot_->getTime() >= currConstraintTime_){
@@ -127,7 +138,9 @@ namespace OpenMD {
     ConstraintElem* consElem;
     Molecule::ConstraintElemIterator cei;
     ConstraintPair* consPair;
-    Molecule::ConstraintPairIterator cpi;
+    ConstraintCluster* cluster;
+    Molecule::ConstraintClusterIterator cci;
+    std::vector<ConstraintPair*>::iterator cpi;
 
     for (mol = info_->beginMolecule(mi); mol != NULL; 
          mol = info_->nextMolecule(mi)) {
@@ -136,10 +149,6 @@ namespace OpenMD {
 	consElem->setMoved(true);
 	consElem->setMoving(false);       
       }
-      for (consPair = mol->beginConstraintPair(cpi); consPair != NULL; 
-           consPair = mol->nextConstraintPair(cpi)) {
-        consPair->resetConstraintForce();
-      }
     }
     
     //main loop of constraint algorithm
@@ -152,8 +161,15 @@ namespace OpenMD {
 
       for (mol = info_->beginMolecule(mi); mol != NULL; 
            mol = info_->nextMolecule(mi)) {
-	for (consPair = mol->beginConstraintPair(cpi); consPair != NULL; 
-             consPair = mol->nextConstraintPair(cpi)) {
+        for (cluster = mol->beginConstraintCluster(cci); cluster != NULL;
+             cluster = mol->nextConstraintCluster(cci)) {
+
+          // clusters with a direct solver were handled in
+          // doClusterConstraints:
+          if (cluster->getType() != ConstraintCluster::ccIterative) continue;
+
+	for (cpi = cluster->beginPairs(); cpi != cluster->endPairs(); ++cpi) {
+          consPair = *cpi;
 
 	  //dispatch constraint algorithm
 	  if(consPair->isMoved()) {
@@ -187,6 +203,7 @@ namespace OpenMD {
 	    }      
 	  }
 	}
+        }
       }//end for(iter->first())
 
 #ifdef IS_MPI
@@ -218,6 +235,342 @@ namespace OpenMD {
     errorCheckPoint();
   }
 
+  void Rattle::doClusterConstraints(bool positionStep) {
+    Molecule* mol;
+    SimInfo::MoleculeIterator mi;
+    ConstraintPair* consPair;
+    Molecule::ConstraintPairIterator cpi;
+    ConstraintCluster* cluster;
+    Molecule::ConstraintClusterIterator cci;
+
+    for (mol = info_->beginMolecule(mi); mol != NULL; 
+         mol = info_->nextMolecule(mi)) {
+      for (consPair = mol->beginConstraintPair(cpi); consPair != NULL; 
+           consPair = mol->nextConstraintPair(cpi)) {
+        consPair->resetConstraintForce();
+      }
+
+      for (cluster = mol->beginConstraintCluster(cci); cluster != NULL;
+           cluster = mol->nextConstraintCluster(cci)) {
+        switch(cluster->getType()) {
+        case ConstraintCluster::ccTriangle:
+          if (positionStep) 
+            settleA(cluster);
+          else
+            matrixB(cluster);
+          break;
+        case ConstraintCluster::ccMatrix:
+          if (positionStep) 
+            matrixA(cluster);
+          else
+            matrixB(cluster);
+          break;
+        default:
+          break;
+        }
+      }
+    }
+  }
+
+  void Rattle::clusterFailure(const char* method) {
+    sprintf(painCave.errMsg,
+            "Constraint failure in Rattle::%s, Constraint Fail\n", method);
+    painCave.isFatal = 1;
+    simError();
+  }
+
+  /**
+   * Analytic position constraint for a rigid triangle (SETTLE),
+   * following Miyamoto and Kollman, J. Comp. Chem. 13, 952 (1992).
+   * The unconstrained triangle is rotated about its center of mass
+   * into the canonical geometry so that the bonds are parallel to the
+   * bonds of the previous (constrained) configuration.
+   */
+  void Rattle::settleA(ConstraintCluster* cluster) {
+    int ia = cluster->getApex();
+    int ib = (ia + 1) % 3;
+    int ic = (ia + 2) % 3;
+    StuntDouble* sdA = cluster->getStuntDouble(ia);
+    StuntDouble* sdB = cluster->getStuntDouble(ib);
+    StuntDouble* sdC = cluster->getStuntDouble(ic);
+
+    RealType mA = sdA->getMass();
+    RealType mB = sdB->getMass();
+    RealType mC = sdC->getMass();
+    RealType ra = cluster->getRa();
+    RealType rb = cluster->getRb();
+    RealType rc = cluster->getRc();
+
+    // previous configuration, relative to the apex:
+    Vector3d prevA = sdA->getPrevPos();
+    Vector3d b0 = sdB->getPrevPos() - prevA;
+    Vector3d c0 = sdC->getPrevPos() - prevA;
+    currentSnapshot_->wrapVector(b0);
+    currentSnapshot_->wrapVector(c0);
+
+    // unconstrained configuration, relative to its center of mass:
+    Vector3d nb = sdB->getPos() - sdA->getPos();
+    Vector3d nc = sdC->getPos() - sdA->getPos();
+    currentSnapshot_->wrapVector(nb);
+    currentSnapshot_->wrapVector(nc);
+    Vector3d com = (mB * nb + mC * nc) / (mA + mB + mC);
+    Vector3d a1 = -com;
+    Vector3d b1 = nb - com;
+    Vector3d c1 = nc - com;
+
+    // frame with z normal to the previous plane and x perpendicular
+    // to the apex direction:
+    Vector3d ez = cross(b0, c0);
+    Vector3d ex = cross(a1, ez);
+    Vector3d ey = cross(ez, ex);
+    ex.normalize();
+    ey.normalize();
+    ez.normalize();
+
+    RealType xb0d = dot(ex, b0);
+    RealType yb0d = dot(ey, b0);
+    RealType xc0d = dot(ex, c0);
+    RealType yc0d = dot(ey, c0);
+    RealType za1d = dot(ez, a1);
+    RealType xb1d = dot(ex, b1);
+    RealType yb1d = dot(ey, b1);
+    RealType zb1d = dot(ez, b1);
+    RealType xc1d = dot(ex, c1);
+    RealType yc1d = dot(ey, c1);
+    RealType zc1d = dot(ez, c1);
+
+    RealType sinphi = za1d / ra;
+    RealType tmp = 1.0 - sinphi * sinphi;
+    if (tmp <= 0.0) clusterFailure("settleA");
+    RealType cosphi = sqrt(tmp);
+    RealType sinpsi = (zb1d - zc1d) / (2.0 * rc * cosphi);
+    tmp = 1.0 - sinpsi * sinpsi;
+    if (tmp <= 0.0) clusterFailure("settleA");
+    RealType cospsi = sqrt(tmp);
+
+    RealType ya2d = ra * cosphi;
+    RealType xb2d = -rc * cospsi;
+    RealType t1 = -rb * cosphi;
+    RealType t2 = rc * sinpsi * sinphi;
+    RealType yb2d = t1 - t2;
+    RealType yc2d = t1 + t2;
+
+    RealType alpha = xb2d * (xb0d - xc0d) + yb0d * yb2d + yc0d * yc2d;
+    RealType beta = xb2d * (yc0d - yb0d) + xb0d * yb2d + xc0d * yc2d;
+    RealType gamma = xb0d * yb1d - xb1d * yb0d + xc0d * yc1d - xc1d * yc0d;
+    RealType al2be2 = alpha * alpha + beta * beta;
+    tmp = al2be2 - gamma * gamma;
+    if (tmp <= 0.0) clusterFailure("settleA");
+    RealType sinthe = (alpha * gamma - beta * sqrt(tmp)) / al2be2;
+    RealType costhe = sqrt(1.0 - sinthe * sinthe);
+
+    Vector3d a3 = ex * (-ya2d * sinthe) + ey * (ya2d * costhe) + ez * za1d;
+    Vector3d b3 = ex * (xb2d * costhe - yb2d * sinthe) + 
+      ey * (xb2d * sinthe + yb2d * costhe) + ez * zb1d;
+    Vector3d c3 = ex * (-xb2d * costhe - yc2d * sinthe) + 
+      ey * (-xb2d * sinthe + yc2d * costhe) + ez * zc1d;
+
+    // displacements applied to each site by the constraints:
+    Vector3d disp[3];
+    disp[ia] = a3 - a1;
+    disp[ib] = b3 - b1;
+    disp[ic] = c3 - c1;
+
+    for (int e = 0; e < 3; e++) {
+      StuntDouble* sd = cluster->getStuntDouble(e);
+      sd->setPos(sd->getPos() + disp[e]);
+      sd->setVel(sd->getVel() + disp[e] / dt_);
+    }
+
+    // recover the multipliers, m_i d_i = sum_k c_ik g_k r_k, by least
+    // squares on the previous bond vectors:
+    Vector3d rk[3];
+    for (int k = 0; k < 3; k++) {
+      rk[k] = cluster->getStuntDouble(cluster->getFirst(k))->getPrevPos() - 
+        cluster->getStuntDouble(cluster->getSecond(k))->getPrevPos();
+      currentSnapshot_->wrapVector(rk[k]);
+    }
+
+    Mat3x3d A(0.0);
+    Vector3d rhs(0.0);
+    for (int k = 0; k < 3; k++) {
+      int fk = cluster->getFirst(k);
+      int sk = cluster->getSecond(k);
+      RealType mf = cluster->getStuntDouble(fk)->getMass();
+      RealType ms = cluster->getStuntDouble(sk)->getMass();
+      rhs[k] = dot(rk[k], mf * disp[fk] - ms * disp[sk]);
+      for (int l = 0; l < 3; l++) {
+        RealType c = (fk == cluster->getFirst(l)) - (fk == cluster->getSecond(l))
+          - (sk == cluster->getFirst(l)) + (sk == cluster->getSecond(l));
+        A(k, l) = c * dot(rk[k], rk[l]);
+      }
+    }
+    Vector3d g = A.inverse() * rhs;
+
+    for (int k = 0; k < 3; k++) {
+      cluster->getConstraintPair(k)->addConstraintForce(2.0 * g[k] * 
+                                                         rk[k].length() /
+                                                         (dt_ * dt_));
+    }
+  }
+
+  /**
+   * Position constraints for a coupled cluster, solved by Newton
+   * iteration on the Lagrange multipliers of all pairs at once
+   * (M-SHAKE).  Each iteration solves the linearized system
+   * 2 C_kl (s_k . r_l) g_l = d_k^2 - s_k^2 with the previous bond
+   * vectors r_l and the current bond vectors s_k.
+   */
+  void Rattle::matrixA(ConstraintCluster* cluster) {
+    int nPairs = cluster->getNConstraintPairs();
+    int nElems = cluster->getNElems();
+
+    std::vector<Vector3d> pos(nElems);
+    std::vector<Vector3d> disp(nElems, V3Zero);
+    std::vector<RealType> rm(nElems);
+    for (int e = 0; e < nElems; e++) {
+      StuntDouble* sd = cluster->getStuntDouble(e);
+      pos[e] = sd->getPos();
+      rm[e] = 1.0 / sd->getMass();
+    }
+
+    std::vector<Vector3d> rk(nPairs);
+    std::vector<Vector3d> sk(nPairs);
+    std::vector<RealType> gTotal(nPairs, 0.0);
+    for (int k = 0; k < nPairs; k++) {
+      rk[k] = cluster->getStuntDouble(cluster->getFirst(k))->getPrevPos() - 
+        cluster->getStuntDouble(cluster->getSecond(k))->getPrevPos();
+      currentSnapshot_->wrapVector(rk[k]);
+    }
+
+    DynamicRectMatrix<RealType> A(nPairs, nPairs);
+    DynamicRectMatrix<RealType> AI(nPairs, nPairs);
+    DynamicVector<RealType> rhs(nPairs);
+
+    bool done = false;
+    int iteration = 0;
+    while (!done && iteration < maxConsIteration_) {
+      done = true;
+      for (int k = 0; k < nPairs; k++) {
+        sk[k] = pos[cluster->getFirst(k)] - pos[cluster->getSecond(k)];
+        currentSnapshot_->wrapVector(sk[k]);
+        RealType d2 = cluster->getConstraintPair(k)->getConsDistSquare();
+        rhs[k] = d2 - sk[k].lengthSquare();
+        if (fabs(rhs[k]) > consTolerance_ * d2 * 2.0) done = false;
+      }
+      if (done) break;
+
+      for (int k = 0; k < nPairs; k++) {
+        int fk = cluster->getFirst(k);
+        int sk2 = cluster->getSecond(k);
+        for (int l = 0; l < nPairs; l++) {
+          int fl = cluster->getFirst(l);
+          int sl = cluster->getSecond(l);
+          RealType c = ((fk == fl) - (fk == sl)) * rm[fk] 
+            - ((sk2 == fl) - (sk2 == sl)) * rm[sk2];
+          A(k, l) = 2.0 * c * dot(sk[k], rk[l]);
+        }
+      }
+      if (!invertMatrix(A, AI)) clusterFailure("matrixA");
+
+      for (int k = 0; k < nPairs; k++) {
+        RealType g = 0.0;
+        for (int l = 0; l < nPairs; l++) g += AI(k, l) * rhs[l];
+        gTotal[k] += g;
+        Vector3d delta = rk[k] * g;
+        int fk = cluster->getFirst(k);
+        int sk2 = cluster->getSecond(k);
+        pos[fk] += rm[fk] * delta;
+        disp[fk] += rm[fk] * delta;
+        pos[sk2] -= rm[sk2] * delta;
+        disp[sk2] -= rm[sk2] * delta;
+      }
+      iteration++;
+    }
+
+    if (!done) {
+      sprintf(painCave.errMsg,
+              "Constraint failure in Rattle::matrixA, "
+              "too many iterations: %d\n", iteration);
+      painCave.isFatal = 1;
+      simError();    
+    }
+
+    for (int e = 0; e < nElems; e++) {
+      StuntDouble* sd = cluster->getStuntDouble(e);
+      sd->setPos(pos[e]);
+      sd->setVel(sd->getVel() + disp[e] / dt_);
+    }
+    for (int k = 0; k < nPairs; k++) {
+      cluster->getConstraintPair(k)->addConstraintForce(2.0 * gTotal[k] * 
+                                                         rk[k].length() /
+                                                         (dt_ * dt_));
+    }
+  }
+
+  /**
+   * Velocity constraints for a coupled cluster.  The conditions
+   * r_k . v_k = 0 are linear in the multipliers, so a single solve of
+   * C_kl (r_k . r_l) g_l = -r_k . dv_k removes the bond-stretching
+   * velocities of every pair exactly.
+   */
+  void Rattle::matrixB(ConstraintCluster* cluster) {
+    int nPairs = cluster->getNConstraintPairs();
+    int nElems = cluster->getNElems();
+
+    std::vector<Vector3d> vel(nElems);
+    std::vector<RealType> rm(nElems);
+    for (int e = 0; e < nElems; e++) {
+      StuntDouble* sd = cluster->getStuntDouble(e);
+      vel[e] = sd->getVel();
+      rm[e] = 1.0 / sd->getMass();
+    }
+
+    std::vector<Vector3d> rk(nPairs);
+    for (int k = 0; k < nPairs; k++) {
+      rk[k] = cluster->getStuntDouble(cluster->getFirst(k))->getPos() - 
+        cluster->getStuntDouble(cluster->getSecond(k))->getPos();
+      currentSnapshot_->wrapVector(rk[k]);
+    }
+
+    DynamicRectMatrix<RealType> A(nPairs, nPairs);
+    DynamicRectMatrix<RealType> AI(nPairs, nPairs);
+    for (int k = 0; k < nPairs; k++) {
+      int fk = cluster->getFirst(k);
+      int sk = cluster->getSecond(k);
+      for (int l = 0; l < nPairs; l++) {
+        int fl = cluster->getFirst(l);
+        int sl = cluster->getSecond(l);
+        RealType c = ((fk == fl) - (fk == sl)) * rm[fk] 
+          - ((sk == fl) - (sk == sl)) * rm[sk];
+        A(k, l) = c * dot(rk[k], rk[l]);
+      }
+    }
+    if (!invertMatrix(A, AI)) clusterFailure("matrixB");
+
+    std::vector<RealType> rhs(nPairs);
+    for (int k = 0; k < nPairs; k++) {
+      Vector3d dv = vel[cluster->getFirst(k)] - vel[cluster->getSecond(k)];
+      rhs[k] = -dot(rk[k], dv);
+    }
+
+    for (int k = 0; k < nPairs; k++) {
+      RealType g = 0.0;
+      for (int l = 0; l < nPairs; l++) g += AI(k, l) * rhs[l];
+      Vector3d delta = rk[k] * g;
+      int fk = cluster->getFirst(k);
+      int sk = cluster->getSecond(k);
+      vel[fk] += rm[fk] * delta;
+      vel[sk] -= rm[sk] * delta;
+      cluster->getConstraintPair(k)->addConstraintForce(2.0 * g * 
+                                                         rk[k].length() / 
+                                                         dt_);
+    }
+
+    for (int e = 0; e < nElems; e++) 
+      cluster->getStuntDouble(e)->setVel(vel[e]);
+  }
+
   int Rattle::constraintPairA(ConstraintPair* consPair){
 
     ConstraintElem* consElem1 = consPair->getConsElem1();
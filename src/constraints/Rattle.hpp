@@ -45,6 +45,7 @@
 
 #include "brains/SimInfo.hpp"
 #include "constraints/ConstraintPair.hpp"
+#include "constraints/ConstraintCluster.hpp"
 #include "io/ConstraintWriter.hpp"
 
 namespace OpenMD {
@@ -52,6 +53,12 @@ namespace OpenMD {
   /** 
    * @class Rattle Rattle.hpp "constraints/Rattle.hpp"
    * Velocity Verlet Constraint Algorithm
+   *
+   * Constraint pairs are grouped into clusters when the molecules
+   * are created.  Rigid triangles are solved analytically with
+   * SETTLE, small coupled networks with a direct matrix solve for
+   * the Lagrange multipliers, and the remaining pairs with the
+   * usual iterative RATTLE sweep.
    */ 
   class Rattle {
   public:
@@ -68,6 +75,9 @@ namespace OpenMD {
     int getMaxConsIteration() { return maxConsIteration_; }
     void setMaxConsIteration(int iteration) { maxConsIteration_ = iteration; }
 
+    /** time step used to convert displacements into velocities */
+    void setTimeStep(RealType dt) { dt_ = dt; }
+
     RealType getConsTolerance() { return consTolerance_; } 
     void setConsTolerance(RealType tolerance) { consTolerance_ = tolerance;}        
 
@@ -77,6 +87,12 @@ namespace OpenMD {
     int constraintPairA(ConstraintPair* consPair);
     int constraintPairB(ConstraintPair* consPair);
 
+    void doClusterConstraints(bool positionStep);
+    void settleA(ConstraintCluster* cluster);
+    void matrixA(ConstraintCluster* cluster);
+    void matrixB(ConstraintCluster* cluster);
+    void clusterFailure(const char* method);
+
     SimInfo* info_;
     int maxConsIteration_;        
     RealType consTolerance_;
@@ -0,0 +1,290 @@
+/*
+ * Copyright (c) 2018 The University of Notre Dame. All Rights Reserved.
+ *
+ * The University of Notre Dame grants you ("Licensee") a
+ * non-exclusive, royalty free, license to use, modify and
+ * redistribute this software in source and binary code form, provided
+ * that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the
+ *    distribution.
+ *
+ * This software is provided "AS IS," without a warranty of any
+ * kind. All express or implied conditions, representations and
+ * warranties, including any implied warranty of merchantability,
+ * fitness for a particular purpose or non-infringement, are hereby
+ * excluded.  The University of Notre Dame and its licensors shall not
+ * be liable for any damages suffered by licensee as a result of
+ * using, modifying or distributing the software or its
+ * derivatives. In no event will the University of Notre Dame or its
+ * licensors be liable for any lost revenue, profit or data, or for
+ * direct, indirect, special, consequential, incidental or punitive
+ * damages, however caused and regardless of the theory of liability,
+ * arising out of the use of or inability to use software, even if the
+ * University of Notre Dame has been advised of the possibility of
+ * such damages.
+ *
+ * SUPPORT OPEN SCIENCE!  If you use OpenMD or its source code in your
+ * research, please cite the appropriate papers when you publish your
+ * work.  Good starting points are:
+ *                                                                      
+ * [1]  Meineke, et al., J. Comp. Chem. 26, 252-271 (2005).             
+ * [2]  Fennell & Gezelter, J. Chem. Phys. 124, 234104 (2006).          
+ * [3]  Sun, Lin & Gezelter, J. Chem. Phys. 128, 234107 (2008).          
+ * [4]  Kuang & Gezelter,  J. Chem. Phys. 133, 164101 (2010).
+ * [5]  Vardeman, Stocker & Gezelter, J. Chem. Theory Comput. 7, 834 (2011).
+ */
+
+#ifdef IS_MPI
+#include <mpi.h>
+#endif
+
+#include <cmath>
+#include "flucq/FluctuatingChargeASPC.hpp"
+#include "types/FluctuatingChargeAdapter.hpp"
+#include "primitives/Molecule.hpp"
+#include "utils/simError.h"
+#include "utils/BinaryIO.hpp"
+
+namespace OpenMD {
+
+  static RealType binomial(int n, int k) {
+    if (k < 0 || k > n) return 0.0;
+    RealType b = 1.0;
+    for (int i = 1; i <= k; i++)
+      b = b * (n - k + i) / i;
+    return b;
+  }
+
+  FluctuatingChargeASPC::FluctuatingChargeASPC(SimInfo* info) :
+    FluctuatingChargePropagator(info), stepSize_(0.0), flucQobjf_(NULL),
+    snap(info->getSnapshotManager()->getCurrentSnapshot()), nSteps_(0),
+    nSingleCorrection_(0), nCorrections_(0), sumResidual_(0.0) {
+
+    order_ = fqParams_->getPredictorOrder();
+    maxCorrections_ = fqParams_->getCorrectorSteps();
+    tolerance_ = fqParams_->getTolerance();
+    omega_ = RealType(order_ + 2) / RealType(2 * order_ + 3);
+
+    // Lower order predictors are used while the history is still
+    // being filled at the start of a run.  coefficients_[k] holds
+    // the k+2 coefficients of the order k predictor.
+    coefficients_.resize(order_ + 1);
+    for (int k = 0; k <= order_; k++) {
+      RealType norm = binomial(2 * k + 2, k + 1);
+      for (int j = 1; j <= k + 2; j++) {
+        RealType sign = (j % 2 == 1) ? 1.0 : -1.0;
+        coefficients_[k].push_back(sign * j *
+                                   binomial(2 * k + 4, k + 2 - j) / norm);
+      }
+    }
+  }
+
+  FluctuatingChargeASPC::~FluctuatingChargeASPC() {
+    if (nSteps_ > 0) writeStatistics();
+    delete flucQobjf_;
+  }
+
+  void FluctuatingChargeASPC::initialize() {
+    FluctuatingChargePropagator::initialize();
+    if (!hasFlucQ_) return;
+
+    if (!info_->getSimParams()->getUseIntialExtendedSystemState() &&
+        !info_->getSimParams()->haveRestartCheckpoint()) {
+      snap->setElectronicThermostat(make_pair(0.0, 0.0));
+    }
+
+    SimInfo::MoleculeIterator i;
+    Molecule::FluctuatingChargeIterator  j;
+    Molecule* mol;
+    Atom* atom;
+    RealType sumJ(0.0);
+    int nq(0);
+
+    for (mol = info_->beginMolecule(i); mol != NULL;
+         mol = info_->nextMolecule(i)) {
+      for (atom = mol->beginFluctuatingCharge(j); atom != NULL;
+           atom = mol->nextFluctuatingCharge(j)) {
+
+        // charges are not propagated dynamically by this method:
+        atom->setFlucQVel(0.0);
+
+        FluctuatingChargeAdapter fqa = FluctuatingChargeAdapter(atom->getAtomType());
+        if (fqa.hasMultipleMinima()) {
+          vector<tuple3<RealType, RealType, RealType> > diabats = fqa.getDiabaticStates();
+          RealType kMax(0.0);
+          for (unsigned int d = 0; d < diabats.size(); d++)
+            kMax = max(kMax, diabats[d].third);
+          sumJ += kMax;
+        } else {
+          sumJ += fqa.getHardness();
+        }
+        nq++;
+      }
+    }
+
+#ifdef IS_MPI
+    MPI_Allreduce(MPI_IN_PLACE, &sumJ, 1, MPI_REALTYPE, MPI_SUM,
+                  MPI_COMM_WORLD);
+    MPI_Allreduce(MPI_IN_PLACE, &nq, 1, MPI_INT, MPI_SUM, MPI_COMM_WORLD);
+#endif
+
+    if (nq == 0 || sumJ <= 0.0) {
+      sprintf(painCave.errMsg,
+              "FluctuatingChargeASPC Error: the fluctuating charges must\n"
+              "\thave a positive hardness to use the ASPC propagator.\n");
+      painCave.isFatal = 1;
+      painCave.severity = OPENMD_ERROR;
+      simError();
+    }
+
+    stepSize_ = RealType(nq) / sumJ;
+
+    flucQobjf_ = new FluctuatingChargeObjectiveFunction(info_, forceMan_,
+                                                        fqConstraints_);
+
+    history_.clear();
+    std::vector<RealType> q;
+    getCharges(q);
+    history_.push_front(q);
+  }
+
+  void FluctuatingChargeASPC::saveState(std::ostream& os) {
+    if (!hasFlucQ_) return;
+    int depth = history_.size();
+    writeBinary(os, depth);
+    for (int h = 0; h < depth; h++) writeBinary(os, history_[h]);
+  }
+
+  void FluctuatingChargeASPC::loadState(std::istream& is) {
+    if (!hasFlucQ_) return;
+    int depth = 0;
+    readBinary(is, depth);
+    history_.assign(depth, std::vector<RealType>());
+    for (int h = 0; h < depth; h++) readBinary(is, history_[h]);
+  }
+
+  void FluctuatingChargeASPC::getCharges(std::vector<RealType>& q) {
+    SimInfo::MoleculeIterator i;
+    Molecule::FluctuatingChargeIterator  j;
+    Molecule* mol;
+    Atom* atom;
+
+    q.clear();
+    for (mol = info_->beginMolecule(i); mol != NULL;
+         mol = info_->nextMolecule(i)) {
+      for (atom = mol->beginFluctuatingCharge(j); atom != NULL;
+           atom = mol->nextFluctuatingCharge(j)) {
+        q.push_back(atom->getFlucQPos());
+      }
+    }
+  }
+
+  void FluctuatingChargeASPC::moveA() {
+    if (!hasFlucQ_) return;
+    predict();
+  }
+
+  void FluctuatingChargeASPC::predict() {
+    SimInfo::MoleculeIterator i;
+    Molecule::FluctuatingChargeIterator  j;
+    Molecule* mol;
+    Atom* atom;
+
+    int depth = history_.size();
+    if (depth < 2) return;   // q(t) is the best guess we have
+
+    std::vector<RealType>& B = coefficients_[depth - 2];
+    int index = 0;
+    RealType q;
+
+    for (mol = info_->beginMolecule(i); mol != NULL;
+         mol = info_->nextMolecule(i)) {
+      for (atom = mol->beginFluctuatingCharge(j); atom != NULL;
+           atom = mol->nextFluctuatingCharge(j)) {
+        q = 0.0;
+        for (int h = 0; h < depth; h++)
+          q += B[h] * history_[h][index];
+        atom->setFlucQPos(q);
+        index++;
+      }
+    }
+  }
+
+  void FluctuatingChargeASPC::applyConstraints() {
+    if (!initialized_) initialize();
+    if (!hasFlucQ_) return;
+    fqConstraints_->applyConstraints();
+  }
+
+  void FluctuatingChargeASPC::moveB() {
+    if (!hasFlucQ_) return;
+
+    // the integrator has just computed the forces at the predicted
+    // charges, which give the gradient for the first corrector:
+    DynamicVector<RealType> q = flucQobjf_->setInitialCoords();
+    DynamicVector<RealType> grad(q.size());
+    flucQobjf_->getGrad(grad);
+    RealType dq = omega_ * stepSize_;
+    RealType residual(0.0);
+    nSteps_++;
+
+    // The damped corrector is what keeps the predictor stable, so it
+    // is always applied; the tolerance only decides whether more
+    // correctors follow.  Each one leaves the forces evaluated at the
+    // corrected charges.
+    for (int n = 0; n < maxCorrections_; n++) {
+      q -= dq * grad;
+      flucQobjf_->gradient(grad, q);
+      nCorrections_++;
+      residual = getRMSGradient(grad);
+      if (residual < tolerance_) {
+        if (n == 0) nSingleCorrection_++;
+        break;
+      }
+    }
+    sumResidual_ += residual;
+
+    history_.push_front(q);
+    if (int(history_.size()) > order_ + 2) history_.pop_back();
+  }
+
+  RealType FluctuatingChargeASPC::getRMSGradient(const DynamicVector<RealType>& grad) {
+    RealType sums[2] = {0.0, 0.0};
+
+    for (unsigned int i = 0; i < grad.size(); i++) {
+      sums[0] += grad[i] * grad[i];
+      sums[1] += 1.0;
+    }
+
+#ifdef IS_MPI
+    MPI_Allreduce(MPI_IN_PLACE, sums, 2, MPI_REALTYPE, MPI_SUM,
+                  MPI_COMM_WORLD);
+#endif
+
+    return sums[1] > 0.0 ? sqrt(sums[0] / sums[1]) : 0.0;
+  }
+
+  void FluctuatingChargeASPC::writeStatistics() {
+    RealType avgCorr = RealType(nCorrections_) / RealType(nSteps_);
+    unsigned long nSkipped = nSteps_ * maxCorrections_ - nCorrections_;
+    sprintf(painCave.errMsg,
+            "FluctuatingChargeASPC statistics:\n"
+            "\tpredictor order                     = %d\n"
+            "\tsteps                               = %lu\n"
+            "\tsteps converged after one corrector = %lu\n"
+            "\tcorrector force evaluations         = %lu (%.3f per step)\n"
+            "\tcorrectors skipped by the tolerance = %lu\n"
+            "\tmean RMS charge force after update  = %g kcal/mol/e\n",
+            order_, nSteps_, nSingleCorrection_, nCorrections_, avgCorr,
+            nSkipped, sumResidual_ / RealType(nSteps_));
+    painCave.isFatal = 0;
+    painCave.severity = OPENMD_INFO;
+    simError();
+  }
+}
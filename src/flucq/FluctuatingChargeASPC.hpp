@@ -0,0 +1,121 @@
+/*
+ * Copyright (c) 2018 The University of Notre Dame. All Rights Reserved.
+ *
+ * The University of Notre Dame grants you ("Licensee") a
+ * non-exclusive, royalty free, license to use, modify and
+ * redistribute this software in source and binary code form, provided
+ * that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the
+ *    distribution.
+ *
+ * This software is provided "AS IS," without a warranty of any
+ * kind. All express or implied conditions, representations and
+ * warranties, including any implied warranty of merchantability,
+ * fitness for a particular purpose or non-infringement, are hereby
+ * excluded.  The University of Notre Dame and its licensors shall not
+ * be liable for any damages suffered by licensee as a result of
+ * using, modifying or distributing the software or its
+ * derivatives. In no event will the University of Notre Dame or its
+ * licensors be liable for any lost revenue, profit or data, or for
+ * direct, indirect, special, consequential, incidental or punitive
+ * damages, however caused and regardless of the theory of liability,
+ * arising out of the use of or inability to use software, even if the
+ * University of Notre Dame has been advised of the possibility of
+ * such damages.
+ *
+ * SUPPORT OPEN SCIENCE!  If you use OpenMD or its source code in your
+ * research, please cite the appropriate papers when you publish your
+ * work.  Good starting points are:
+ *                                                                      
+ * [1]  Meineke, et al., J. Comp. Chem. 26, 252-271 (2005).             
+ * [2]  Fennell & Gezelter, J. Chem. Phys. 124, 234104 (2006).          
+ * [3]  Sun, Lin & Gezelter, J. Chem. Phys. 128, 234107 (2008).          
+ * [4]  Kuang & Gezelter,  J. Chem. Phys. 133, 164101 (2010).
+ * [5]  Vardeman, Stocker & Gezelter, J. Chem. Theory Comput. 7, 834 (2011).
+ */
+ 
+#ifndef INTEGRATORS_FLUCTUATINGCHARGEASPC_HPP
+#define INTEGRATORS_FLUCTUATINGCHARGEASPC_HPP
+
+#include <deque>
+#include <vector>
+#include "flucq/FluctuatingChargePropagator.hpp"
+#include "flucq/FluctuatingChargeObjectiveFunction.hpp"
+
+namespace OpenMD {
+
+  /**
+   * @class FluctuatingChargeASPC
+   * @brief Always Stable Predictor-Corrector propagation of the
+   * fluctuating charges.
+   *
+   * Instead of re-solving for the charges every step, the charges at
+   * the next step are predicted from the charges at the last k+2
+   * steps,
+   *
+   *  \f[ q^p(t+h) = \sum_{j=1}^{k+2} B_j q(t-(j-1)h) \f]
+   *
+   * with \f$ B_j = (-1)^{j+1} j \binom{2k+4}{k+2-j} / \binom{2k+2}{k+1}
+   * \f$ and are then corrected with damped steepest descent steps
+   * on the FluctuatingChargeObjectiveFunction,
+   *
+   *  \f[ q(t+h) = q^p - \omega \, \nabla_q V(q^p) / \bar{J} \f]
+   *
+   * with \f$ \omega = (k+2)/(2k+3) \f$ and \f$ \bar{J} \f$ the mean
+   * hardness of the fluctuating charges.  The force evaluation made
+   * by the integrator at the predicted charges supplies the gradient
+   * for the first corrector.  Every step applies at least that one
+   * corrector, followed by a force evaluation at the corrected
+   * charges.  Further correctors are only made while the RMS charge
+   * force is above the tolerance, up to correctorSteps per step.
+   *
+   * See: J. Kolafa, J. Comput. Chem. 25, 335-342 (2004).
+   */
+  class FluctuatingChargeASPC : public FluctuatingChargePropagator {
+  public:
+    FluctuatingChargeASPC(SimInfo* info);
+    virtual ~FluctuatingChargeASPC();
+
+  private:
+    virtual void initialize();
+    virtual void moveA();
+    virtual void applyConstraints();
+    virtual void moveB();
+    virtual void updateSizes() {};
+    virtual void saveState(std::ostream& os);
+    virtual void loadState(std::istream& is);
+
+    void getCharges(std::vector<RealType>& q);
+    void predict();
+    RealType getRMSGradient(const DynamicVector<RealType>& grad);
+    void writeStatistics();
+
+    FluctuatingChargeObjectiveFunction* flucQobjf_;
+
+    int order_;
+    int maxCorrections_;
+    RealType tolerance_;
+    RealType omega_;
+    RealType stepSize_;
+    /** predictor coefficients for every history depth up to order_+2 */
+    std::vector<std::vector<RealType> > coefficients_;
+    /** charges from the previous steps; front() is the most recent */
+    std::deque<std::vector<RealType> > history_;
+
+    Snapshot* snap;
+    // statistics
+    unsigned long nSteps_;
+    unsigned long nSingleCorrection_;
+    unsigned long nCorrections_;
+    RealType sumResidual_;
+  };
+
+}
+
+#endif
@@ -92,6 +92,8 @@ namespace OpenMD {
     virtual void moveB();
     virtual void updateSizes();
     virtual RealType calcConservedQuantity();
+    virtual void saveState(std::ostream& os) { randNumGen_.saveState(os); }
+    virtual void loadState(std::istream& is) { randNumGen_.loadState(is); }
 
     int maxIterNum_;
     RealType forceTolerance_;
@@ -66,7 +66,8 @@ namespace OpenMD {
         simError();
       }
       
-      if (!info_->getSimParams()->getUseIntialExtendedSystemState()) {
+      if (!info_->getSimParams()->getUseIntialExtendedSystemState() &&
+          !info_->getSimParams()->haveRestartCheckpoint()) {
         snap->setElectronicThermostat(make_pair(0.0, 0.0));
       }
       
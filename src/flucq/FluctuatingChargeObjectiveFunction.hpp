@@ -60,13 +60,13 @@ namespace OpenMD {
     RealType valueAndGradient(DynamicVector<RealType>& grad, const DynamicVector<RealType>& x);
 
     DynamicVector<RealType> setInitialCoords();
+    // transform cartesian and rotational coordinates into minimization
+    // coordinates 
+    void getGrad(DynamicVector<RealType> &grad);
   private:
     // transform minimization coordinates into cartesian and
     // rotational coordinates
     void setCoor(const DynamicVector<RealType> &x) const;
-    // transform cartesian and rotational coordinates into minimization
-    // coordinates 
-    void getGrad(DynamicVector<RealType> &grad);
 
     SimInfo* info_;
     ForceManager* forceMan_;
@@ -56,19 +56,23 @@ namespace OpenMD {
     DefineOptionalParameterWithDefaultValue(TauThermostat, "tauThermostat", 10.0);
     DefineOptionalParameterWithDefaultValue(DragCoefficient, "dragCoefficient", 0.01);
     DefineOptionalParameterWithDefaultValue(ConstrainRegions, "constrainRegions", false);
+    DefineOptionalParameterWithDefaultValue(PredictorOrder, "predictorOrder", 3);
+    DefineOptionalParameterWithDefaultValue(CorrectorSteps, "correctorSteps", 1);
   }
   
   FluctuatingChargeParameters::~FluctuatingChargeParameters() {    
   }
   
   void FluctuatingChargeParameters::validate() {
-    CheckParameter(Propagator, isEqualIgnoreCase("NVT") || isEqualIgnoreCase("Langevin") || isEqualIgnoreCase("Minimizer") || isEqualIgnoreCase("NVE") || isEqualIgnoreCase("Exact") );
+    CheckParameter(Propagator, isEqualIgnoreCase("NVT") || isEqualIgnoreCase("Langevin") || isEqualIgnoreCase("Minimizer") || isEqualIgnoreCase("NVE") || isEqualIgnoreCase("Exact") || isEqualIgnoreCase("ASPC") );
     CheckParameter(Friction, isNonNegative());    
     CheckParameter(Tolerance, isPositive());    
     CheckParameter(MaxIterations, isPositive());    
     CheckParameter(TargetTemp,  isNonNegative());
     CheckParameter(TauThermostat, isPositive()); 
     CheckParameter(DragCoefficient, isPositive()); 
+    CheckParameter(PredictorOrder, isNonNegative());
+    CheckParameter(CorrectorSteps, isPositive());
   }
   
 }
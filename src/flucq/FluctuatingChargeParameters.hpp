@@ -55,6 +55,8 @@ namespace OpenMD {
     DeclareParameter(TauThermostat, RealType);
     DeclareParameter(DragCoefficient, RealType);
     DeclareParameter(ConstrainRegions, bool);
+    DeclareParameter(PredictorOrder, int);
+    DeclareParameter(CorrectorSteps, int);
     
   public:
     FluctuatingChargeParameters();
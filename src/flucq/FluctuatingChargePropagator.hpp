@@ -64,6 +64,10 @@ namespace OpenMD {
     virtual void applyConstraints();
     virtual void moveB() = 0;
     virtual void setForceManager(ForceManager* forceMan);
+    /** Writes any internal state of the propagator */
+    virtual void saveState(std::ostream&) {}
+    /** Restores the state written by saveState */
+    virtual void loadState(std::istream&) {}
 
   protected:
     FluctuatingChargeParameters* fqParams_;
@@ -46,14 +46,15 @@
 #include "flucq/FluctuatingChargeLangevin.hpp"
 #include "flucq/FluctuatingChargeNVE.hpp"
 #include "flucq/FluctuatingChargeNVT.hpp"
+#include "flucq/FluctuatingChargeASPC.hpp"
 #include "utils/simError.h"
 
 namespace OpenMD {
   Integrator::Integrator(SimInfo* info) 
     : info_(info), forceMan_(NULL), rotAlgo_(NULL), flucQ_(NULL), 
-      rattle_(NULL), velocitizer_(NULL), rnemd_(NULL), 
+      rattle_(NULL), velocitizer_(NULL), rnemd_(NULL), correlators_(NULL),
       needPotential(false), needStress(false), 
-      needReset(false),  needVelocityScaling(false), 
+      needReset(false),  needVelocityScaling(false), needCheckpoint(false),
       useRNEMD(false), dumpWriter(NULL), statWriter(NULL), thermo(info_),
       snap(info_->getSnapshotManager()->getCurrentSnapshot()) {
     
@@ -96,7 +97,10 @@ namespace OpenMD {
       thermalTime = simParams->getRunTime();
     }
     
-    if (!simParams->getUseInitalTime()) {
+    // a run resumed from a checkpoint keeps the time stored with it:
+    restartFromCheckpoint = simParams->haveRestartCheckpoint();
+
+    if (!simParams->getUseInitalTime() && !restartFromCheckpoint) {
       snap->setTime(0.0);
     }
     
@@ -104,6 +108,11 @@ namespace OpenMD {
       needReset = true;
       resetTime = simParams->getResetTime();
     }
+
+    if (simParams->haveCheckpointTime()) {
+      needCheckpoint = true;
+      checkpointTime = simParams->getCheckpointTime();
+    }
     
     // Create a default ForceManager: If the subclass wants to use 
     // a different ForceManager, use setForceManager
@@ -143,6 +152,10 @@ namespace OpenMD {
       }
     }
     
+    if (simParams->haveCorrelators()) {
+      correlators_ = new Correlators(info);
+    }
+
     rotAlgo_ = new DLM();
     rattle_ = new Rattle(info);
     if (simParams->getFluctuatingChargeParameters()->havePropagator()) {
@@ -153,6 +166,8 @@ namespace OpenMD {
          flucQ_ = new FluctuatingChargeNVE(info);
       } else if (prop.compare("LANGEVIN")==0) {
          flucQ_ = new FluctuatingChargeLangevin(info);
+      } else if (prop.compare("ASPC")==0) {
+         flucQ_ = new FluctuatingChargeASPC(info);
       } else {
         sprintf(painCave.errMsg,
                 "Integrator Error: Unknown Fluctuating Charge propagator (%s) requested\n",
@@ -167,6 +182,7 @@ namespace OpenMD {
     delete forceMan_;
     delete velocitizer_;
     delete rnemd_;
+    delete correlators_;
     delete flucQ_;
     delete rotAlgo_;
     delete rattle_;
@@ -59,6 +59,7 @@
 #include "flucq/FluctuatingChargePropagator.hpp"
 #include "brains/Velocitizer.hpp"
 #include "rnemd/RNEMD.hpp"
+#include "brains/Correlators.hpp"
 #include "constraints/Rattle.hpp"
 
 namespace OpenMD {
@@ -79,6 +80,27 @@ namespace OpenMD {
       doIntegrate();
     }
 
+    /**
+     * The run can also be driven in pieces (as the replica programs
+     * do): initializeIntegration() once, integrateUntil() as often as
+     * needed, and finalizeIntegration() at the end.
+     */
+    void initializeIntegration() {
+      doInitialize();
+    }
+
+    /** Takes steps until the snapshot reaches time (or runTime) */
+    void integrateUntil(RealType time) {
+      doIntegrateUntil(time);
+    }
+
+    void finalizeIntegration() {
+      doFinalize();
+    }
+
+    RealType getRunTime() { return runTime; }
+    RealType getDt() { return dt; }
+
     void updateSizes() {
       doUpdateSizes();
       flucQ_->updateSizes();
@@ -133,6 +155,9 @@ namespace OpenMD {
     Integrator(SimInfo* info);
 
     virtual void doIntegrate() = 0;
+    virtual void doInitialize() = 0;
+    virtual void doIntegrateUntil(RealType time) = 0;
+    virtual void doFinalize() = 0;
 
     virtual void doUpdateSizes() {}
         
@@ -148,12 +173,15 @@ namespace OpenMD {
     Rattle* rattle_;
     Velocitizer* velocitizer_;
     RNEMD* rnemd_;
+    Correlators* correlators_;
 
     bool needPotential;
     bool needStress;
     bool needReset;    
     bool needVelocityScaling;
     RealType targetScalingTemp;
+    bool needCheckpoint;
+    bool restartFromCheckpoint;
 
     bool useRNEMD;    
     
@@ -168,6 +196,7 @@ namespace OpenMD {
     RealType thermalTime;
     RealType resetTime;
     RealType RNEMD_exchangeTime;
+    RealType checkpointTime;
     RealType dt;
 
     Snapshot* snap; // During the integration, the address of snap Will not change
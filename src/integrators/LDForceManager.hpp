@@ -91,6 +91,9 @@ namespace OpenMD {
     }
 
 
+    virtual void saveState(std::ostream& os) { randNumGen_.saveState(os); }
+    virtual void loadState(std::istream& is) { randNumGen_.loadState(is); }
+
   protected:
     virtual void postCalculation();
     
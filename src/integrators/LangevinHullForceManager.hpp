@@ -68,6 +68,9 @@ namespace OpenMD {
     LangevinHullForceManager(SimInfo * info);
     virtual ~LangevinHullForceManager();
     
+    virtual void saveState(std::ostream& os) { randNumGen_.saveState(os); }
+    virtual void loadState(std::istream& is) { randNumGen_.loadState(is); }
+
   protected:
     virtual void postCalculation();
     
@@ -45,6 +45,7 @@
 #include "brains/SimInfo.hpp"
 #include "brains/Thermo.hpp"
 #include "integrators/NPT.hpp"
+#include "brains/IntegrableObjectIndex.hpp"
 #include "math/SquareMatrix3.hpp"
 #include "primitives/Molecule.hpp"
 #include "utils/Constants.hpp"
@@ -68,7 +69,8 @@ namespace OpenMD {
 
       Globals* simParams = info_->getSimParams();
     
-      if (!simParams->getUseIntialExtendedSystemState()) {
+      if (!simParams->getUseIntialExtendedSystemState() &&
+          !simParams->haveRestartCheckpoint()) {
         Snapshot* currSnapshot = info_->getSnapshotManager()->getCurrentSnapshot();
         currSnapshot->setThermostat(make_pair(0.0, 0.0));
         currSnapshot->setBarostat(Mat3x3d(0.0));
@@ -133,15 +135,9 @@ namespace OpenMD {
   }
 
   void NPT::moveA() {
-    SimInfo::MoleculeIterator i;
-    Molecule::IntegrableObjectIterator  j;
-    Molecule* mol;
-    StuntDouble* sd;
+    IntegrableObjectIndex* ioIndex = info_->getIntegrableObjectIndex();
     Vector3d Tb, ji;
-    RealType mass;
-    Vector3d vel;
     Vector3d pos;
-    Vector3d frc;
     Vector3d sc;
     int index;
 
@@ -159,40 +155,37 @@ namespace OpenMD {
 
     calcVelScale();
 
-    for (mol = info_->beginMolecule(i); mol != NULL; 
-         mol = info_->nextMolecule(i)) {
+    for (int t = 0; t < IntegrableObjectIndex::ioNSpanTypes; t++) {
+      IntegrableObjectIndex::Span& span = ioIndex->getSpan(t);
+      DataStorage& data = snap->*(span.storage);
 
-      for (sd = mol->beginIntegrableObject(j); sd != NULL;
-	   sd = mol->nextIntegrableObject(j)) {
-                
-	vel = sd->getVel();
-	frc = sd->getFrc();
-
-	mass = sd->getMass();
+      for (int n = 0; n < span.size(); n++) {
+        int idx = span.localIndex[n];
+        Vector3d& vel = data.velocity[idx];
 
 	getVelScaleA(sc, vel);
 
 	// velocity half step  (use chi from previous step here):
 
-	vel += dt2*Constants::energyConvert/mass* frc - dt2*sc;
-	sd->setVel(vel);
+	vel += dt2*Constants::energyConvert/span.mass[n]* data.force[idx] 
+          - dt2*sc;
 
-	if (sd->isDirectional()) {
+	if (span.directional) {
 
 	  // get and convert the torque to body frame
 
-	  Tb = sd->lab2Body(sd->getTrq());
+	  Tb = data.aMat[idx] * data.torque[idx];
 
 	  // get the angular momentum, and propagate a half step
 
-	  ji = sd->getJ();
+	  ji = data.angularMomentum[idx];
 
 	  ji += dt2*Constants::energyConvert * Tb 
             - dt2*thermostat.first* ji;
                 
-	  rotAlgo_->rotate(sd, ji, dt);
+	  rotAlgo_->rotate(span.sd[n], ji, dt);
 
-	  sd->setJ(ji);
+	  data.angularMomentum[idx] = ji;
 	}
             
       }
@@ -209,37 +202,30 @@ namespace OpenMD {
     flucQ_->moveA();
 
 
-    index = 0;
-    for (mol = info_->beginMolecule(i); mol != NULL; 
-         mol = info_->nextMolecule(i)) {
-
-      for (sd = mol->beginIntegrableObject(j); sd != NULL;
-	   sd = mol->nextIntegrableObject(j)) {
-
-	oldPos[index++] = sd->getPos();            
-
-      }
+    // oldPos, oldVel and oldJi are kept in the flat integrable
+    // object ordering:
+    for (int t = 0; t < IntegrableObjectIndex::ioNSpanTypes; t++) {
+      IntegrableObjectIndex::Span& span = ioIndex->getSpan(t);
+      DataStorage& data = snap->*(span.storage);
+      for (int n = 0; n < span.size(); n++) 
+	oldPos[span.offset + n] = data.position[span.localIndex[n]];
     }
     
     //the first estimation of r(t+dt) is equal to  r(t)
 
     for(int k = 0; k < maxIterNum_; k++) {
-      index = 0;
-      for (mol = info_->beginMolecule(i); mol != NULL; 
-           mol = info_->nextMolecule(i)) {
-
-	for (sd = mol->beginIntegrableObject(j); sd != NULL;
-	     sd = mol->nextIntegrableObject(j)) {
+      for (int t = 0; t < IntegrableObjectIndex::ioNSpanTypes; t++) {
+        IntegrableObjectIndex::Span& span = ioIndex->getSpan(t);
+        DataStorage& data = snap->*(span.storage);
 
-	  vel = sd->getVel();
-	  pos = sd->getPos();
+        for (int n = 0; n < span.size(); n++) {
+          int idx = span.localIndex[n];
+          index = span.offset + n;
+	  pos = data.position[idx];
 
 	  this->getPosScale(pos, COM, index, sc);
 
-	  pos = oldPos[index] + dt * (vel + sc);
-	  sd->setPos(pos);     
-
-	  ++index;
+	  data.position[idx] = oldPos[index] + dt * (data.velocity[idx] + sc);
 	}
       }
 
@@ -256,17 +242,10 @@ namespace OpenMD {
   }
 
   void NPT::moveB(void) {
-    SimInfo::MoleculeIterator i;
-    Molecule::IntegrableObjectIterator  j;
-    Molecule* mol;
-    StuntDouble* sd;
+    IntegrableObjectIndex* ioIndex = info_->getIntegrableObjectIndex();
     int index;
     Vector3d Tb;
-    Vector3d ji;
     Vector3d sc;
-    Vector3d vel;
-    Vector3d frc;
-    RealType mass;
 
     thermostat = snap->getThermostat();
     RealType oldChi  = thermostat.first;
@@ -275,19 +254,16 @@ namespace OpenMD {
     loadEta();
     
     //save velocity and angular momentum
-    index = 0;
-    for (mol = info_->beginMolecule(i); mol != NULL; 
-         mol = info_->nextMolecule(i)) {
-
-      for (sd = mol->beginIntegrableObject(j); sd != NULL;
-	   sd = mol->nextIntegrableObject(j)) {
-                
-	oldVel[index] = sd->getVel();
+    for (int t = 0; t < IntegrableObjectIndex::ioNSpanTypes; t++) {
+      IntegrableObjectIndex::Span& span = ioIndex->getSpan(t);
+      DataStorage& data = snap->*(span.storage);
 
-        if (sd->isDirectional())
-	   oldJi[index] = sd->getJ();
+      for (int n = 0; n < span.size(); n++) {
+        index = span.offset + n;
+	oldVel[index] = data.velocity[span.localIndex[n]];
 
-	++index;
+        if (span.directional)
+	   oldJi[index] = data.angularMomentum[span.localIndex[n]];
       }
     }
 
@@ -306,37 +282,29 @@ namespace OpenMD {
       this->evolveEtaB();
       this->calcVelScale();
 
-      index = 0;
-      for (mol = info_->beginMolecule(i); mol != NULL; 
-           mol = info_->nextMolecule(i)) {
-
-	for (sd = mol->beginIntegrableObject(j); sd != NULL;
-	     sd = mol->nextIntegrableObject(j)) {            
+      for (int t = 0; t < IntegrableObjectIndex::ioNSpanTypes; t++) {
+        IntegrableObjectIndex::Span& span = ioIndex->getSpan(t);
+        DataStorage& data = snap->*(span.storage);
 
-	  frc = sd->getFrc();
-	  mass = sd->getMass();
+        for (int n = 0; n < span.size(); n++) {
+          int idx = span.localIndex[n];
+          index = span.offset + n;
 
 	  getVelScaleB(sc, index);
 
 	  // velocity half step
-	  vel = oldVel[index] 
-            + dt2*Constants::energyConvert/mass* frc 
+	  data.velocity[idx] = oldVel[index] 
+            + dt2*Constants::energyConvert/span.mass[n]* data.force[idx] 
             - dt2*sc;
 
-	  sd->setVel(vel);
-
-	  if (sd->isDirectional()) {
+	  if (span.directional) {
 	    // get and convert the torque to body frame
-	    Tb = sd->lab2Body(sd->getTrq());
+	    Tb = data.aMat[idx] * data.torque[idx];
 
-	    ji = oldJi[index] 
+	    data.angularMomentum[idx] = oldJi[index] 
               + dt2*Constants::energyConvert*Tb 
               - dt2*thermostat.first*oldJi[index];
-
-	    sd->setJ(ji);
 	  }
-
-	  ++index;
 	}
       }
         
@@ -48,6 +48,7 @@
  */
 
 #include "integrators/NVE.hpp"
+#include "brains/IntegrableObjectIndex.hpp"
 #include "primitives/Molecule.hpp"
 #include "utils/Constants.hpp"
 
@@ -59,55 +60,41 @@ namespace OpenMD {
   }
 
   void NVE::moveA(){
-    SimInfo::MoleculeIterator i;
-    Molecule::IntegrableObjectIterator  j;
-    Molecule* mol;
-    StuntDouble* sd;
-    Vector3d vel;
-    Vector3d pos;
-    Vector3d frc;
+    IntegrableObjectIndex* ioIndex = info_->getIntegrableObjectIndex();
     Vector3d Tb;
     Vector3d ji;
-    RealType mass;
     
-    for (mol = info_->beginMolecule(i); mol != NULL; 
-         mol = info_->nextMolecule(i)) {
+    for (int t = 0; t < IntegrableObjectIndex::ioNSpanTypes; t++) {
+      IntegrableObjectIndex::Span& span = ioIndex->getSpan(t);
+      DataStorage& data = snap->*(span.storage);
 
-      for (sd = mol->beginIntegrableObject(j); sd != NULL;
-	   sd = mol->nextIntegrableObject(j)) {
-
-	vel = sd->getVel();
-	pos = sd->getPos();
-	frc = sd->getFrc();
-	mass = sd->getMass();
+      for (int n = 0; n < span.size(); n++) {
+        int idx = span.localIndex[n];
+        Vector3d& vel = data.velocity[idx];
                 
 	// velocity half step
-	vel += (dt2 /mass * Constants::energyConvert) * frc;
+	vel += (dt2 / span.mass[n] * Constants::energyConvert) * 
+          data.force[idx];
 
 	// position whole step
-	pos += dt * vel;
-
-	sd->setVel(vel);
-	sd->setPos(pos);
+	data.position[idx] += dt * vel;
 
-	if (sd->isDirectional()){
+	if (span.directional){
 
 	  // get and convert the torque to body frame
 
-	  Tb = sd->lab2Body(sd->getTrq());
+	  Tb = data.aMat[idx] * data.torque[idx];
 
 	  // get the angular momentum, and propagate a half step
 
-	  ji = sd->getJ();
+	  ji = data.angularMomentum[idx];
 
 	  ji += (dt2  * Constants::energyConvert) * Tb;
 
-	  rotAlgo_->rotate(sd, ji, dt);
+	  rotAlgo_->rotate(span.sd[n], ji, dt);
 
-	  sd->setJ(ji);
+	  data.angularMomentum[idx] = ji;
 	}
-
-            
       }
     }
     flucQ_->moveA();
@@ -115,47 +102,27 @@ namespace OpenMD {
   }    
 
   void NVE::moveB(){
-    SimInfo::MoleculeIterator i;
-    Molecule::IntegrableObjectIterator  j;
-    Molecule* mol;
-    StuntDouble* sd;
-    Vector3d vel;
-    Vector3d frc;
-    Vector3d Tb;
-    Vector3d ji;
-    RealType mass;
+    IntegrableObjectIndex* ioIndex = info_->getIntegrableObjectIndex();
     
-    for (mol = info_->beginMolecule(i); mol != NULL; 
-         mol = info_->nextMolecule(i)) {
-
-      for (sd = mol->beginIntegrableObject(j); sd != NULL;
-	   sd = mol->nextIntegrableObject(j)) {
+    for (int t = 0; t < IntegrableObjectIndex::ioNSpanTypes; t++) {
+      IntegrableObjectIndex::Span& span = ioIndex->getSpan(t);
+      DataStorage& data = snap->*(span.storage);
 
-	vel = sd->getVel();
-	frc = sd->getFrc();
-	mass = sd->getMass();
+      for (int n = 0; n < span.size(); n++) {
+        int idx = span.localIndex[n];
                 
 	// velocity half step
-	vel += (dt2 /mass * Constants::energyConvert) * frc;
-                
-	sd->setVel(vel);
+	data.velocity[idx] += (dt2 / span.mass[n] * Constants::energyConvert) 
+          * data.force[idx];
 
-	if (sd->isDirectional()){
+	if (span.directional){
 
-	  // get and convert the torque to body frame
+	  // convert the torque to body frame and propagate the angular
+	  // momentum a half step
 
-	  Tb = sd->lab2Body(sd->getTrq());
-
-	  // get the angular momentum, and propagate a half step
-
-	  ji = sd->getJ();
-
-	  ji += (dt2  * Constants::energyConvert) * Tb;
-
-	  sd->setJ(ji);
+	  data.angularMomentum[idx] += (dt2  * Constants::energyConvert) * 
+            (data.aMat[idx] * data.torque[idx]);
 	}
-
-            
       }
     }
   
@@ -41,6 +41,7 @@
  */
  
 #include "integrators/NVT.hpp"
+#include "brains/IntegrableObjectIndex.hpp"
 #include "primitives/Molecule.hpp"
 #include "utils/simError.h"
 #include "utils/Constants.hpp"
@@ -52,7 +53,8 @@ namespace OpenMD {
 
     Globals* simParams = info_->getSimParams();
 
-    if (!simParams->getUseIntialExtendedSystemState()) {
+    if (!simParams->getUseIntialExtendedSystemState() &&
+        !simParams->haveRestartCheckpoint()) {
       Snapshot* snap = info_->getSnapshotManager()->getCurrentSnapshot();
       snap->setThermostat(make_pair(0.0, 0.0));
     }
@@ -88,16 +90,9 @@ namespace OpenMD {
   }
 
   void NVT::moveA() {
-    SimInfo::MoleculeIterator i;
-    Molecule::IntegrableObjectIterator  j;
-    Molecule* mol;
-    StuntDouble* sd;
+    IntegrableObjectIndex* ioIndex = info_->getIntegrableObjectIndex();
     Vector3d Tb;
     Vector3d ji;
-    RealType mass;
-    Vector3d vel;
-    Vector3d pos;
-    Vector3d frc;
 
     pair<RealType, RealType> thermostat = snap->getThermostat();
 
@@ -105,43 +100,36 @@ namespace OpenMD {
 
     RealType instTemp = thermo.getTemperature();
 
-    for (mol = info_->beginMolecule(i); mol != NULL; 
-         mol = info_->nextMolecule(i)) {
+    for (int t = 0; t < IntegrableObjectIndex::ioNSpanTypes; t++) {
+      IntegrableObjectIndex::Span& span = ioIndex->getSpan(t);
+      DataStorage& data = snap->*(span.storage);
 
-      for (sd = mol->beginIntegrableObject(j); sd != NULL;
-	   sd = mol->nextIntegrableObject(j)) {
-
-        vel = sd->getVel();
-        pos = sd->getPos();
-        frc = sd->getFrc();
-
-        mass = sd->getMass();
+      for (int n = 0; n < span.size(); n++) {
+        int idx = span.localIndex[n];
+        Vector3d& vel = data.velocity[idx];
 
         // velocity half step (use chi from previous step here):
-        vel += dt2 *Constants::energyConvert/mass*frc 
+        vel += dt2 *Constants::energyConvert/span.mass[n]*data.force[idx] 
           - dt2*thermostat.first*vel;
         
         // position whole step
-        pos += dt * vel;
+        data.position[idx] += dt * vel;
 
-        sd->setVel(vel);
-        sd->setPos(pos);
-
-        if (sd->isDirectional()) {
+        if (span.directional) {
 
 	  //convert the torque to body frame
-	  Tb = sd->lab2Body(sd->getTrq());
+	  Tb = data.aMat[idx] * data.torque[idx];
 
 	  // get the angular momentum, and propagate a half step
 
-	  ji = sd->getJ();
+	  ji = data.angularMomentum[idx];
 
 	  ji += dt2*Constants::energyConvert*Tb 
             - dt2*thermostat.first *ji;
 
-	  rotAlgo_->rotate(sd, ji, dt);
+	  rotAlgo_->rotate(span.sd[n], ji, dt);
 
-	  sd->setJ(ji);
+	  data.angularMomentum[idx] = ji;
         }
       }
       
@@ -161,16 +149,7 @@ namespace OpenMD {
   }
 
   void NVT::moveB() {
-    SimInfo::MoleculeIterator i;
-    Molecule::IntegrableObjectIterator  j;
-    Molecule* mol;
-    StuntDouble* sd;
-    
-    Vector3d Tb;
-    Vector3d ji;    
-    Vector3d vel;
-    Vector3d frc;
-    RealType mass;
+    IntegrableObjectIndex* ioIndex = info_->getIntegrableObjectIndex();
     RealType instTemp;
     int index;
     // Set things up for the iteration:
@@ -179,26 +158,23 @@ namespace OpenMD {
     RealType oldChi = thermostat.first;
     RealType  prevChi;
 
-    index = 0;
-    for (mol = info_->beginMolecule(i); mol != NULL; 
-         mol = info_->nextMolecule(i)) {
-
-      for (sd = mol->beginIntegrableObject(j); sd != NULL;
-	   sd = mol->nextIntegrableObject(j)) {
-
-	oldVel_[index] = sd->getVel();
-        
-        if (sd->isDirectional()) 
-          oldJi_[index] = sd->getJ();                
-        
-	++index;    
-      }           
+    // save the velocities and angular momenta (in the flat
+    // integrable object ordering):
+    for (int t = 0; t < IntegrableObjectIndex::ioNSpanTypes; t++) {
+      IntegrableObjectIndex::Span& span = ioIndex->getSpan(t);
+      DataStorage& data = snap->*(span.storage);
+
+      for (int n = 0; n < span.size(); n++) {
+        index = span.offset + n;
+        oldVel_[index] = data.velocity[span.localIndex[n]];
+        if (span.directional) 
+          oldJi_[index] = data.angularMomentum[span.localIndex[n]];
+      }
     }
 
     // do the iteration:
 
     for(int k = 0; k < maxIterNum_; k++) {
-      index = 0;
       instTemp = thermo.getTemperature();
 
       // evolve chi another half step using the temperature at t + dt/2
@@ -207,37 +183,30 @@ namespace OpenMD {
       thermostat.first = oldChi + dt2 * (instTemp / targetTemp_ - 1.0) 
         / (tauThermostat_ * tauThermostat_);
 
-      for (mol = info_->beginMolecule(i); mol != NULL; 
-           mol = info_->nextMolecule(i)) {
-        
-	for (sd = mol->beginIntegrableObject(j); sd != NULL;
-	     sd = mol->nextIntegrableObject(j)) {
+      for (int t = 0; t < IntegrableObjectIndex::ioNSpanTypes; t++) {
+        IntegrableObjectIndex::Span& span = ioIndex->getSpan(t);
+        DataStorage& data = snap->*(span.storage);
 
-	  frc = sd->getFrc();
-	  mass = sd->getMass();
+        for (int n = 0; n < span.size(); n++) {
+          int idx = span.localIndex[n];
+          index = span.offset + n;
 
 	  // velocity half step
 
-	  vel = oldVel_[index] 
-            + dt2/mass*Constants::energyConvert * frc 
+	  data.velocity[idx] = oldVel_[index] 
+            + dt2/span.mass[n]*Constants::energyConvert * data.force[idx] 
             - dt2*thermostat.first*oldVel_[index];
-            
-	  sd->setVel(vel);
 
-	  if (sd->isDirectional()) {
+	  if (span.directional) {
 
 	    // get and convert the torque to body frame
 
-	    Tb =  sd->lab2Body(sd->getTrq());
+	    Vector3d Tb = data.aMat[idx] * data.torque[idx];
 
-	    ji = oldJi_[index] + dt2*Constants::energyConvert*Tb 
+	    data.angularMomentum[idx] = oldJi_[index] 
+              + dt2*Constants::energyConvert*Tb 
               - dt2*thermostat.first *oldJi_[index];
-
-	    sd->setJ(ji);
 	  }
-
-
-	  ++index;
 	}
       }
     
@@ -0,0 +1,352 @@
+/*
+ * Copyright (c) 2018 The University of Notre Dame. All Rights Reserved.
+ *
+ * The University of Notre Dame grants you ("Licensee") a
+ * non-exclusive, royalty free, license to use, modify and
+ * redistribute this software in source and binary code form, provided
+ * that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the
+ *    distribution.
+ *
+ * This software is provided "AS IS," without a warranty of any
+ * kind. All express or implied conditions, representations and
+ * warranties, including any implied warranty of merchantability,
+ * fitness for a particular purpose or non-infringement, are hereby
+ * excluded.  The University of Notre Dame and its licensors shall not
+ * be liable for any damages suffered by licensee as a result of
+ * using, modifying or distributing the software or its
+ * derivatives. In no event will the University of Notre Dame or its
+ * licensors be liable for any lost revenue, profit or data, or for
+ * direct, indirect, special, consequential, incidental or punitive
+ * damages, however caused and regardless of the theory of liability,
+ * arising out of the use of or inability to use software, even if the
+ * University of Notre Dame has been advised of the possibility of
+ * such damages.
+ *
+ * SUPPORT OPEN SCIENCE!  If you use OpenMD or its source code in your
+ * research, please cite the appropriate papers when you publish your
+ * work.  Good starting points are:
+ *                                                                      
+ * [1]  Meineke, et al., J. Comp. Chem. 26, 252-271 (2005).             
+ * [2]  Fennell & Gezelter, J. Chem. Phys. 124, 234104 (2006).          
+ * [3]  Sun, Lin & Gezelter, J. Chem. Phys. 128, 234107 (2008).          
+ * [4]  Kuang & Gezelter,  J. Chem. Phys. 133, 164101 (2010).
+ * [5]  Vardeman, Stocker & Gezelter, J. Chem. Theory Comput. 7, 834 (2011).
+ */
+ 
+#include <typeinfo>
+
+#include "integrators/RESPA.hpp"
+#include "brains/IntegrableObjectIndex.hpp"
+#include "primitives/Molecule.hpp"
+#include "utils/Constants.hpp"
+#include "utils/simError.h"
+#include "utils/BinaryIO.hpp"
+
+namespace OpenMD {
+
+  RESPA::RESPA(SimInfo* info) : VelocityVerletIntegrator(info) {
+    nFast_ = simParams->getRespaFastSteps();
+    nMedium_ = simParams->getRespaMediumSteps();
+    dtMedium_ = dt / nMedium_;
+    dtFast_ = dtMedium_ / nFast_;
+
+    // position constraints are applied after every fast step:
+    rattle_->setTimeStep(dtFast_);
+
+    updateSizes();
+  }
+
+  void RESPA::doUpdateSizes() {
+    int nio = info_->getNIntegrableObjects();
+    fastFrc_.assign(nio, V3Zero);
+    fastTrq_.assign(nio, V3Zero);
+    mediumFrc_.assign(nio, V3Zero);
+    mediumTrq_.assign(nio, V3Zero);
+    slowFrc_.assign(nio, V3Zero);
+    slowTrq_.assign(nio, V3Zero);
+  }
+
+  void RESPA::initialize() {
+    // The tiered force evaluation needs a plain ForceManager; the
+    // z-constraint, restraint and thermodynamic integration managers
+    // add their forces on every call to calcForces.
+    if (typeid(*forceMan_) != typeid(ForceManager)) {
+      sprintf(painCave.errMsg,
+              "RESPA: the multiple time step integrator cannot be combined\n"
+              "\twith z-constraints, restraints, or thermodynamic integration.\n");
+      painCave.isFatal = 1;
+      painCave.severity = OPENMD_ERROR;
+      simError();
+    }
+
+    sprintf(painCave.errMsg,
+            "RESPA: outer step = %f fs, medium step = %f fs, "
+            "fast step = %f fs\n", dt, dtMedium_, dtFast_);
+    painCave.isFatal = 0;
+    painCave.severity = OPENMD_INFO;
+    simError();
+
+    VelocityVerletIntegrator::initialize();
+  }
+
+  /** The tier forces of the last step are needed by the next one */
+  void RESPA::saveState(std::ostream& os) {
+    VelocityVerletIntegrator::saveState(os);
+    writeBinary(os, fastFrc_);
+    writeBinary(os, fastTrq_);
+    writeBinary(os, mediumFrc_);
+    writeBinary(os, mediumTrq_);
+    writeBinary(os, slowFrc_);
+    writeBinary(os, slowTrq_);
+  }
+
+  void RESPA::loadState(std::istream& is) {
+    VelocityVerletIntegrator::loadState(is);
+    readBinary(is, fastFrc_);
+    readBinary(is, fastTrq_);
+    readBinary(is, mediumFrc_);
+    readBinary(is, mediumTrq_);
+    readBinary(is, slowFrc_);
+    readBinary(is, slowTrq_);
+  }
+
+  void RESPA::moveA() {
+    flucQ_->moveA();
+
+    kick(0.0, 0.0, dt2);
+
+    for (int m = 0; m < nMedium_; m++) {
+      kick(0.0, 0.5 * dtMedium_, 0.0);
+
+      for (int f = 0; f < nFast_; f++) {
+        kick(0.5 * dtFast_, 0.0, 0.0);
+        drift(dtFast_);
+
+        bool endOfMedium = (f == nFast_ - 1);
+
+        // the forces at the end of the outer step are computed by
+        // calcForce, and the closing kicks are done in moveB:
+        if (endOfMedium && m == nMedium_ - 1) break;
+
+        calcInnerForces(endOfMedium);
+        kick(0.5 * dtFast_, endOfMedium ? 0.5 * dtMedium_ : 0.0, 0.0);
+      }
+    }
+  }
+
+  void RESPA::moveB() {
+    kick(0.5 * dtFast_, 0.5 * dtMedium_, dt2);
+    flucQ_->moveB();
+    rattle_->constraintB();
+  }
+
+  /**
+   * Evaluates each force tier once at the end of an outer step.  The
+   * medium tier is evaluated last; the energies, stress tensor and
+   * per-atom data of the fast and slow tiers are then added to it, so
+   * the snapshot holds the totals without another force evaluation.
+   */
+  void RESPA::calcForce() {
+    bool separateSlow = (nMedium_ > 1 && forceMan_->usesReciprocalSpace());
+
+    forceMan_->setForceTiers(ForceManager::BONDED_TIER);
+    forceMan_->calcForces();
+    saveForces(fastFrc_, fastTrq_);
+    saveTotals(fastTotals_);
+
+    if (separateSlow) {
+      forceMan_->setForceTiers(ForceManager::RECIPROCAL_TIER);
+      forceMan_->calcForces();
+      saveForces(slowFrc_, slowTrq_);
+      saveTotals(slowTotals_);
+      forceMan_->setForceTiers(ForceManager::NONBONDED_TIER);
+    } else {
+      forceMan_->setForceTiers(ForceManager::NONBONDED_TIER |
+                               ForceManager::RECIPROCAL_TIER);
+    }
+
+    forceMan_->calcForces();
+    saveForces(mediumFrc_, mediumTrq_);
+
+    addTotals(fastTotals_);
+    if (separateSlow) {
+      addTotals(slowTotals_);
+      snap->setReciprocalPotential(slowTotals_.reciprocalPotential);
+    }
+    setTotalForces();
+    forceMan_->setForceTiers(ForceManager::ALL_TIERS);
+
+    flucQ_->applyConstraints();
+  }
+
+  void RESPA::calcInnerForces(bool doMedium) {
+    forceMan_->setForceTiers(ForceManager::BONDED_TIER);
+    forceMan_->calcForces();
+    saveForces(fastFrc_, fastTrq_);
+
+    if (doMedium) {
+      forceMan_->setForceTiers(ForceManager::NONBONDED_TIER);
+      forceMan_->calcForces();
+      saveForces(mediumFrc_, mediumTrq_);
+    }
+    forceMan_->setForceTiers(ForceManager::ALL_TIERS);
+  }
+
+  void RESPA::saveForces(std::vector<Vector3d>& frc, 
+                         std::vector<Vector3d>& trq) {
+    IntegrableObjectIndex* ioIndex = info_->getIntegrableObjectIndex();
+
+    for (int t = 0; t < IntegrableObjectIndex::ioNSpanTypes; t++) {
+      IntegrableObjectIndex::Span& span = ioIndex->getSpan(t);
+      DataStorage& data = snap->*(span.storage);
+
+      for (int n = 0; n < span.size(); n++) {
+        int idx = span.localIndex[n];
+        frc[span.offset + n] = data.force[idx];
+        if (span.directional) trq[span.offset + n] = data.torque[idx];
+      }
+    }
+  }
+
+  void RESPA::saveTotals(TierTotals& totals) {
+    totals.bondPotential = snap->getBondPotential();
+    totals.bendPotential = snap->getBendPotential();
+    totals.torsionPotential = snap->getTorsionPotential();
+    totals.inversionPotential = snap->getInversionPotential();
+    totals.reciprocalPotential = snap->getReciprocalPotential();
+    totals.longRangePotentials = snap->getLongRangePotentials();
+    totals.excludedPotentials = snap->getExcludedPotentials();
+    totals.selectionPotentials = snap->getSelectionPotentials();
+    totals.stressTensor = snap->getStressTensor();
+
+    DataStorage& data = snap->atomData;
+    int layout = data.getStorageLayout();
+    if (layout & DataStorage::dslParticlePot) 
+      totals.particlePot = data.particlePot;
+    if (layout & DataStorage::dslFlucQForce) 
+      totals.flucQFrc = data.flucQFrc;
+    if (layout & DataStorage::dslSitePotential) 
+      totals.sitePotential = data.sitePotential;
+    if (layout & DataStorage::dslElectricField) {
+      totals.electricField = data.electricField;
+      totals.rbElectricField = snap->rigidbodyData.electricField;
+    }
+  }
+
+  void RESPA::addTotals(const TierTotals& totals) {
+    // the tiers that were not evaluated leave these at zero:
+    snap->setBondPotential(snap->getBondPotential() + totals.bondPotential);
+    snap->setBendPotential(snap->getBendPotential() + totals.bendPotential);
+    snap->setTorsionPotential(snap->getTorsionPotential() + 
+                              totals.torsionPotential);
+    snap->setInversionPotential(snap->getInversionPotential() + 
+                                totals.inversionPotential);
+    snap->setLongRangePotential(snap->getLongRangePotentials() + 
+                                totals.longRangePotentials);
+    snap->setExcludedPotentials(snap->getExcludedPotentials() + 
+                                totals.excludedPotentials);
+    snap->setSelectionPotentials(snap->getSelectionPotentials() + 
+                                 totals.selectionPotentials);
+    Mat3x3d stress = snap->getStressTensor();
+    stress += totals.stressTensor;
+    snap->setStressTensor(stress);
+
+    DataStorage& data = snap->atomData;
+    for (unsigned int i = 0; i < totals.particlePot.size(); i++) 
+      data.particlePot[i] += totals.particlePot[i];
+    for (unsigned int i = 0; i < totals.flucQFrc.size(); i++) 
+      data.flucQFrc[i] += totals.flucQFrc[i];
+    for (unsigned int i = 0; i < totals.sitePotential.size(); i++) 
+      data.sitePotential[i] += totals.sitePotential[i];
+    for (unsigned int i = 0; i < totals.electricField.size(); i++) 
+      data.electricField[i] += totals.electricField[i];
+    for (unsigned int i = 0; i < totals.rbElectricField.size(); i++) 
+      snap->rigidbodyData.electricField[i] += totals.rbElectricField[i];
+  }
+
+  void RESPA::setTotalForces() {
+    IntegrableObjectIndex* ioIndex = info_->getIntegrableObjectIndex();
+
+    for (int t = 0; t < IntegrableObjectIndex::ioNSpanTypes; t++) {
+      IntegrableObjectIndex::Span& span = ioIndex->getSpan(t);
+      DataStorage& data = snap->*(span.storage);
+
+      for (int n = 0; n < span.size(); n++) {
+        int idx = span.localIndex[n];
+        int i = span.offset + n;
+        data.force[idx] = fastFrc_[i] + mediumFrc_[i] + slowFrc_[i];
+        if (span.directional) 
+          data.torque[idx] = fastTrq_[i] + mediumTrq_[i] + slowTrq_[i];
+      }
+    }
+  }
+
+  void RESPA::kick(RealType hFast, RealType hMedium, RealType hSlow) {
+    IntegrableObjectIndex* ioIndex = info_->getIntegrableObjectIndex();
+    Vector3d frc, trq;
+
+    for (int t = 0; t < IntegrableObjectIndex::ioNSpanTypes; t++) {
+      IntegrableObjectIndex::Span& span = ioIndex->getSpan(t);
+      DataStorage& data = snap->*(span.storage);
+
+      for (int n = 0; n < span.size(); n++) {
+        int idx = span.localIndex[n];
+        int i = span.offset + n;
+
+        frc = hFast * fastFrc_[i] + hMedium * mediumFrc_[i] + 
+          hSlow * slowFrc_[i];
+        data.velocity[idx] += (Constants::energyConvert / span.mass[n]) * frc;
+
+        if (span.directional) {
+          trq = hFast * fastTrq_[i] + hMedium * mediumTrq_[i] + 
+            hSlow * slowTrq_[i];
+          data.angularMomentum[idx] += Constants::energyConvert * 
+            (data.aMat[idx] * trq);
+        }
+      }
+    }
+  }
+
+  void RESPA::drift(RealType h) {
+    IntegrableObjectIndex* ioIndex = info_->getIntegrableObjectIndex();
+    bool doConstraints = (info_->getNGlobalConstraints() > 0);
+    Vector3d ji;
+
+    // Rattle uses the previous positions as the reference
+    // configuration, which must be the start of this fast step:
+    if (doConstraints) {
+      Snapshot* prev = info_->getSnapshotManager()->getPrevSnapshot();
+      prev->atomData.position = snap->atomData.position;
+      prev->rigidbodyData.position = snap->rigidbodyData.position;
+    }
+
+    for (int t = 0; t < IntegrableObjectIndex::ioNSpanTypes; t++) {
+      IntegrableObjectIndex::Span& span = ioIndex->getSpan(t);
+      DataStorage& data = snap->*(span.storage);
+
+      for (int n = 0; n < span.size(); n++) {
+        int idx = span.localIndex[n];
+        data.position[idx] += h * data.velocity[idx];
+
+        if (span.directional) {
+          ji = data.angularMomentum[idx];
+          rotAlgo_->rotate(span.sd[n], ji, h);
+          data.angularMomentum[idx] = ji;
+        }
+      }
+    }
+
+    if (doConstraints) rattle_->constraintA();
+  }
+
+  RealType RESPA::calcConservedQuantity() {
+    return thermo.getTotalEnergy();
+  }
+}
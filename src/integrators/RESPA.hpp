@@ -0,0 +1,136 @@
+/*
+ * Copyright (c) 2018 The University of Notre Dame. All Rights Reserved.
+ *
+ * The University of Notre Dame grants you ("Licensee") a
+ * non-exclusive, royalty free, license to use, modify and
+ * redistribute this software in source and binary code form, provided
+ * that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the
+ *    distribution.
+ *
+ * This software is provided "AS IS," without a warranty of any
+ * kind. All express or implied conditions, representations and
+ * warranties, including any implied warranty of merchantability,
+ * fitness for a particular purpose or non-infringement, are hereby
+ * excluded.  The University of Notre Dame and its licensors shall not
+ * be liable for any damages suffered by licensee as a result of
+ * using, modifying or distributing the software or its
+ * derivatives. In no event will the University of Notre Dame or its
+ * licensors be liable for any lost revenue, profit or data, or for
+ * direct, indirect, special, consequential, incidental or punitive
+ * damages, however caused and regardless of the theory of liability,
+ * arising out of the use of or inability to use software, even if the
+ * University of Notre Dame has been advised of the possibility of
+ * such damages.
+ *
+ * SUPPORT OPEN SCIENCE!  If you use OpenMD or its source code in your
+ * research, please cite the appropriate papers when you publish your
+ * work.  Good starting points are:
+ *                                                                      
+ * [1]  Meineke, et al., J. Comp. Chem. 26, 252-271 (2005).             
+ * [2]  Fennell & Gezelter, J. Chem. Phys. 124, 234104 (2006).          
+ * [3]  Sun, Lin & Gezelter, J. Chem. Phys. 128, 234107 (2008).          
+ * [4]  Kuang & Gezelter,  J. Chem. Phys. 133, 164101 (2010).
+ * [5]  Vardeman, Stocker & Gezelter, J. Chem. Theory Comput. 7, 834 (2011).
+ */
+ 
+#ifndef INTEGRATORS_RESPA_HPP
+#define INTEGRATORS_RESPA_HPP
+
+#include "integrators/VelocityVerletIntegrator.hpp"
+
+namespace OpenMD {
+
+  /**
+   * @class RESPA RESPA.hpp "integrators/RESPA.hpp"
+   * @brief Reversible multiple time step (r-RESPA) integrator
+   *
+   * The forces are split into three tiers: bonded interactions (fast),
+   * real-space non-bonded interactions (medium) and reciprocal-space
+   * sums (slow).  The outer time step is dt, each outer step contains
+   * respaMediumSteps medium steps, and each of those contains
+   * respaFastSteps fast steps.  When no reciprocal-space sum is in use,
+   * or respaMediumSteps is 1, the slow tier is folded into the medium
+   * tier.  See Tuckerman, Berne and Martyna, J. Chem. Phys. 97, 1990
+   * (1992).
+   *
+   * Each tier is evaluated once per outer step.  The snapshot then
+   * holds the sum of the tiers, so the reported energies, stress
+   * and forces are those of the full force field.
+   */
+  class RESPA : public VelocityVerletIntegrator {
+  public:
+    RESPA(SimInfo* info);
+
+  protected:
+    virtual void initialize();
+    virtual void doUpdateSizes();
+    virtual void saveState(std::ostream& os);
+    virtual void loadState(std::istream& is);
+
+  private:
+    /**
+     * The snapshot quantities that one force tier evaluation leaves
+     * behind, which are summed over the tiers at the end of a step.
+     */
+    struct TierTotals {
+      RealType bondPotential;
+      RealType bendPotential;
+      RealType torsionPotential;
+      RealType inversionPotential;
+      RealType reciprocalPotential;
+      potVec longRangePotentials;
+      potVec excludedPotentials;
+      potVec selectionPotentials;
+      Mat3x3d stressTensor;
+      std::vector<RealType> particlePot;
+      std::vector<RealType> flucQFrc;
+      std::vector<RealType> sitePotential;
+      std::vector<Vector3d> electricField;
+      std::vector<Vector3d> rbElectricField;
+    };
+
+    virtual void moveA();
+    virtual void moveB();
+    virtual void calcForce();
+    virtual RealType calcConservedQuantity();
+
+    /** fast (and optionally medium) forces at an intermediate step */
+    void calcInnerForces(bool doMedium);
+    /** copies the current forces and torques in the flat ordering */
+    void saveForces(std::vector<Vector3d>& frc, std::vector<Vector3d>& trq);
+    /** copies the snapshot quantities of the last tier evaluation */
+    void saveTotals(TierTotals& totals);
+    /** adds the totals of an earlier tier into the snapshot */
+    void addTotals(const TierTotals& totals);
+    /** sets the forces and torques to the sum of the three tiers */
+    void setTotalForces();
+    /** velocity and angular momentum update with weighted tier forces */
+    void kick(RealType hFast, RealType hMedium, RealType hSlow);
+    /** position and orientation update, followed by constraints */
+    void drift(RealType h);
+
+    int nFast_;
+    int nMedium_;
+    RealType dtMedium_;
+    RealType dtFast_;
+
+    std::vector<Vector3d> fastFrc_;
+    std::vector<Vector3d> fastTrq_;
+    std::vector<Vector3d> mediumFrc_;
+    std::vector<Vector3d> mediumTrq_;
+    std::vector<Vector3d> slowFrc_;
+    std::vector<Vector3d> slowTrq_;
+    TierTotals fastTotals_;
+    TierTotals slowTotals_;
+  };
+
+} //end namespace OpenMD
+
+#endif //INTEGRATORS_RESPA_HPP
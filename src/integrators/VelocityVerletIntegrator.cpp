@@ -51,41 +51,56 @@
 #include "integrators/DLM.hpp"
 #include "utils/StringUtils.hpp"
 #include "utils/ProgressBar.hpp"
+#include "utils/TimerRegistry.hpp"
+#include "utils/PerformanceCounters.hpp"
+#include "utils/BinaryIO.hpp"
+#include <fstream>
+#include <sstream>
 
 namespace OpenMD {
-  VelocityVerletIntegrator::VelocityVerletIntegrator(SimInfo *info) : Integrator(info) { 
+  VelocityVerletIntegrator::VelocityVerletIntegrator(SimInfo *info) : 
+    Integrator(info), checkpoint(NULL) { 
     dt2 = 0.5 * dt;
   }
   
   VelocityVerletIntegrator::~VelocityVerletIntegrator() { 
+    delete checkpoint;
   }
   
   void VelocityVerletIntegrator::initialize(){
     
     forceMan_->initialize();
     
-    // remove center of mass drift velocity (in case we passed in a
-    // configuration that was drifting)
-    velocitizer_->removeComDrift();
+    if (!restartFromCheckpoint) {
+      // remove center of mass drift velocity (in case we passed in a
+      // configuration that was drifting)
+      velocitizer_->removeComDrift();
+    }
 
     // find the initial fluctuating charges.
     flucQ_->initialize();
-    
-    // initialize the forces before the first step
-    calcForce();
-    
-    // execute the constraint algorithm to make sure that the system is
-    // constrained at the very beginning  
-    if (info_->getNGlobalConstraints() > 0) {
-      rattle_->constraintA();
+
+    // A checkpoint already holds the forces of the first step.
+    // Recomputing them would also build a neighbor list the
+    // uninterrupted run never had, so the resumed run would no longer
+    // follow it exactly.
+    if (!restartFromCheckpoint) {
+      // initialize the forces before the first step
       calcForce();
-      rattle_->constraintB();      
-      //copy the current snapshot to previous snapshot
-      info_->getSnapshotManager()->advance();
-    }
     
-    if (needVelocityScaling) {
-      velocitizer_->randomize(targetScalingTemp);
+      // execute the constraint algorithm to make sure that the system is
+      // constrained at the very beginning  
+      if (info_->getNGlobalConstraints() > 0) {
+        rattle_->constraintA();
+        calcForce();
+        rattle_->constraintB();      
+        //copy the current snapshot to previous snapshot
+        info_->getSnapshotManager()->advance();
+      }
+    
+      if (needVelocityScaling) {
+        velocitizer_->randomize(targetScalingTemp);
+      }
     }
     
     dumpWriter = createDumpWriter();    
@@ -112,6 +127,22 @@ namespace OpenMD {
     if (simParams->getRNEMDParameters()->getUseRNEMD()){
       currRNEMD = RNEMD_exchangeTime + snap->getTime();
     }
+    if (correlators_ != NULL) {
+      correlators_->collectData();
+      currCorrelate = correlators_->getSampleTime() + snap->getTime();
+    }
+    if (needCheckpoint) {
+      currCheckpoint = checkpointTime + snap->getTime();
+      checkpoint = new Checkpoint(info_, info_->getCheckpointFileName());
+    }
+    if (restartFromCheckpoint) {
+      // the schedules, random number streams and accumulators
+      // continue from where the checkpointed run left off:
+      Checkpoint restart(info_, simParams->getRestartCheckpoint());
+      std::istringstream state(restart.readState(), 
+                               std::ios::in | std::ios::binary);
+      loadState(state);
+    }
     needPotential = false;
     needStress = false;       
     
@@ -129,6 +160,16 @@ namespace OpenMD {
     finalize();
   }
 
+  void VelocityVerletIntegrator::doIntegrateUntil(RealType time) {
+    // half a step of slack keeps roundoff in the accumulated time
+    // from adding or dropping a step at the end of each piece:
+    while (snap->getTime() <= runTime && snap->getTime() < time - dt2) {
+      preStep();
+      integrateStep();
+      postStep();
+    }
+  }
+
 
   void VelocityVerletIntegrator::preStep() {
     
@@ -155,14 +196,29 @@ namespace OpenMD {
       }
       rnemd_->collectData();
     }
+
+    if (correlators_ != NULL) {
+      // the sample time is often dt itself, so allow for roundoff:
+      RealType difference = snap->getTime() - currCorrelate;
+      if (difference > 0 || fabs(difference) < OpenMD::epsilon) {
+        correlators_->collectData();
+        currCorrelate += correlators_->getSampleTime();
+      }
+    }
     
     if (snap->getTime() >= currSample) {
+      static int dumpTimer = 
+        TimerRegistry::getInstance()->getTimerID("Output/Dump");
+      ScopedTimer dumpScope(dumpTimer);
       dumpWriter->writeDumpAndEor();
       
       currSample += sampleTime;
     }
     
     if (snap->getTime() >= currStatus) {
+      static int statTimer = 
+        TimerRegistry::getInstance()->getTimerID("Output/Stat");
+      ScopedTimer statScope(statTimer);
       //save statistics, before writeStat,  we must save statistics
       saveConservedQuantity();
       stats->collectStats();
@@ -170,6 +226,9 @@ namespace OpenMD {
       if (simParams->getRNEMDParameters()->getUseRNEMD()) {
 	rnemd_->writeOutputFile();
       }
+      if (correlators_ != NULL) {
+        correlators_->writeOutputFile();
+      }
 
       statWriter->writeStat();
 
@@ -191,6 +250,59 @@ namespace OpenMD {
     //increase time
     snap->increaseTime(dt);        
 
+    if (needCheckpoint && snap->getTime() >= currCheckpoint) {
+      currCheckpoint += checkpointTime;
+      writeCheckpoint();
+    }
+  }
+
+  void VelocityVerletIntegrator::writeCheckpoint() {
+    static int checkpointTimer = 
+      TimerRegistry::getInstance()->getTimerID("Output/Checkpoint");
+    ScopedTimer checkpointScope(checkpointTimer);
+
+    std::ostringstream state(std::ios::out | std::ios::binary);
+    saveState(state);
+    checkpoint->write(state.str());
+  }
+
+  void VelocityVerletIntegrator::saveState(std::ostream& os) {
+    writeBinary(os, currSample);
+    writeBinary(os, currStatus);
+    writeBinary(os, currThermal);
+    writeBinary(os, currReset);
+    writeBinary(os, currRNEMD);
+    writeBinary(os, currCorrelate);
+    writeBinary(os, currCheckpoint);
+    velocitizer_->saveState(os);
+    forceMan_->saveState(os);
+    forceMan_->saveNeighborList(os);
+    flucQ_->saveState(os);
+    if (useRNEMD) rnemd_->saveState(os);
+  }
+
+  void VelocityVerletIntegrator::loadState(std::istream& is) {
+    readBinary(is, currSample);
+    readBinary(is, currStatus);
+    readBinary(is, currThermal);
+    readBinary(is, currReset);
+    readBinary(is, currRNEMD);
+    readBinary(is, currCorrelate);
+    readBinary(is, currCheckpoint);
+    velocitizer_->loadState(is);
+    forceMan_->loadState(is);
+    forceMan_->loadNeighborList(is);
+    flucQ_->loadState(is);
+    if (useRNEMD) rnemd_->loadState(is);
+
+    if (!is) {
+      sprintf(painCave.errMsg,
+              "Checkpoint: the stored integrator state does not match\n"
+              "\tthis simulation (was it written by a different ensemble?).\n");
+      painCave.isFatal = 1;
+      painCave.severity = OPENMD_ERROR;
+      simError();
+    }
   }
 
 
@@ -199,10 +311,31 @@ namespace OpenMD {
     if (simParams->getRNEMDParameters()->getUseRNEMD()) {
       rnemd_->writeOutputFile();
     }
+    if (correlators_ != NULL) {
+      correlators_->writeOutputFile();
+    }
     progressBar->setStatus(runTime, runTime);
     progressBar->update();
 
     statWriter->writeStatReport();
+
+    if (simParams->getPrintTimings() && 
+        TimerRegistry::getInstance()->isEnabled()) {
+      // collective in parallel runs; only the primary rank gets text
+      std::cout << TimerRegistry::getInstance()->getReport();
+    }
+
+    PerformanceCounters* counters = PerformanceCounters::getInstance();
+    if (counters->isEnabled()) {
+      // also collective; the primary rank writes <prefix>.perf.json
+      std::string json = 
+        counters->getJSON(TimerRegistry::getInstance()->getWallTime());
+      if (!json.empty()) {
+        std::ofstream perfFile((getPrefix(info_->getStatFileName()) + 
+                                ".perf.json").c_str());
+        perfFile << json;
+      }
+    }
  
     delete dumpWriter;
     delete statWriter;
@@ -212,10 +345,18 @@ namespace OpenMD {
   }
 
   void VelocityVerletIntegrator::integrateStep() {
+    TimerRegistry* timers = TimerRegistry::getInstance();
+    static int integrateTimer = timers->getTimerID("Integrate");
 
+    timers->start(integrateTimer);
     moveA();
+    timers->stop(integrateTimer);
+
     calcForce();
+
+    timers->start(integrateTimer);
     moveB();
+    timers->stop(integrateTimer);
   }
 
 
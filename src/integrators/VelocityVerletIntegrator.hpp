@@ -55,6 +55,7 @@
 #include "flucq/FluctuatingChargePropagator.hpp"
 #include "constraints/Rattle.hpp"
 #include "utils/ProgressBar.hpp"
+#include "io/Checkpoint.hpp"
 
 namespace OpenMD {
 
@@ -71,12 +72,21 @@ namespace OpenMD {
 
     VelocityVerletIntegrator(SimInfo* info);
     virtual void doIntegrate();
+    virtual void doInitialize() { initialize(); }
+    virtual void doIntegrateUntil(RealType time);
+    virtual void doFinalize() { finalize(); }
     virtual void initialize();
     virtual void preStep();
     virtual void integrateStep();        
     virtual void postStep();
     virtual void finalize();
     virtual void resetIntegrator() {}
+
+    /** Writes the state a checkpoint needs beyond the snapshot */
+    virtual void saveState(std::ostream& os);
+    /** Restores the state written by saveState */
+    virtual void loadState(std::istream& is);
+    void writeCheckpoint();
     
     RealType dt2;
     RealType currSample;
@@ -84,6 +94,8 @@ namespace OpenMD {
     RealType currThermal;
     RealType currReset;
     RealType currRNEMD;
+    RealType currCorrelate;
+    RealType currCheckpoint;
         
   private:
         
@@ -95,6 +107,7 @@ namespace OpenMD {
     virtual StatWriter* createStatWriter();
 
     ProgressBar* progressBar;
+    Checkpoint* checkpoint;
 
   };
 
@@ -51,7 +51,8 @@ namespace OpenMD {
 
     Globals* simParams = info_->getSimParams();
 
-    if (!simParams->getUseIntialExtendedSystemState()) {
+    if (!simParams->getUseIntialExtendedSystemState() &&
+        !simParams->haveRestartCheckpoint()) {
       Snapshot* snap = info_->getSnapshotManager()->getCurrentSnapshot();
       snap->setThermostat(make_pair(0.0, 0.0));
     }
@@ -0,0 +1,280 @@
+/*
+ * Copyright (c) 2018 The University of Notre Dame. All Rights Reserved.
+ *
+ * The University of Notre Dame grants you ("Licensee") a
+ * non-exclusive, royalty free, license to use, modify and
+ * redistribute this software in source and binary code form, provided
+ * that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the
+ *    distribution.
+ *
+ * This software is provided "AS IS," without a warranty of any
+ * kind. All express or implied conditions, representations and
+ * warranties, including any implied warranty of merchantability,
+ * fitness for a particular purpose or non-infringement, are hereby
+ * excluded.  The University of Notre Dame and its licensors shall not
+ * be liable for any damages suffered by licensee as a result of
+ * using, modifying or distributing the software or its
+ * derivatives. In no event will the University of Notre Dame or its
+ * licensors be liable for any lost revenue, profit or data, or for
+ * direct, indirect, special, consequential, incidental or punitive
+ * damages, however caused and regardless of the theory of liability,
+ * arising out of the use of or inability to use software, even if the
+ * University of Notre Dame has been advised of the possibility of
+ * such damages.
+ *
+ * SUPPORT OPEN SCIENCE!  If you use OpenMD or its source code in your
+ * research, please cite the appropriate papers when you publish your
+ * work.  Good starting points are:
+ *                                                                      
+ * [1]  Meineke, et al., J. Comp. Chem. 26, 252-271 (2005).             
+ * [2]  Fennell & Gezelter, J. Chem. Phys. 124, 234104 (2006).          
+ * [3]  Sun, Lin & Gezelter, J. Chem. Phys. 128, 234107 (2008).          
+ * [4]  Kuang & Gezelter,  J. Chem. Phys. 133, 164101 (2010).
+ * [5]  Vardeman, Stocker & Gezelter, J. Chem. Theory Comput. 7, 834 (2011).
+ */
+
+#include "config.h"
+
+#ifdef IS_MPI
+#include <mpi.h>
+#endif
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <vector>
+
+#include "io/Checkpoint.hpp"
+#include "brains/SnapshotManager.hpp"
+#include "utils/BinaryIO.hpp"
+#include "utils/StringUtils.hpp"
+#include "utils/simError.h"
+
+namespace OpenMD {
+
+  static const char checkpointMagic[8] = {'O','M','D','C','H','K','P','T'};
+  static const int checkpointVersion = 2;
+
+  Checkpoint::Checkpoint(SimInfo* info, const std::string& filename) :
+    info_(info), filename_(filename) {
+#ifdef IS_MPI
+    // only the primary rank knows the output file names:
+    int nameLength = filename_.size();
+    MPI_Bcast(&nameLength, 1, MPI_INT, 0, MPI_COMM_WORLD);
+    std::vector<char> name(filename_.begin(), filename_.end());
+    name.resize(nameLength);
+    MPI_Bcast(&name[0], nameLength, MPI_CHAR, 0, MPI_COMM_WORLD);
+    filename_.assign(name.begin(), name.end());
+
+    int myRank;
+    MPI_Comm_rank(MPI_COMM_WORLD, &myRank);
+    filename_ += "." + OpenMD_itoa(myRank);
+#endif
+  }
+
+  void Checkpoint::write(const std::string& state) {
+    Snapshot* snap = info_->getSnapshotManager()->getCurrentSnapshot();
+    std::string tmpName = filename_ + ".tmp";
+    std::ofstream os(tmpName.c_str(), std::ios::out | std::ios::binary | 
+                     std::ios::trunc);
+    if (!os) {
+      sprintf(painCave.errMsg,
+              "Checkpoint: could not open \"%s\" for writing.\n",
+              tmpName.c_str());
+      painCave.isFatal = 1;
+      painCave.severity = OPENMD_ERROR;
+      simError();
+    }
+
+    int nProcessors = 1;
+#ifdef IS_MPI
+    MPI_Comm_size(MPI_COMM_WORLD, &nProcessors);
+#endif
+
+    os.write(checkpointMagic, sizeof(checkpointMagic));
+    writeBinary(os, checkpointVersion);
+    writeBinary(os, int(sizeof(RealType)));
+    writeBinary(os, Snapshot::getFrameDataSize());
+    writeBinary(os, nProcessors);
+    writeBinary(os, int(snap->atomData.getSize()));
+    writeBinary(os, int(snap->rigidbodyData.getSize()));
+    writeBinary(os, int(snap->cgData.getSize()));
+
+    writeBinary(os, snap->frameData);
+    writeStorage(os, snap->atomData);
+    writeStorage(os, snap->rigidbodyData);
+    writeStorage(os, snap->cgData);
+    writeBinary(os, state);
+
+    os.close();
+    if (os.fail()) {
+      sprintf(painCave.errMsg,
+              "Checkpoint: error writing \"%s\".\n", tmpName.c_str());
+      painCave.isFatal = 1;
+      painCave.severity = OPENMD_ERROR;
+      simError();
+    }
+
+    if (std::rename(tmpName.c_str(), filename_.c_str()) != 0) {
+      sprintf(painCave.errMsg,
+              "Checkpoint: could not rename \"%s\" to \"%s\".\n",
+              tmpName.c_str(), filename_.c_str());
+      painCave.isFatal = 1;
+      painCave.severity = OPENMD_ERROR;
+      simError();
+    }
+  }
+
+  void Checkpoint::readSnapshot() {
+    std::string state;
+    read(true, state);
+
+    Snapshot* snap = info_->getSnapshotManager()->getCurrentSnapshot();
+    sprintf(painCave.errMsg,
+            "Checkpoint: resuming from \"%s\" at time %f fs.\n",
+            filename_.c_str(), snap->getTime());
+    painCave.isFatal = 0;
+    painCave.severity = OPENMD_INFO;
+    simError();
+  }
+
+  std::string Checkpoint::readState() {
+    std::string state;
+    read(false, state);
+    return state;
+  }
+
+  void Checkpoint::read(bool loadSnapshot, std::string& state) {
+    std::ifstream is(filename_.c_str(), std::ios::in | std::ios::binary);
+    if (!is) {
+      sprintf(painCave.errMsg,
+              "Checkpoint: could not open \"%s\" for reading.\n",
+              filename_.c_str());
+      painCave.isFatal = 1;
+      painCave.severity = OPENMD_ERROR;
+      simError();
+    }
+
+    char magic[sizeof(checkpointMagic)];
+    int version(0), realSize(0), frameSize(0), nProcessors(0);
+    is.read(magic, sizeof(magic));
+    readBinary(is, version);
+    if (!is || memcmp(magic, checkpointMagic, sizeof(magic)) != 0 ||
+        version != checkpointVersion) {
+      sprintf(painCave.errMsg,
+              "Checkpoint: \"%s\" is not a version %d checkpoint file.\n",
+              filename_.c_str(), checkpointVersion);
+      painCave.isFatal = 1;
+      painCave.severity = OPENMD_ERROR;
+      simError();
+    }
+
+    readBinary(is, realSize);
+    readBinary(is, frameSize);
+    if (realSize != int(sizeof(RealType)) || 
+        frameSize != Snapshot::getFrameDataSize()) {
+      sprintf(painCave.errMsg,
+              "Checkpoint: \"%s\" was written by a different build of\n"
+              "\tOpenMD (RealType or snapshot sizes differ).\n",
+              filename_.c_str());
+      painCave.isFatal = 1;
+      painCave.severity = OPENMD_ERROR;
+      simError();
+    }
+
+    int myProcessors = 1;
+#ifdef IS_MPI
+    MPI_Comm_size(MPI_COMM_WORLD, &myProcessors);
+#endif
+    readBinary(is, nProcessors);
+    if (nProcessors != myProcessors) {
+      sprintf(painCave.errMsg,
+              "Checkpoint: \"%s\" was written by a run on %d processors,\n"
+              "\tbut this run uses %d.\n",
+              filename_.c_str(), nProcessors, myProcessors);
+      painCave.isFatal = 1;
+      painCave.severity = OPENMD_ERROR;
+      simError();
+    }
+
+    Snapshot* snap = info_->getSnapshotManager()->getCurrentSnapshot();
+    int nAtoms(0), nRigidBodies(0), nCutoffGroups(0);
+    readBinary(is, nAtoms);
+    readBinary(is, nRigidBodies);
+    readBinary(is, nCutoffGroups);
+    if (nAtoms != int(snap->atomData.getSize()) ||
+        nRigidBodies != int(snap->rigidbodyData.getSize()) ||
+        nCutoffGroups != int(snap->cgData.getSize())) {
+      sprintf(painCave.errMsg,
+              "Checkpoint: \"%s\" holds %d atoms, %d rigid bodies and\n"
+              "\t%d cutoff groups, which does not match this system.\n",
+              filename_.c_str(), nAtoms, nRigidBodies, nCutoffGroups);
+      painCave.isFatal = 1;
+      painCave.severity = OPENMD_ERROR;
+      simError();
+    }
+
+    if (loadSnapshot) {
+      readBinary(is, snap->frameData);
+      // the derived quantities are recomputed from the stored terms:
+      snap->clearDerivedProperties();
+    } else {
+      is.ignore(frameSize);
+    }
+    readStorage(is, snap->atomData, loadSnapshot);
+    readStorage(is, snap->rigidbodyData, loadSnapshot);
+    readStorage(is, snap->cgData, loadSnapshot);
+    readBinary(is, state);
+
+    if (!is) {
+      sprintf(painCave.errMsg,
+              "Checkpoint: \"%s\" is truncated.\n", filename_.c_str());
+      painCave.isFatal = 1;
+      painCave.severity = OPENMD_ERROR;
+      simError();
+    }
+  }
+
+  void Checkpoint::writeStorage(std::ostream& os, DataStorage& storage) {
+    int layout = storage.getStorageLayout();
+    writeBinary(os, layout);
+    for (int array = 1; array <= DataStorage::dslSitePotential; array <<= 1){
+      if (layout & array) {
+        os.write(reinterpret_cast<const char*>(storage.getArrayPointer(array)),
+                 storage.getSize() * 
+                 DataStorage::getBytesPerStuntDouble(array));
+      }
+    }
+  }
+
+  /**
+   * Arrays are matched by their layout bits.  Stored arrays this run
+   * does not keep are skipped, and arrays this run keeps that were not
+   * stored (e.g. newly requested output fields) are left as they are.
+   */
+  void Checkpoint::readStorage(std::istream& is, DataStorage& storage, 
+                               bool loadSnapshot) {
+    int layout = 0;
+    readBinary(is, layout);
+    for (int array = 1; array <= DataStorage::dslSitePotential; array <<= 1){
+      if (layout & array) {
+        std::size_t bytes = storage.getSize() * 
+          DataStorage::getBytesPerStuntDouble(array);
+        if (loadSnapshot && (storage.getStorageLayout() & array)) {
+          is.read(reinterpret_cast<char*>(storage.getArrayPointer(array)),
+                  bytes);
+        } else {
+          is.ignore(bytes);
+        }
+      }
+    }
+  }
+
+}
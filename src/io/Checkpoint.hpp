@@ -0,0 +1,97 @@
+/*
+ * Copyright (c) 2018 The University of Notre Dame. All Rights Reserved.
+ *
+ * The University of Notre Dame grants you ("Licensee") a
+ * non-exclusive, royalty free, license to use, modify and
+ * redistribute this software in source and binary code form, provided
+ * that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the
+ *    distribution.
+ *
+ * This software is provided "AS IS," without a warranty of any
+ * kind. All express or implied conditions, representations and
+ * warranties, including any implied warranty of merchantability,
+ * fitness for a particular purpose or non-infringement, are hereby
+ * excluded.  The University of Notre Dame and its licensors shall not
+ * be liable for any damages suffered by licensee as a result of
+ * using, modifying or distributing the software or its
+ * derivatives. In no event will the University of Notre Dame or its
+ * licensors be liable for any lost revenue, profit or data, or for
+ * direct, indirect, special, consequential, incidental or punitive
+ * damages, however caused and regardless of the theory of liability,
+ * arising out of the use of or inability to use software, even if the
+ * University of Notre Dame has been advised of the possibility of
+ * such damages.
+ *
+ * SUPPORT OPEN SCIENCE!  If you use OpenMD or its source code in your
+ * research, please cite the appropriate papers when you publish your
+ * work.  Good starting points are:
+ *                                                                      
+ * [1]  Meineke, et al., J. Comp. Chem. 26, 252-271 (2005).             
+ * [2]  Fennell & Gezelter, J. Chem. Phys. 124, 234104 (2006).          
+ * [3]  Sun, Lin & Gezelter, J. Chem. Phys. 128, 234107 (2008).          
+ * [4]  Kuang & Gezelter,  J. Chem. Phys. 133, 164101 (2010).
+ * [5]  Vardeman, Stocker & Gezelter, J. Chem. Theory Comput. 7, 834 (2011).
+ */
+
+#ifndef IO_CHECKPOINT_HPP
+#define IO_CHECKPOINT_HPP
+
+#include <iostream>
+#include <string>
+
+#include "brains/SimInfo.hpp"
+#include "brains/DataStorage.hpp"
+
+namespace OpenMD {
+
+  /**
+   * @class Checkpoint Checkpoint.hpp "io/Checkpoint.hpp"
+   * @brief Binary checkpoints for resuming a run exactly.
+   *
+   * A checkpoint holds the whole current Snapshot at full precision
+   * (the FrameData and every array in the atom, rigid body and cutoff
+   * group storage), followed by a block of state supplied by the
+   * integrator (output schedules, random number streams, the neighbor
+   * list, RNEMD accumulators and the like).  Values are written in native binary
+   * form, so a checkpoint can only be read by the same build on the
+   * same kind of machine.  In parallel, each processor writes and
+   * reads its own file (<filename>.<rank>), so a run must be resumed
+   * on the same number of processors.
+   */
+  class Checkpoint {
+  public:
+    Checkpoint(SimInfo* info, const std::string& filename);
+
+    /**
+     * Writes the current snapshot and the integrator state.  The
+     * data go to a temporary file which then replaces the
+     * checkpoint, so an interrupted write leaves the previous
+     * checkpoint intact.
+     */
+    void write(const std::string& state);
+
+    /** Loads the stored snapshot into the current snapshot */
+    void readSnapshot();
+
+    /** Returns the stored integrator state */
+    std::string readState();
+
+  private:
+    void read(bool loadSnapshot, std::string& state);
+    void writeStorage(std::ostream& os, DataStorage& storage);
+    void readStorage(std::istream& is, DataStorage& storage, 
+                     bool loadSnapshot);
+
+    SimInfo* info_;
+    std::string filename_;
+  };
+
+}
+#endif
@@ -205,7 +205,41 @@ namespace OpenMD {
   void DumpReader::readFrame(int whichFrame) { 
     if (!isScanned_) 
       scanFile(); 
-         
+
+    setupNeeds();
+    readSet(whichFrame); 
+    computeCOMprops();
+  }
+
+  void DumpReader::readFrame(int, const std::string& frameText) { 
+    if (!isScanned_) 
+      scanFile(); 
+
+    setupNeeds();
+    // every process that calls this has read frameText itself, so
+    // there is nothing to broadcast:
+    std::istringstream inputStream(frameText);
+    parseSet(inputStream);
+    computeCOMprops();
+  }
+
+  void DumpReader::readFrameText(std::istream& inFile, int whichFrame,
+                                 std::string& frameText) {
+    // a private line buffer, as the member buffer belongs to the parser:
+    char lineBuffer[bufferSize];
+
+    frameText.clear();
+    inFile.clear();
+    inFile.seekg(framePos_[whichFrame]);
+    
+    while (inFile.getline(lineBuffer, bufferSize)) {
+      frameText += lineBuffer;
+      frameText += '\n';
+      if (strstr(lineBuffer, "</Snapshot>") != NULL) break;
+    }
+  }
+
+  void DumpReader::setupNeeds() {
     int storageLayout = info_->getSnapshotManager()->getStorageLayout(); 
      
     if (storageLayout & DataStorage::dslPosition) { 
@@ -233,9 +267,9 @@ namespace OpenMD {
     } else { 
       needAngMom_ = false;     
     } 
-     
-    readSet(whichFrame); 
+  }
 
+  void DumpReader::computeCOMprops() {
     if (needCOMprops_) {
       Thermo thermo(info_);
       Vector3d com;
@@ -300,6 +334,12 @@ namespace OpenMD {
     std::istream& inputStream = sstream;  
 #endif
 
+    parseSet(inputStream);
+  }
+
+  void DumpReader::parseSet(std::istream& inputStream) {
+    std::string line;
+
     inputStream.getline(buffer, bufferSize);
 
     line = buffer;
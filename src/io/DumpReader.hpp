@@ -76,11 +76,29 @@ namespace OpenMD {
     }
          
     virtual void readFrame(int whichFrame); 
+
+    /**
+     * Parses a frame from text previously returned by
+     * readFrameText.  Each process parses the text it read, so the
+     * parallel version needs no broadcast.
+     */
+    void readFrame(int whichFrame, const std::string& frameText);
+
+    /**
+     * Copies the raw text of a frame out of a separately opened
+     * stream on the same dump file.  This touches no simulation
+     * state, so it may run on a different thread than the parser.
+     */
+    void readFrameText(std::istream& inFile, int whichFrame,
+                       std::string& frameText);
  
   protected: 
  
     void scanFile();  
     void readSet(int whichFrame); 
+    void parseSet(std::istream& inputStream);
+    void setupNeeds();
+    void computeCOMprops();
     virtual void parseDumpLine(const std::string&); 
     virtual void parseSiteLine(const std::string&);  
     virtual void readFrameProperties(std::istream& inputStream);
@@ -242,6 +242,11 @@ namespace OpenMD {
   }
 
   void DumpWriter::writeFrameProperties(std::ostream& os, Snapshot* s) {
+    writeFrameProperties(os, s, s->getHmat());
+  }
+
+  void DumpWriter::writeFrameProperties(std::ostream& os, Snapshot* s,
+                                        const Mat3x3d& hmat) {
 
     char buffer[1024];
 
@@ -259,9 +264,6 @@ namespace OpenMD {
     sprintf(buffer, "        Time: %.10g\n", currentTime);
     os << buffer;
 
-    Mat3x3d hmat;
-    hmat = s->getHmat();
-
     for (unsigned int i = 0; i < 3; i++) {
       for (unsigned int j = 0; j < 3; j++) {
         if (isinf(hmat(i,j)) || isnan(hmat(i,j))) {
@@ -78,11 +78,19 @@ namespace OpenMD {
     void writeDumpAndEor();
     void writeDump();
     void writeEor();
+
+    /**
+     * Writes the <FrameData> block of a snapshot.  The second form
+     * writes hmat in place of the snapshot's own box (e.g. for a
+     * replicated system).
+     */
+    static void writeFrameProperties(std::ostream& os, Snapshot* s);
+    static void writeFrameProperties(std::ostream& os, Snapshot* s,
+                                     const Mat3x3d& hmat);
     
   private:  
         
     void writeFrame(std::ostream& os);
-    void writeFrameProperties(std::ostream& os, Snapshot* s);
     std::string prepareDumpLine(StuntDouble* sd);
     std::string prepareSiteLine(StuntDouble* sd, int ioIndex, int siteIndex);
     std::ostream* createOStream(const std::string& filename);
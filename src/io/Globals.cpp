@@ -85,6 +85,8 @@ namespace OpenMD {
                             "thermodynamicIntegrationLambda");
     DefineOptionalParameter(ThermodynamicIntegrationK, 
                             "thermodynamicIntegrationK");
+    DefineOptionalParameter(ThermodynamicIntegrationLambdas, 
+                            "thermodynamicIntegrationLambdas");
     DefineOptionalParameter(ForceFieldVariant, "forceFieldVariant");
     DefineOptionalParameter(ForceFieldFileName, "forceFieldFileName");
     DefineOptionalParameter(DampingAlpha, "dampingAlpha");
@@ -146,6 +148,10 @@ namespace OpenMD {
                                             "compressDumpFile", false);
     DefineOptionalParameterWithDefaultValue(PrintHeatFlux, "printHeatFlux", 
                                             false);
+    DefineOptionalParameterWithDefaultValue(PrintTimings, "printTimings", 
+                                            true);
+    DefineOptionalParameterWithDefaultValue(PerformanceCounters, 
+                                            "performanceCounters", false);
     DefineOptionalParameterWithDefaultValue(OutputForceVector, 
                                             "outputForceVector", false);
     DefineOptionalParameterWithDefaultValue(OutputParticlePotential, 
@@ -182,6 +188,21 @@ namespace OpenMD {
     DefineOptionalParameterWithDefaultValue(HULL_Method,"HULL_Method","Convex");
 
     DefineOptionalParameterWithDefaultValue(PrivilegedAxis,"privilegedAxis","z");
+    DefineOptionalParameterWithDefaultValue(RespaFastSteps, "respaFastSteps", 4);
+    DefineOptionalParameterWithDefaultValue(RespaMediumSteps, 
+                                            "respaMediumSteps", 1);
+    DefineOptionalParameter(Correlators, "correlators");
+    DefineOptionalParameter(CorrelatorSampleTime, "correlatorSampleTime");
+    DefineOptionalParameterWithDefaultValue(CorrelatorPoints, 
+                                            "correlatorPoints", 16);
+    DefineOptionalParameterWithDefaultValue(CorrelatorAveraging, 
+                                            "correlatorAveraging", 2);
+    DefineOptionalParameter(CheckpointTime, "checkpointTime");
+    DefineOptionalParameter(RestartCheckpoint, "restartCheckpoint");
+    DefineOptionalParameterWithDefaultValue(TabulateVanDerWaals,
+                                            "tabulateVanDerWaals", false);
+    DefineOptionalParameterWithDefaultValue(VanDerWaalsTableSpacing,
+                                            "vanDerWaalsTableSpacing", 0.005);
     
     deprecatedKeywords_.insert("nComponents");
     deprecatedKeywords_.insert("nZconstraints");
@@ -226,7 +247,8 @@ namespace OpenMD {
                    isEqualIgnoreCase("NPGT") || isEqualIgnoreCase("NGammaT") || 
                    isEqualIgnoreCase("NGT") || 
                    isEqualIgnoreCase("LANGEVINHULL") || 
-                   isEqualIgnoreCase("LHULL") || isEqualIgnoreCase("SMIPD"));
+                   isEqualIgnoreCase("LHULL") || isEqualIgnoreCase("SMIPD") ||
+                   isEqualIgnoreCase("RESPA"));
     CheckParameter(Dt, isPositive());
     CheckParameter(RunTime, isPositive());
     CheckParameter(FinalConfig, isNotEmpty());
@@ -278,6 +300,14 @@ namespace OpenMD {
                    isEqualIgnoreCase("AlphaShape")); 
     CheckParameter(Alpha, isPositive()); 
     CheckParameter(StatFilePrecision, isPositive());
+    CheckParameter(RespaFastSteps, isPositive());
+    CheckParameter(RespaMediumSteps, isPositive());
+    CheckParameter(CorrelatorSampleTime, isPositive());
+    CheckParameter(CorrelatorPoints, isPositive());
+    CheckParameter(CorrelatorAveraging, isPositive());
+    CheckParameter(CheckpointTime, isPositive());
+    CheckParameter(RestartCheckpoint, isNotEmpty());
+    CheckParameter(VanDerWaalsTableSpacing, isPositive());
     CheckParameter(PrivilegedAxis,isEqualIgnoreCase("x") ||
 		   isEqualIgnoreCase("y") ||
 		   isEqualIgnoreCase("z"));
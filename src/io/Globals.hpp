@@ -68,7 +68,7 @@ namespace OpenMD {
     virtual ~Globals();
     
     DeclareParameter(ForceField, std::string);
-    DeclareParameter(TargetTemp, RealType);
+    DeclareAlterableParameter(TargetTemp, RealType);
     DeclareParameter(Ensemble, std::string);
     DeclareParameter(Dt, RealType);
     DeclareParameter(RunTime, RealType);
@@ -89,7 +89,7 @@ namespace OpenMD {
     DeclareParameter(ZconsTime, RealType);
     DeclareParameter(ZconsTol, RealType);
     DeclareParameter(ZconsForcePolicy, std::string);
-    DeclareParameter(Seed, unsigned long int);
+    DeclareAlterableParameter(Seed, unsigned long int);
     DeclareParameter(UseInitalTime, bool);
     DeclareParameter(UseIntialExtendedSystemState, bool);
     DeclareParameter(OrthoBoxTolerance, RealType);
@@ -97,13 +97,16 @@ namespace OpenMD {
     DeclareParameter(ZconsFixtime, RealType);
     DeclareParameter(ZconsUsingSMD, bool);
     DeclareParameter(UseThermodynamicIntegration, bool);
-    DeclareParameter(ThermodynamicIntegrationLambda, RealType);
+    DeclareAlterableParameter(ThermodynamicIntegrationLambda, RealType);
     DeclareParameter(ThermodynamicIntegrationK, RealType);
+    DeclareParameter(ThermodynamicIntegrationLambdas, std::vector<RealType> );
     DeclareParameter(ForceFieldVariant, std::string);
     DeclareParameter(ForceFieldFileName, std::string);
     DeclareParameter(SurfaceTension, RealType);
     DeclareParameter(PrintPressureTensor, bool);
     DeclareParameter(PrintHeatFlux, bool);
+    DeclareParameter(PrintTimings, bool);
+    DeclareParameter(PerformanceCounters, bool);
     DeclareParameter(TaggedAtomPair, intPair);
     DeclareParameter(PrintTaggedPairDistance, bool);
     DeclareParameter(ElectrostaticSummationMethod, std::string);
@@ -154,6 +157,20 @@ namespace OpenMD {
 
     DeclareParameter(PrivilegedAxis, std::string);
 
+    DeclareParameter(RespaFastSteps, int);
+    DeclareParameter(RespaMediumSteps, int);
+
+    DeclareParameter(Correlators, std::string);
+    DeclareParameter(CorrelatorSampleTime, RealType);
+    DeclareParameter(CorrelatorPoints, int);
+    DeclareParameter(CorrelatorAveraging, int);
+
+    DeclareParameter(CheckpointTime, RealType);
+    DeclareParameter(RestartCheckpoint, std::string);
+
+    DeclareParameter(TabulateVanDerWaals, bool);
+    DeclareParameter(VanDerWaalsTableSpacing, RealType);
+
   public:
     bool addComponent(Component* comp);
     bool addZConsStamp(ZConsStamp* zcons);
@@ -0,0 +1,157 @@
+/*
+ * Copyright (c) 2018 The University of Notre Dame. All Rights Reserved.
+ *
+ * The University of Notre Dame grants you ("Licensee") a
+ * non-exclusive, royalty free, license to use, modify and
+ * redistribute this software in source and binary code form, provided
+ * that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the
+ *    distribution.
+ *
+ * This software is provided "AS IS," without a warranty of any
+ * kind. All express or implied conditions, representations and
+ * warranties, including any implied warranty of merchantability,
+ * fitness for a particular purpose or non-infringement, are hereby
+ * excluded.  The University of Notre Dame and its licensors shall not
+ * be liable for any damages suffered by licensee as a result of
+ * using, modifying or distributing the software or its
+ * derivatives. In no event will the University of Notre Dame or its
+ * licensors be liable for any lost revenue, profit or data, or for
+ * direct, indirect, special, consequential, incidental or punitive
+ * damages, however caused and regardless of the theory of liability,
+ * arising out of the use of or inability to use software, even if the
+ * University of Notre Dame has been advised of the possibility of
+ * such damages.
+ *
+ * SUPPORT OPEN SCIENCE!  If you use OpenMD or its source code in your
+ * research, please cite the appropriate papers when you publish your
+ * work.  Good starting points are:
+ *                                                                      
+ * [1]  Meineke, et al., J. Comp. Chem. 26, 252-271 (2005).             
+ * [2]  Fennell & Gezelter, J. Chem. Phys. 124, 234104 (2006).          
+ * [3]  Sun, Lin & Gezelter, J. Chem. Phys. 128, 234107 (2008).          
+ * [4]  Kuang & Gezelter,  J. Chem. Phys. 133, 164101 (2010).
+ * [5]  Vardeman, Stocker & Gezelter, J. Chem. Theory Comput. 7, 834 (2011).
+ */
+
+#include "io/TabulatedInteractionsSectionParser.hpp"
+#include "brains/ForceField.hpp"
+#include "utils/Trim.hpp"
+#include "utils/simError.h"
+
+namespace OpenMD {
+
+  TabulatedInteractionsSectionParser::TabulatedInteractionsSectionParser(ForceFieldOptions& options) : options_(options){
+    setSectionName("TabulatedInteractions");
+  }
+
+  void TabulatedInteractionsSectionParser::parseLine(ForceField& ff,
+                                                     const std::string& line,
+                                                     int lineNo){
+    StringTokenizer tokenizer(line);
+    int nTokens = tokenizer.countTokens();
+
+    if (nTokens != 3 && nTokens != 5) {
+      sprintf(painCave.errMsg,
+              "TabulatedInteractionsSectionParser Error: Expected either\n"
+              "\t\"atomType1 atomType2 r V F\" or\n"
+              "\t\"atomType1 atomType2 tableFile\" at line %d\n",
+              lineNo);
+      painCave.isFatal = 1;
+      simError();
+    }
+
+    eus_  = options_.getEnergyUnitScaling();
+    dus_  = options_.getDistanceUnitScaling();
+
+    std::string at1 = tokenizer.nextToken();
+    std::string at2 = tokenizer.nextToken();
+
+    TabulatedInteractionType* tit = getInteractionType(ff, at1, at2);
+
+    if (nTokens == 3) {
+      std::string tableFile = tokenizer.nextToken();
+      parseTableFile(ff, tit, tableFile);
+    } else {
+      RealType r = tokenizer.nextTokenAsDouble();
+      RealType V = tokenizer.nextTokenAsDouble();
+      RealType F = tokenizer.nextTokenAsDouble();
+      addPoint(tit, r, V, F);
+    }
+  }
+
+  TabulatedInteractionType* TabulatedInteractionsSectionParser::getInteractionType(ForceField& ff, const std::string& at1, const std::string& at2) {
+
+    std::map<std::pair<std::string, std::string>,
+             TabulatedInteractionType*>::iterator i;
+
+    i = tables_.find(std::make_pair(at1, at2));
+    if (i != tables_.end()) return i->second;
+    i = tables_.find(std::make_pair(at2, at1));
+    if (i != tables_.end()) return i->second;
+
+    TabulatedInteractionType* tit = new TabulatedInteractionType();
+
+    std::vector<std::string> keys;
+    keys.push_back(at1);
+    keys.push_back(at2);
+    if (ff.getNonBondedInteractionTypes()->find(keys) != NULL ||
+        !ff.addNonBondedInteractionType(at1, at2, tit)) {
+      sprintf(painCave.errMsg,
+              "TabulatedInteractionsSectionParser Error: A non-bonded\n"
+              "\tinteraction for %s - %s has already been defined.\n",
+              at1.c_str(), at2.c_str());
+      painCave.isFatal = 1;
+      simError();
+    }
+    tables_[std::make_pair(at1, at2)] = tit;
+    return tit;
+  }
+
+  void TabulatedInteractionsSectionParser::addPoint(TabulatedInteractionType* tit, RealType r, RealType V, RealType F) {
+    tit->addPoint(dus_ * r, eus_ * V, eus_ * F / dus_);
+  }
+
+  void TabulatedInteractionsSectionParser::parseTableFile(ForceField& ff,
+                                                          TabulatedInteractionType* tit,
+                                                          const std::string& tableFile) {
+
+    ifstrstream* tableStream = ff.openForceFieldFile(tableFile);
+    const int bufferSize = 65535;
+    char buffer[bufferSize];
+    int lineNo = 0;
+
+    while (tableStream->getline(buffer, bufferSize)) {
+      ++lineNo;
+      std::string line = trimLeftCopy(buffer);
+
+      // skip blank lines and comments:
+      if ( line.empty() ||
+           (line.size() >= 2 && line[0] == '/' && line[1] == '/') ||
+           (line.size() >= 1 && line[0] == '#') ||
+           (line.size() >= 1 && line[0] == '!') )
+        continue;
+
+      StringTokenizer tokenizer(line);
+      if (tokenizer.countTokens() < 3) {
+        sprintf(painCave.errMsg,
+                "TabulatedInteractionsSectionParser Error: Not enough\n"
+                "\ttokens at line %d of %s\n", lineNo, tableFile.c_str());
+        painCave.isFatal = 1;
+        simError();
+      }
+      RealType r = tokenizer.nextTokenAsDouble();
+      RealType V = tokenizer.nextTokenAsDouble();
+      RealType F = tokenizer.nextTokenAsDouble();
+      addPoint(tit, r, V, F);
+    }
+    delete tableStream;
+  }
+
+} //end namespace OpenMD
@@ -279,6 +279,21 @@ pair<RealType, RealType> CubicSpline::getLimits(){
   return make_pair( x_.front(), x_.back() );
 }
 
+void CubicSpline::getCoefficients(int i, RealType& yi, RealType& bi,
+                                  RealType& ci, RealType& di) {
+  if (!generated) generate();
+  assert(i >= 0 && i < n);
+  yi = y_[i];
+  bi = b[i];
+  ci = c[i];
+  di = d[i];
+}
+
+const vector<RealType>& CubicSpline::getKnots() {
+  if (!generated) generate();
+  return x_;
+}
+
 RealType CubicSpline::getSpacing(){
   if (!generated) generate();
   assert(isUniform);
@@ -61,6 +61,14 @@ namespace OpenMD {
     void getValueAt(const RealType& t, RealType& v);
     void getValueAndDerivativeAt(const RealType& t, RealType& v, RealType& d);
     RealType getSpacing();
+    /** Returns the knots of the spline in increasing order. */
+    const vector<RealType>& getKnots();
+    /**
+     * Returns the polynomial coefficients of the spline starting at
+     * knot i:  S(t) = y + b dt + c dt^2 + d dt^3, with dt = t - x_i.
+     */
+    void getCoefficients(int i, RealType& yi, RealType& bi, RealType& ci,
+                         RealType& di);
     
   private:
     void generate();
@@ -0,0 +1,170 @@
+/*
+ * Copyright (c) 2018 The University of Notre Dame. All Rights Reserved.
+ *
+ * The University of Notre Dame grants you ("Licensee") a
+ * non-exclusive, royalty free, license to use, modify and
+ * redistribute this software in source and binary code form, provided
+ * that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the
+ *    distribution.
+ *
+ * This software is provided "AS IS," without a warranty of any
+ * kind. All express or implied conditions, representations and
+ * warranties, including any implied warranty of merchantability,
+ * fitness for a particular purpose or non-infringement, are hereby
+ * excluded.  The University of Notre Dame and its licensors shall not
+ * be liable for any damages suffered by licensee as a result of
+ * using, modifying or distributing the software or its
+ * derivatives. In no event will the University of Notre Dame or its
+ * licensors be liable for any lost revenue, profit or data, or for
+ * direct, indirect, special, consequential, incidental or punitive
+ * damages, however caused and regardless of the theory of liability,
+ * arising out of the use of or inability to use software, even if the
+ * University of Notre Dame has been advised of the possibility of
+ * such damages.
+ *
+ * SUPPORT OPEN SCIENCE!  If you use OpenMD or its source code in your
+ * research, please cite the appropriate papers when you publish your
+ * work.  Good starting points are:
+ *                                                                      
+ * [1]  Meineke, et al., J. Comp. Chem. 26, 252-271 (2005).             
+ * [2]  Fennell & Gezelter, J. Chem. Phys. 124, 234104 (2006).          
+ * [3]  Sun, Lin & Gezelter, J. Chem. Phys. 128, 234107 (2008).          
+ * [4]  Kuang & Gezelter,  J. Chem. Phys. 133, 164101 (2010).
+ * [5]  Vardeman, Stocker & Gezelter, J. Chem. Theory Comput. 7, 834 (2011).
+ */
+ 
+#ifndef MATH_FUSEDSPLINE_HPP
+#define MATH_FUSEDSPLINE_HPP
+
+#include "config.h"
+#include <cassert>
+#include <vector>
+#include <algorithm>
+#include "math/CubicSpline.hpp"
+
+using namespace std;
+namespace OpenMD {
+
+  /**
+   * @class FusedSpline
+   *
+   * A set of cubic splines on one evenly-spaced grid.  The
+   * coefficients of every spline for a given interval are stored next
+   * to each other, so evaluating several of the splines at the same
+   * point costs a single interval lookup and touches one contiguous
+   * block of memory.  Each function is splined by CubicSpline, so the
+   * values and derivatives are identical to those of separate
+   * CubicSpline objects on the same points.
+   *
+   * Only the interleaved coefficients are kept; they are copied out
+   * of each spline when it is added.  The coefficients are stored and
+   * evaluated in PairRealType, so in a MIXED_PRECISION build they are
+   * single precision.  The interval lookup is still done in RealType.
+   */
+  class FusedSpline {
+  public:
+    FusedSpline(const vector<RealType>& x) : nFunctions_(0), x_(x) {
+      n_ = x_.size();
+      assert(n_ > 1);
+      // same inverse spacing that CubicSpline uses for a uniform grid:
+      dx_ = 1.0 / (x_[1] - x_[0]);
+    }
+
+    /** Adds a function sampled on the grid and returns its index. */
+    int addFunction(const vector<RealType>& y) {
+      assert(int(y.size()) == n_);
+      CubicSpline spline;
+      spline.addPoints(x_, y);
+      return addSpline(&spline);
+    }
+
+    /**
+     * Adds a copy of an existing spline, which must have been built
+     * on the same grid, and returns its index.
+     */
+    int addSpline(CubicSpline* spline) {
+      assert(int(spline->getKnots().size()) == n_);
+
+      // widen each interval's block by one set of coefficients:
+      vector<PairRealType> coeffs(n_ * 4 * (nFunctions_ + 1));
+      RealType yj, bj, cj, dj;
+      for (int j = 0; j < n_; j++) {
+        PairRealType* c = &coeffs[j * 4 * (nFunctions_ + 1)];
+        c = copy(coeffs_.begin() + j * 4 * nFunctions_,
+                 coeffs_.begin() + (j + 1) * 4 * nFunctions_, c);
+        spline->getCoefficients(j, yj, bj, cj, dj);
+        c[0] = yj;
+        c[1] = bj;
+        c[2] = cj;
+        c[3] = dj;
+      }
+      coeffs_.swap(coeffs);
+      return nFunctions_++;
+    }
+
+    /**
+     * Evaluates the first nFunctions splines (in the order they were
+     * added) and their derivatives at t.
+     */
+    inline void getValuesAndDerivativesAt(const RealType& t, int nFunctions,
+                                          RealType* v, RealType* dv) {
+      int j = max(0, min(n_ - 1, int((t - x_[0]) * dx_)));
+      PairRealType dt = t - x_[j];
+      const PairRealType* c = &coeffs_[j * 4 * nFunctions_];
+
+      for (int k = 0; k < nFunctions; k++, c += 4) {
+        v[k] = c[0] + dt * (c[1] + dt * (c[2] + dt * c[3]));
+        dv[k] = c[1] + dt * (PairRealType(2.0) * c[2] +
+                             PairRealType(3.0) * dt * c[3]);
+      }
+    }
+
+    /** Evaluates a single spline and its derivative at t. */
+    inline void getValueAndDerivativeAt(const RealType& t, int k,
+                                        RealType& v, RealType& dv) {
+      int j = max(0, min(n_ - 1, int((t - x_[0]) * dx_)));
+      PairRealType dt = t - x_[j];
+      const PairRealType* c = &coeffs_[(j * nFunctions_ + k) * 4];
+
+      v = c[0] + dt * (c[1] + dt * (c[2] + dt * c[3]));
+      dv = c[1] + dt * (PairRealType(2.0) * c[2] +
+                        PairRealType(3.0) * dt * c[3]);
+    }
+
+    /** Evaluates a single spline at t. */
+    inline RealType getValueAt(const RealType& t, int k) {
+      int j = max(0, min(n_ - 1, int((t - x_[0]) * dx_)));
+      PairRealType dt = t - x_[j];
+      const PairRealType* c = &coeffs_[(j * nFunctions_ + k) * 4];
+
+      return c[0] + dt * (c[1] + dt * (c[2] + dt * c[3]));
+    }
+
+    /** Evaluates the first spline and its derivative, like CubicSpline */
+    inline void getValueAndDerivativeAt(const RealType& t, RealType& v,
+                                        RealType& dv) {
+      getValueAndDerivativeAt(t, 0, v, dv);
+    }
+
+    /** Evaluates the first spline, like CubicSpline */
+    inline RealType getValueAt(const RealType& t) {
+      return getValueAt(t, 0);
+    }
+
+  private:
+    int n_;
+    int nFunctions_;
+    RealType dx_;
+    vector<RealType> x_;
+    vector<PairRealType> coeffs_;
+  };
+}
+
+#endif
@@ -0,0 +1,121 @@
+/*
+ * Copyright (c) 2018 The University of Notre Dame. All Rights Reserved.
+ *
+ * The University of Notre Dame grants you ("Licensee") a
+ * non-exclusive, royalty free, license to use, modify and
+ * redistribute this software in source and binary code form, provided
+ * that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the
+ *    distribution.
+ *
+ * This software is provided "AS IS," without a warranty of any
+ * kind. All express or implied conditions, representations and
+ * warranties, including any implied warranty of merchantability,
+ * fitness for a particular purpose or non-infringement, are hereby
+ * excluded.  The University of Notre Dame and its licensors shall not
+ * be liable for any damages suffered by licensee as a result of
+ * using, modifying or distributing the software or its
+ * derivatives. In no event will the University of Notre Dame or its
+ * licensors be liable for any lost revenue, profit or data, or for
+ * direct, indirect, special, consequential, incidental or punitive
+ * damages, however caused and regardless of the theory of liability,
+ * arising out of the use of or inability to use software, even if the
+ * University of Notre Dame has been advised of the possibility of
+ * such damages.
+ *
+ * SUPPORT OPEN SCIENCE!  If you use OpenMD or its source code in your
+ * research, please cite the appropriate papers when you publish your
+ * work.  Good starting points are:
+ *                                                                      
+ * [1]  Meineke, et al., J. Comp. Chem. 26, 252-271 (2005).             
+ * [2]  Fennell & Gezelter, J. Chem. Phys. 124, 234104 (2006).          
+ * [3]  Sun, Lin & Gezelter, J. Chem. Phys. 128, 234107 (2008).          
+ * [4]  Kuang & Gezelter,  J. Chem. Phys. 133, 164101 (2010).
+ * [5]  Vardeman, Stocker & Gezelter, J. Chem. Theory Comput. 7, 834 (2011).
+ */
+
+#include "math/MultiTauCorrelator.hpp"
+
+namespace OpenMD {
+
+  MultiTauCorrelator::MultiTauCorrelator(int nComponents, int nPoints,
+                                         int nAverage) :
+    nComponents_(nComponents), p_(nPoints), m_(nAverage), nSamples_(0) {
+  }
+
+  void MultiTauCorrelator::addSample(const RealType* values) {
+    ++nSamples_;
+    add(0, values);
+  }
+
+  void MultiTauCorrelator::add(int level, const RealType* values) {
+    if (level == static_cast<int>(levels_.size())) {
+      Level l;
+      l.shift.assign(p_ * nComponents_, 0.0);
+      l.corr.assign(p_ * nComponents_, 0.0);
+      l.count.assign(p_, 0);
+      l.accum.assign(nComponents_, 0.0);
+      l.nAccum = 0;
+      l.head = 0;
+      l.nFilled = 0;
+      levels_.push_back(l);
+    }
+
+    Level& l = levels_[level];
+
+    RealType* newest = &l.shift[l.head * nComponents_];
+    for (int k = 0; k < nComponents_; k++) newest[k] = values[k];
+    if (l.nFilled < p_) l.nFilled++;
+
+    // lags below p/m are already covered more finely by the level below:
+    int jStart = (level == 0) ? 0 : p_ / m_;
+    for (int j = jStart; j < l.nFilled; j++) {
+      int old = (l.head - j + p_) % p_;
+      const RealType* older = &l.shift[old * nComponents_];
+      RealType* c = &l.corr[j * nComponents_];
+      for (int k = 0; k < nComponents_; k++) c[k] += newest[k] * older[k];
+      l.count[j]++;
+    }
+    l.head = (l.head + 1) % p_;
+
+    for (int k = 0; k < nComponents_; k++) l.accum[k] += values[k];
+    l.nAccum++;
+    if (l.nAccum == m_) {
+      std::vector<RealType> avg(nComponents_);
+      for (int k = 0; k < nComponents_; k++) {
+        avg[k] = l.accum[k] / RealType(m_);
+        l.accum[k] = 0.0;
+      }
+      l.nAccum = 0;
+      // levels_ may grow here, so l must not be used afterwards:
+      add(level + 1, &avg[0]);
+    }
+  }
+
+  void MultiTauCorrelator::getCorrelation(std::vector<RealType>& lags,
+                                          std::vector<std::vector<RealType> >& corr) {
+    lags.clear();
+    corr.clear();
+
+    RealType spacing = 1.0;
+    for (unsigned int level = 0; level < levels_.size(); level++) {
+      Level& l = levels_[level];
+      int jStart = (level == 0) ? 0 : p_ / m_;
+      for (int j = jStart; j < p_; j++) {
+        if (l.count[j] == 0) continue;
+        lags.push_back(j * spacing);
+        std::vector<RealType> c(nComponents_);
+        for (int k = 0; k < nComponents_; k++) 
+          c[k] = l.corr[j * nComponents_ + k] / RealType(l.count[j]);
+        corr.push_back(c);
+      }
+      spacing *= m_;
+    }
+  }
+}
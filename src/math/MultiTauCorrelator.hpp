@@ -0,0 +1,99 @@
+/*
+ * Copyright (c) 2018 The University of Notre Dame. All Rights Reserved.
+ *
+ * The University of Notre Dame grants you ("Licensee") a
+ * non-exclusive, royalty free, license to use, modify and
+ * redistribute this software in source and binary code form, provided
+ * that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the
+ *    distribution.
+ *
+ * This software is provided "AS IS," without a warranty of any
+ * kind. All express or implied conditions, representations and
+ * warranties, including any implied warranty of merchantability,
+ * fitness for a particular purpose or non-infringement, are hereby
+ * excluded.  The University of Notre Dame and its licensors shall not
+ * be liable for any damages suffered by licensee as a result of
+ * using, modifying or distributing the software or its
+ * derivatives. In no event will the University of Notre Dame or its
+ * licensors be liable for any lost revenue, profit or data, or for
+ * direct, indirect, special, consequential, incidental or punitive
+ * damages, however caused and regardless of the theory of liability,
+ * arising out of the use of or inability to use software, even if the
+ * University of Notre Dame has been advised of the possibility of
+ * such damages.
+ *
+ * SUPPORT OPEN SCIENCE!  If you use OpenMD or its source code in your
+ * research, please cite the appropriate papers when you publish your
+ * work.  Good starting points are:
+ *                                                                      
+ * [1]  Meineke, et al., J. Comp. Chem. 26, 252-271 (2005).             
+ * [2]  Fennell & Gezelter, J. Chem. Phys. 124, 234104 (2006).          
+ * [3]  Sun, Lin & Gezelter, J. Chem. Phys. 128, 234107 (2008).          
+ * [4]  Kuang & Gezelter,  J. Chem. Phys. 133, 164101 (2010).
+ * [5]  Vardeman, Stocker & Gezelter, J. Chem. Theory Comput. 7, 834 (2011).
+ */
+ 
+#ifndef MATH_MULTITAUCORRELATOR_HPP
+#define MATH_MULTITAUCORRELATOR_HPP
+
+#include "config.h"
+#include <vector>
+
+namespace OpenMD {
+
+  /**
+   * @class MultiTauCorrelator MultiTauCorrelator.hpp "math/MultiTauCorrelator.hpp"
+   * @brief Accumulates the autocorrelation functions of a set of
+   * scalar components on the fly, using logarithmic block averaging.
+   *
+   * Level 0 keeps the last p samples and correlates lags 0..p-1.
+   * Every m samples at a level are averaged and pushed to the next
+   * level, which correlates lags p/m..p-1 in units of m^level
+   * samples.  Levels are created as they are needed, so the memory
+   * grows as O(p log_m T) for a run of T samples.  See Ramirez,
+   * Sinha and Likos, J. Chem. Phys. 133, 154103 (2010).
+   */
+  class MultiTauCorrelator {
+  public:
+    MultiTauCorrelator(int nComponents, int nPoints = 16, int nAverage = 2);
+
+    /** Adds one sample; values must hold nComponents entries */
+    void addSample(const RealType* values);
+
+    /** Returns the lags (in units of the sampling interval) and the
+        normalized autocorrelation of every component at each lag */
+    void getCorrelation(std::vector<RealType>& lags,
+                        std::vector<std::vector<RealType> >& corr);
+
+    int getNComponents() { return nComponents_; }
+    unsigned long getNSamples() { return nSamples_; }
+
+  private:
+    struct Level {
+      std::vector<RealType> shift;      /**< ring buffer, p x nComponents */
+      std::vector<RealType> corr;       /**< correlation sums, p x nComponents */
+      std::vector<unsigned long> count; /**< samples in each corr sum */
+      std::vector<RealType> accum;      /**< running block average */
+      int nAccum;
+      int head;                         /**< next slot in the ring */
+      int nFilled;
+    };
+
+    void add(int level, const RealType* values);
+
+    int nComponents_;
+    int p_;
+    int m_;
+    unsigned long nSamples_;
+    std::vector<Level> levels_;
+  };
+}
+
+#endif
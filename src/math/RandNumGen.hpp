@@ -44,6 +44,7 @@
 #define MATH_RANDNUMGEN_HPP
 
 #include <vector>
+#include <iostream>
 #include "config.h"
 #include "MersenneTwister.hpp"
 #include "utils/simError.h"
@@ -118,6 +119,20 @@ namespace OpenMD {
 	
     virtual void seed()= 0;
 
+    /** Writes the generator state to a binary stream */
+    void saveState(std::ostream& os) {
+      uint32 state[MTRand::SAVE];
+      mtRand_->save(state);
+      os.write(reinterpret_cast<const char*>(state), sizeof(state));
+    }
+
+    /** Restores a generator state written by saveState */
+    void loadState(std::istream& is) {
+      uint32 state[MTRand::SAVE];
+      is.read(reinterpret_cast<char*>(state), sizeof(state));
+      mtRand_->load(state);
+    }
+
   protected:
     MTRand* mtRand_;
 
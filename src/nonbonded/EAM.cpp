@@ -62,6 +62,31 @@ namespace OpenMD {
     pre11_ = 332.0637778;
   }
 
+  EAM::~EAM() {
+    deletePairSplines();
+  }
+
+  EAMPairSpline* EAM::createPairSpline(CubicSpline* spline) {
+#ifdef MIXED_PRECISION
+    FusedSpline* table = new FusedSpline(spline->getKnots());
+    table->addSpline(spline);
+    return table;
+#else
+    return spline;
+#endif
+  }
+
+  void EAM::deletePairSplines() {
+#ifdef MIXED_PRECISION
+    // only the PairRealType copies are owned here:
+    for (unsigned int i = 0; i < EAMdata.size(); i++) 
+      delete EAMdata[i].rhoTable;
+    for (unsigned int i = 0; i < MixingMap.size(); i++) 
+      for (unsigned int j = 0; j < MixingMap[i].size(); j++) 
+        delete MixingMap[i][j].phiTable;
+#endif
+  }
+
   RealType EAM::fastPower(RealType x, int y) {
     RealType temp;
     if( y == 0)
@@ -368,6 +393,7 @@ namespace OpenMD {
       mixMeth_ = eamUnknownMix;
 
     // find all of the EAM atom Types:
+    deletePairSplines();
     EAMtypes.clear();
     EAMtids.clear();
     EAMdata.clear();
@@ -456,6 +482,16 @@ namespace OpenMD {
         }
       }
     }
+
+    for (unsigned int i = 0; i < EAMdata.size(); i++) 
+      EAMdata[i].rhoTable = createPairSpline(EAMdata[i].rho);
+    for (unsigned int i = 0; i < MixingMap.size(); i++) {
+      for (unsigned int j = 0; j < MixingMap[i].size(); j++) {
+        CubicSpline* phi = MixingMap[i][j].phi;
+        MixingMap[i][j].phiTable = (phi == NULL) ? NULL : 
+          createPairSpline(phi);
+      }
+    }
     initialized_ = true;
   }
 
@@ -800,7 +836,7 @@ namespace OpenMD {
       if (data1.isFluctuatingCharge) {
         m -= *(idat.flucQ1) / data1.nValence;
       }
-      *(idat.rho2) += m * data1.rho->getValueAt( *(idat.rij) );
+      *(idat.rho2) += m * data1.rhoTable->getValueAt( *(idat.rij) );
     }
 
     if ( *(idat.rij) < data2.rcut) {
@@ -808,7 +844,7 @@ namespace OpenMD {
       if (data2.isFluctuatingCharge) {
         m -= *(idat.flucQ2) / data2.nValence;
       }
-      *(idat.rho1) += m * data2.rho->getValueAt( *(idat.rij));
+      *(idat.rho1) += m * data2.rhoTable->getValueAt( *(idat.rij) );
     }
 
     return;
@@ -873,14 +909,14 @@ namespace OpenMD {
     rhat =  *(idat.d) / *(idat.rij);
 
     if ( *(idat.rij) < rci) {
-      data1.rho->getValueAndDerivativeAt( *(idat.rij), rha, drha);
-      CubicSpline* phi = MixingMap[eamtid1][eamtid1].phi;
+      data1.rhoTable->getValueAndDerivativeAt( *(idat.rij), rha, drha);
+      EAMPairSpline* phi = MixingMap[eamtid1][eamtid1].phiTable;
       phi->getValueAndDerivativeAt( *(idat.rij), pha, dpha);
     }
 
     if ( *(idat.rij) < rcj) {
-      data2.rho->getValueAndDerivativeAt( *(idat.rij), rhb, drhb );
-      CubicSpline* phi = MixingMap[eamtid2][eamtid2].phi;
+      data2.rhoTable->getValueAndDerivativeAt( *(idat.rij), rhb, drhb );
+      EAMPairSpline* phi = MixingMap[eamtid2][eamtid2].phiTable;
       phi->getValueAndDerivativeAt( *(idat.rij), phb, dphb);
     }
 
@@ -919,8 +955,8 @@ namespace OpenMD {
       break;
     case eamDaw:
       if ( *(idat.rij) <  MixingMap[eamtid1][eamtid2].rcut) {
-        MixingMap[eamtid1][eamtid2].phi->getValueAndDerivativeAt( *(idat.rij),
-                                                                  phab, dvpdr);
+        MixingMap[eamtid1][eamtid2].phiTable->getValueAndDerivativeAt(
+                                                *(idat.rij), phab, dvpdr);
       }
       break;
     case eamUnknownMix:
@@ -934,14 +970,6 @@ namespace OpenMD {
       simError();
     }
     
-    if ( *(idat.rij) < rci) {
-      data1.rho->getValueAndDerivativeAt( *(idat.rij), rha, drha);
-    }
-
-    if ( *(idat.rij) < rcj) {
-      data2.rho->getValueAndDerivativeAt( *(idat.rij), rhb, drhb );
-    }
-
     drhoidr = drha;
     drhojdr = drhb;
 
@@ -49,13 +49,22 @@
 #include "brains/ForceField.hpp"
 #include "math/Vector3.hpp"
 #include "math/CubicSpline.hpp"
+#include "math/FusedSpline.hpp"
 
 namespace OpenMD {
 
+#ifdef MIXED_PRECISION
+  /** The pair loop evaluates rho and phi from PairRealType copies */
+  typedef FusedSpline EAMPairSpline;
+#else
+  typedef CubicSpline EAMPairSpline;
+#endif
+
   struct EAMAtomData {
     CubicSpline* rho;
     CubicSpline* F;
     CubicSpline* Z;
+    EAMPairSpline* rhoTable; /**< rho as evaluated in the pair loop */
     RealType rcut;
     RealType nValence;
     bool isFluctuatingCharge;
@@ -63,6 +72,7 @@ namespace OpenMD {
 
   struct EAMInteractionData {
     CubicSpline* phi;
+    EAMPairSpline* phiTable; /**< phi as evaluated in the pair loop */
     RealType rcut;
     bool explicitlySet;
   };
@@ -76,6 +86,7 @@ namespace OpenMD {
   class EAM : public MetallicInteraction {
   public:
     EAM();
+    ~EAM();
     void setForceField(ForceField *ff) {forceField_ = ff;};
     void setElectrostatic(Electrostatic *el) { electrostatic_ = el;};    
     void setSimulatedAtomTypes(set<AtomType*> &simtypes) {simTypes_ = simtypes; initialize();};
@@ -124,6 +135,8 @@ namespace OpenMD {
 
   private:
     void initialize();
+    EAMPairSpline* createPairSpline(CubicSpline* spline);
+    void deletePairSplines();
     CubicSpline* getPhi(AtomType* atomType1, AtomType* atomType2);
     
     bool initialized_;
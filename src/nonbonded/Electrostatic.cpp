@@ -74,6 +74,7 @@ namespace OpenMD {
                                   
   {
     flucQ_ = new FluctuatingChargeForces(info_);
+    radialSpline_ = NULL;
   }
   
   void Electrostatic::setForceField(ForceField *ff) {
@@ -621,6 +622,18 @@ namespace OpenMD {
     v43s = new CubicSpline();
     v43s->addPoints(rv, v43v);
 
+    if (radialSpline_ != NULL) delete radialSpline_;
+    radialSpline_ = new FusedSpline(rv);
+    radialSpline_->addFunction(v01v);
+    radialSpline_->addFunction(v11v);
+    radialSpline_->addFunction(v21v);
+    radialSpline_->addFunction(v22v);
+    radialSpline_->addFunction(v31v);
+    radialSpline_->addFunction(v32v);
+    radialSpline_->addFunction(v41v);
+    radialSpline_->addFunction(v42v);
+    radialSpline_->addFunction(v43v);
+
     haveElectroSplines_ = true;
 
     initialized_ = true;
@@ -811,34 +824,57 @@ namespace OpenMD {
     rhat =  *(idat.d)  * ri;
       
     // Obtain all of the required radial function values from the
-    // spline structures:
+    // spline structures.  The radial functions are ordered so that
+    // each combination of multipoles needs a leading subset of them,
+    // and all of that subset comes from a single table lookup:
+
+    int nRadial = 0;
+    if (a_is_Charge || b_is_Charge) nRadial = 1;
+    if (a_is_Dipole || b_is_Dipole) nRadial = 2;
+    if (a_is_Quadrupole || b_is_Quadrupole || (a_is_Dipole && b_is_Dipole))
+      nRadial = 4;
+    if ((a_is_Dipole && b_is_Quadrupole) || (b_is_Dipole && a_is_Quadrupole))
+      nRadial = 6;
+    if (a_is_Quadrupole && b_is_Quadrupole) nRadial = 9;
+
+    radialSpline_->getValuesAndDerivativesAt( *(idat.rij), nRadial,
+                                              vRadial_, dvRadial_);
     
     // needed for fields (and forces):
     if (a_is_Charge || b_is_Charge) {
-      v01s->getValueAndDerivativeAt( *(idat.rij), v01, dv01);
+      v01 = vRadial_[0];
+      dv01 = dvRadial_[0];
     }
     if (a_is_Dipole || b_is_Dipole) {
-      v11s->getValueAndDerivativeAt( *(idat.rij), v11, dv11);
+      v11 = vRadial_[1];
+      dv11 = dvRadial_[1];
       v11or = ri * v11;
     }
     if (a_is_Quadrupole || b_is_Quadrupole ||  (a_is_Dipole && b_is_Dipole)) {
-      v21s->getValueAndDerivativeAt( *(idat.rij), v21, dv21);
-      v22s->getValueAndDerivativeAt( *(idat.rij), v22, dv22);
+      v21 = vRadial_[2];
+      dv21 = dvRadial_[2];
+      v22 = vRadial_[3];
+      dv22 = dvRadial_[3];
       v22or = ri * v22;
     }      
 
     // needed for potentials (and forces and torques):
     if ((a_is_Dipole && b_is_Quadrupole) || 
         (b_is_Dipole && a_is_Quadrupole)) {
-      v31s->getValueAndDerivativeAt( *(idat.rij), v31, dv31);
-      v32s->getValueAndDerivativeAt( *(idat.rij), v32, dv32);
+      v31 = vRadial_[4];
+      dv31 = dvRadial_[4];
+      v32 = vRadial_[5];
+      dv32 = dvRadial_[5];
       v31or = v31 * ri;
       v32or = v32 * ri;
     }
     if (a_is_Quadrupole && b_is_Quadrupole) {
-      v41s->getValueAndDerivativeAt( *(idat.rij), v41, dv41);
-      v42s->getValueAndDerivativeAt( *(idat.rij), v42, dv42);
-      v43s->getValueAndDerivativeAt( *(idat.rij), v43, dv43);
+      v41 = vRadial_[6];
+      dv41 = dvRadial_[6];
+      v42 = vRadial_[7];
+      dv42 = dvRadial_[7];
+      v43 = vRadial_[8];
+      dv43 = dvRadial_[8];
       v42or = v42 * ri;
       v43or = v43 * ri;
     }
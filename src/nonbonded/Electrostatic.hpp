@@ -49,6 +49,7 @@
 #include "brains/ForceField.hpp"
 #include "math/SquareMatrix3.hpp"
 #include "math/CubicSpline.hpp"
+#include "math/FusedSpline.hpp"
 #include "brains/SimInfo.hpp"
 #include "flucq/FluctuatingChargeForces.hpp"
 
@@ -174,6 +175,14 @@ namespace OpenMD {
     CubicSpline* v42s;
     CubicSpline* v43s;
 
+    /**
+     * All nine radial functions above (v01 ... v43, in that order) on
+     * one grid, so that a pair needs a single interval lookup:
+     */
+    FusedSpline* radialSpline_;
+    RealType vRadial_[9];
+    RealType dvRadial_[9];
+
     ElectrostaticAtomData data1;
     ElectrostaticAtomData data2;
     RealType C_a, C_b;  // Charges 
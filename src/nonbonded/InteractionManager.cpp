@@ -46,12 +46,16 @@
 #include "types/RepulsivePowerInteractionType.hpp"
 #include "types/MieInteractionType.hpp"
 #include "types/MAWInteractionType.hpp"
+#include "types/TabulatedInteractionType.hpp"
 
 namespace OpenMD {
 
   InteractionManager::InteractionManager() {
 
     initialized_ = false;
+    useVdwTables_ = false;
+    vdwTableSpacing_ = 0.005;
+    vdwTableMaxEnergy_ = 1000.0;
 
     lj_ = new LJ();
     gb_ = new GB();
@@ -59,6 +63,7 @@ namespace OpenMD {
     morse_ = new Morse();
     repulsivePower_ = new RepulsivePower();
     mie_ = new Mie();
+    tabulated_ = new Tabulated();
     eam_ = new EAM();
     sc_ = new SC();
     electrostatic_ = new Electrostatic();
@@ -72,10 +77,15 @@ namespace OpenMD {
     delete morse_;
     delete repulsivePower_;
     delete mie_;
+    delete tabulated_;
     delete eam_;
     delete sc_;
     delete electrostatic_;
     delete maw_;
+
+    for (unsigned int i = 0; i < vdwTables_.size(); i++)
+      for (unsigned int j = 0; j < vdwTables_[i].size(); j++)
+        delete vdwTables_[i][j].table;
   }
 
   void InteractionManager::initialize() {
@@ -96,6 +106,7 @@ namespace OpenMD {
     maw_->setForceField(forceField_);
     repulsivePower_->setForceField(forceField_);
     mie_->setForceField(forceField_);
+    tabulated_->setForceField(forceField_);
     
     ForceField::AtomTypeContainer* atomTypes = forceField_->getAtomTypes();
     int nTypes = atomTypes->size();
@@ -123,6 +134,7 @@ namespace OpenMD {
     maw_->setSimulatedAtomTypes(atypes);
     repulsivePower_->setSimulatedAtomTypes(atypes);
     mie_->setSimulatedAtomTypes(atypes);
+    tabulated_->setSimulatedAtomTypes(atypes);
 
     set<AtomType*>::iterator at;
     set<NonBondedInteraction*>::iterator it;
@@ -357,6 +369,41 @@ namespace OpenMD {
             
             vdwExplicit = true;
           }
+
+          if (nbiType->isTabulated()) {
+            if (vdwExplicit) {
+              sprintf( painCave.errMsg,
+                       "InteractionManager::initialize found more than one "
+                       "explicit \n"
+                       "\tvan der Waals interaction for atom types %s - %s\n",
+                       atype1->getName().c_str(), atype2->getName().c_str());
+              painCave.severity = OPENMD_ERROR;
+              painCave.isFatal = 1;
+              simError();
+            }
+            // We found an explicit Tabulated interaction.
+            // override all other vdw entries for this pair of atom types:
+            for(it = interactions_[atid1][atid2].begin();
+                it != interactions_[atid1][atid2].end(); ) {
+              InteractionFamily ifam = (*it)->getFamily();
+              if (ifam == VANDERWAALS_FAMILY) {
+                iHash_[atid1][atid2] ^= (*it)->getHash();
+                interactions_[atid1][atid2].erase(it++);
+              } else {
+                ++it;
+              }
+            }
+            interactions_[atid1][atid2].insert(tabulated_);
+            iHash_[atid1][atid2] |= TABULATED_INTERACTION;
+            TabulatedInteractionType* tit = dynamic_cast<TabulatedInteractionType*>(nbiType);
+
+            tabulated_->addExplicitInteraction(atype1, atype2,
+                                               tit->getR(),
+                                               tit->getV(),
+                                               tit->getF());
+
+            vdwExplicit = true;
+          }
           
           if (nbiType->isEAMTable() || nbiType->isEAMZhou() ) {
             // We found an explicit EAM interaction.
@@ -473,6 +520,185 @@ namespace OpenMD {
 
     electrostatic_->setCutoffRadius(rcut);
     eam_->setCutoffRadius(rcut);
+
+    if (info_->getSimParams()->getTabulateVanDerWaals())
+      setupVanDerWaalsTables(rcut);
+  }
+
+  void InteractionManager::getIsotropicPotential(int atid1, int atid2,
+                                                 RealType r, RealType &pot,
+                                                 RealType &dudr) {
+    // Evaluate the unshifted, unswitched interactions directly by
+    // calling each of the kernels with a separation vector along x:
+
+    Vector3d d(r, 0.0, 0.0);
+    Vector3d f1(0.0);
+    RealType r2 = r * r;
+    RealType rcut = r;
+    RealType sw = 1.0;
+    RealType vdwMult = 1.0;
+    RealType vpair = 0.0;
+    potVec pairPot(0.0);
+    potVec selePot(0.0);
+
+    InteractionData idat;
+    idat.atid1 = atid1;
+    idat.atid2 = atid2;
+    idat.d = &d;
+    idat.rij = &r;
+    idat.r2 = &r2;
+    idat.rcut = &rcut;
+    idat.shiftedPot = false;
+    idat.shiftedForce = false;
+    idat.sw = &sw;
+    idat.excluded = false;
+    idat.vdwMult = &vdwMult;
+    idat.vpair = &vpair;
+    idat.pot = &pairPot;
+    idat.selePot = &selePot;
+    idat.isSelected = false;
+    idat.f1 = &f1;
+
+    int& iHash = iHash_[atid1][atid2];
+
+    // Some kernels assign f1 rather than adding to it, so collect the
+    // derivatives one kernel at a time:
+    dudr = 0.0;
+    if ((iHash & LJ_INTERACTION) != 0) {
+      f1.zero();
+      lj_->calcForce(idat);
+      dudr += f1[0];
+    }
+    if ((iHash & MORSE_INTERACTION) != 0) {
+      f1.zero();
+      morse_->calcForce(idat);
+      dudr += f1[0];
+    }
+    if ((iHash & REPULSIVEPOWER_INTERACTION) != 0) {
+      f1.zero();
+      repulsivePower_->calcForce(idat);
+      dudr += f1[0];
+    }
+    if ((iHash & MIE_INTERACTION) != 0) {
+      f1.zero();
+      mie_->calcForce(idat);
+      dudr += f1[0];
+    }
+    if ((iHash & TABULATED_INTERACTION) != 0) {
+      f1.zero();
+      tabulated_->calcForce(idat);
+      dudr += f1[0];
+    }
+    pot = vpair;
+  }
+
+  void InteractionManager::setupVanDerWaalsTables(RealType rcut) {
+
+    if (!initialized_) initialize();
+
+    vdwTableSpacing_ = info_->getSimParams()->getVanDerWaalsTableSpacing();
+
+    for (unsigned int i = 0; i < vdwTables_.size(); i++)
+      for (unsigned int j = 0; j < vdwTables_[i].size(); j++)
+        delete vdwTables_[i][j].table;
+
+    VanDerWaalsTable empty;
+    empty.table = NULL;
+    empty.rMin = 0.0;
+    empty.rMax = 0.0;
+    empty.potC = 0.0;
+    empty.derivC = 0.0;
+
+    int nTypes = iHash_.size();
+    vdwTables_.assign(nTypes, vector<VanDerWaalsTable>(nTypes, empty));
+    tHash_ = iHash_;
+
+    // Add the same 2 angstrom safety window that the electrostatic
+    // splines use for cutoff groups, plus a few extra points on either
+    // end so that the spline end conditions stay out of the region
+    // that is actually used:
+
+    RealType dr = vdwTableSpacing_;
+    RealType rMax = rcut + 2.0;
+    int nPad = 10;
+    int np = int(rMax / dr) + 1 + nPad;
+
+    int nTables = 0;
+    RealType maxPotErr = 0.0;
+    RealType maxForceErr = 0.0;
+    string worst1, worst2;
+    RealType r, pot, dudr, tPot, tDudr;
+
+    map<int, AtomType*>::iterator it1, it2;
+    for (it1 = typeMap_.begin(); it1 != typeMap_.end(); ++it1) {
+      int atid1 = (*it1).first;
+      for (it2 = typeMap_.begin(); it2 != typeMap_.end(); ++it2) {
+        int atid2 = (*it2).first;
+
+        if ((iHash_[atid1][atid2] & ISOTROPIC_INTERACTIONS) == 0) continue;
+
+        // Find the first grid point outside the repulsive wall:
+        int iMin = 1;
+        for (int i = 1; i <= np; i++) {
+          getIsotropicPotential(atid1, atid2, RealType(i) * dr, pot, dudr);
+          if (pot < vdwTableMaxEnergy_) {
+            iMin = i;
+            break;
+          }
+        }
+        int iStart = max(1, iMin - nPad);
+
+        vector<RealType> rv;
+        vector<RealType> vv;
+        for (int i = iStart; i <= np; i++) {
+          r = RealType(i) * dr;
+          getIsotropicPotential(atid1, atid2, r, pot, dudr);
+          rv.push_back(r);
+          vv.push_back(pot);
+        }
+
+        VanDerWaalsTable& t = vdwTables_[atid1][atid2];
+        t.table = new CubicSpline();
+        t.table->addPoints(rv, vv);
+        t.rMin = RealType(iMin) * dr;
+        t.rMax = rMax;
+        getIsotropicPotential(atid1, atid2, rcut, t.potC, t.derivC);
+
+        tHash_[atid1][atid2] &= ~ISOTROPIC_INTERACTIONS;
+        tHash_[atid1][atid2] |= VDW_TABLE_INTERACTION;
+        nTables++;
+
+        // Check the interpolation halfway between the grid points
+        // inside the cutoff:
+        for (r = t.rMin + 0.5 * dr; r < rcut; r += dr) {
+          getIsotropicPotential(atid1, atid2, r, pot, dudr);
+          t.table->getValueAndDerivativeAt(r, tPot, tDudr);
+          if (fabs(tPot - pot) > maxPotErr ||
+              fabs(tDudr - dudr) > maxForceErr) {
+            worst1 = (*it1).second->getName();
+            worst2 = (*it2).second->getName();
+          }
+          maxPotErr = max(maxPotErr, fabs(tPot - pot));
+          maxForceErr = max(maxForceErr, fabs(tDudr - dudr));
+        }
+      }
+    }
+
+    useVdwTables_ = (nTables > 0);
+
+    if (useVdwTables_) {
+      sprintf( painCave.errMsg,
+               "InteractionManager is using tabulated van der Waals\n"
+               "\tinteractions for %d pairs of atom types with a spacing of\n"
+               "\t%g angstroms.  The largest interpolation errors inside\n"
+               "\tthe cutoff (for %s - %s) are %g kcal/mol in the\n"
+               "\tpotential and %g kcal/mol/angstrom in the force.\n",
+               nTables, dr, worst1.c_str(), worst2.c_str(),
+               maxPotErr, maxForceErr);
+      painCave.severity = OPENMD_INFO;
+      painCave.isFatal = 0;
+      simError();
+    }
   }
 
   void InteractionManager::doPrePair(InteractionData &idat){
@@ -524,8 +750,8 @@ namespace OpenMD {
 
     if (!initialized_) initialize();
 
-    int& iHash = iHash_[idat.atid1][idat.atid2];
-    
+    int& iHash = useVdwTables_ ? tHash_[idat.atid1][idat.atid2] :
+      iHash_[idat.atid1][idat.atid2];
 
     if ((iHash & ELECTROSTATIC_INTERACTION) != 0) electrostatic_->calcForce(idat);
 
@@ -534,12 +760,14 @@ namespace OpenMD {
 
     if (idat.excluded) return;
 
+    if ((iHash & VDW_TABLE_INTERACTION) != 0)      doVdwTablePair(idat);
     if ((iHash & LJ_INTERACTION) != 0)             lj_->calcForce(idat);
     if ((iHash & GB_INTERACTION) != 0)             gb_->calcForce(idat);
     if ((iHash & STICKY_INTERACTION) != 0)         sticky_->calcForce(idat);
     if ((iHash & MORSE_INTERACTION) != 0)          morse_->calcForce(idat);
     if ((iHash & REPULSIVEPOWER_INTERACTION) != 0) repulsivePower_->calcForce(idat);
     if ((iHash & MIE_INTERACTION) != 0)            mie_->calcForce(idat);
+    if ((iHash & TABULATED_INTERACTION) != 0)      tabulated_->calcForce(idat);
     if ((iHash & EAM_INTERACTION) != 0)            eam_->calcForce(idat);
     if ((iHash & SC_INTERACTION) != 0)             sc_->calcForce(idat);
     if ((iHash & MAW_INTERACTION) != 0)            maw_->calcForce(idat);
@@ -557,6 +785,53 @@ namespace OpenMD {
     return;
   }
 
+  void InteractionManager::doVdwTablePair(InteractionData &idat) {
+
+    VanDerWaalsTable& t = vdwTables_[idat.atid1][idat.atid2];
+    RealType r = *(idat.rij);
+
+    // Outside the table, fall back on the individual kernels:
+    if (r < t.rMin || r > t.rMax) {
+      doIsotropicPair(idat);
+      return;
+    }
+
+    RealType myPot, myDeriv;
+    RealType myPotC = 0.0;
+    RealType myDerivC = 0.0;
+
+    t.table->getValueAndDerivativeAt(r, myPot, myDeriv);
+
+    if (idat.shiftedPot) {
+      myPotC = t.potC;
+    } else if (idat.shiftedForce) {
+      myPotC = t.potC + t.derivC * (r - *(idat.rcut));
+      myDerivC = t.derivC;
+    }
+
+    RealType pot_temp = *(idat.vdwMult) * (myPot - myPotC);
+    *(idat.vpair) += pot_temp;
+
+    RealType dudr = *(idat.sw) * *(idat.vdwMult) * (myDeriv - myDerivC);
+
+    (*(idat.pot))[VANDERWAALS_FAMILY] += *(idat.sw) * pot_temp;
+    if (idat.isSelected)
+      (*(idat.selePot))[VANDERWAALS_FAMILY] += *(idat.sw) * pot_temp;
+
+    *(idat.f1) += *(idat.d) * dudr / r;
+  }
+
+  void InteractionManager::doIsotropicPair(InteractionData &idat) {
+
+    int& iHash = iHash_[idat.atid1][idat.atid2];
+
+    if ((iHash & LJ_INTERACTION) != 0)             lj_->calcForce(idat);
+    if ((iHash & MORSE_INTERACTION) != 0)          morse_->calcForce(idat);
+    if ((iHash & REPULSIVEPOWER_INTERACTION) != 0) repulsivePower_->calcForce(idat);
+    if ((iHash & MIE_INTERACTION) != 0)            mie_->calcForce(idat);
+    if ((iHash & TABULATED_INTERACTION) != 0)      tabulated_->calcForce(idat);
+  }
+
   void InteractionManager::doSelfCorrection(SelfData &sdat){
 
     if (!initialized_) initialize();
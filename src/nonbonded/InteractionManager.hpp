@@ -55,7 +55,9 @@
 #include "nonbonded/MAW.hpp"
 #include "nonbonded/RepulsivePower.hpp"
 #include "nonbonded/Mie.hpp"
+#include "nonbonded/Tabulated.hpp"
 #include "nonbonded/SwitchingFunction.hpp"
+#include "math/CubicSpline.hpp"
 #include "flucq/FluctuatingChargeForces.hpp"
 
 using namespace std;
@@ -87,12 +89,33 @@ namespace OpenMD {
     void setCutoffRadius(RealType rCut);
     RealType getSuggestedCutoffRadius(int *atid1);   
     RealType getSuggestedCutoffRadius(AtomType *atype);
+
+    /** 
+     * Returns the set of interactions between two atom types, so
+     * that individual kernels can be called (and timed) one at a time.
+     */
+    set<NonBondedInteraction*>& getInteractions(int atid1, int atid2) {
+      if (!initialized_) initialize();
+      return interactions_[atid1][atid2];
+    }
     
   private:
     bool initialized_;
 
     void setupElectrostatics();
 
+    /**
+     * Sums all of the isotropic van der Waals interactions for each
+     * pair of atom types and stores the result as a single spline in
+     * r.  The tables run from the point where the repulsive wall
+     * exceeds vdwTableMaxEnergy_ out to 2 angstroms past the cutoff.
+     */
+    void setupVanDerWaalsTables(RealType rcut);
+    void doVdwTablePair(InteractionData &idat);
+    void doIsotropicPair(InteractionData &idat);
+    void getIsotropicPotential(int atid1, int atid2, RealType r,
+                               RealType &pot, RealType &dudr);
+
     SimInfo* info_;
     LJ* lj_;
     GB* gb_;
@@ -103,6 +126,7 @@ namespace OpenMD {
     Electrostatic* electrostatic_;
     RepulsivePower* repulsivePower_;
     Mie* mie_;
+    Tabulated* tabulated_;
     MAW* maw_;
     FluctuatingChargeForces* flucq_;
     
@@ -126,6 +150,27 @@ namespace OpenMD {
 
     /* sHash_ contains the self-interaction version of iHash_ */
     vector<int> sHash_;
+
+    /**
+     * A single tabulated function for the sum of the isotropic
+     * interactions between a pair of atom types.  potC and derivC are
+     * the exact (untabulated) values of the potential and its
+     * derivative at the cutoff radius for the shifted cutoff methods.
+     */
+    struct VanDerWaalsTable {
+      CubicSpline* table;
+      RealType rMin;
+      RealType rMax;
+      RealType potC;
+      RealType derivC;
+    };
+
+    bool useVdwTables_;
+    RealType vdwTableSpacing_;
+    RealType vdwTableMaxEnergy_;
+    vector<vector<VanDerWaalsTable> > vdwTables_;
+    /* tHash_ is iHash_ with the isotropic interactions replaced by a table */
+    vector<vector<int> > tHash_;
   };
 }
 #endif
@@ -252,12 +252,14 @@ namespace OpenMD {
     RealType sigmai = mixer.sigmai;
     RealType epsilon = mixer.epsilon;
 
-    RealType ros;
-    RealType rcos;
-    RealType myPot = 0.0;
-    RealType myPotC = 0.0;
-    RealType myDeriv = 0.0;
-    RealType myDerivC = 0.0;
+    // The kernel itself runs in PairRealType; the energy and force
+    // are accumulated in RealType.
+    PairRealType ros;
+    PairRealType rcos;
+    PairRealType myPot = 0.0;
+    PairRealType myPotC = 0.0;
+    PairRealType myDeriv = 0.0;
+    PairRealType myDerivC = 0.0;
     
     ros = *(idat.rij) * sigmai;     
     
@@ -290,17 +292,18 @@ namespace OpenMD {
     return;
   }
   
-  void LJ::getLJfunc(RealType r, RealType &pot, RealType &deriv) {
-
-    RealType ri = 1.0 / r;
-    RealType ri2 = ri * ri;
-    RealType ri6 = ri2 * ri2 * ri2;
-    RealType ri7 = ri6 * ri;
-    RealType ri12 = ri6 * ri6;
-    RealType ri13 = ri12 * ri;
+  void LJ::getLJfunc(PairRealType r, PairRealType &pot,
+                     PairRealType &deriv) {
+
+    PairRealType ri = PairRealType(1.0) / r;
+    PairRealType ri2 = ri * ri;
+    PairRealType ri6 = ri2 * ri2 * ri2;
+    PairRealType ri7 = ri6 * ri;
+    PairRealType ri12 = ri6 * ri6;
+    PairRealType ri13 = ri12 * ri;
     
-    pot = 4.0 * (ri12 - ri6);
-    deriv = 24.0 * (ri7 - 2.0 * ri13);
+    pot = PairRealType(4.0) * (ri12 - ri6);
+    deriv = PairRealType(24.0) * (ri7 - PairRealType(2.0) * ri13);
 
     return;
   }
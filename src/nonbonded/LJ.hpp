@@ -75,7 +75,8 @@ namespace OpenMD {
     RealType getSigma(AtomType* atomType1, AtomType* atomType2);
     RealType getEpsilon(AtomType* atomType1, AtomType* atomType2);
     
-    void getLJfunc(const RealType r, RealType &pot, RealType &deriv);
+    void getLJfunc(const PairRealType r, PairRealType &pot,
+                   PairRealType &deriv);
     
     bool initialized_;
 
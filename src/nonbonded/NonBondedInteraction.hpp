@@ -82,6 +82,19 @@ namespace OpenMD {
   const static int MAW_INTERACTION            = (1 << 8);
   const static int MIE_INTERACTION            = (1 << 9);
   const static int BUCKINGHAM_INTERACTION     = (1 << 10);
+  const static int TABULATED_INTERACTION      = (1 << 11);
+  const static int VDW_TABLE_INTERACTION      = (1 << 12);
+
+  /**
+   * Interactions that depend only on the separation between the two
+   * atoms, and which can be combined into a single tabulated function
+   * of r:
+   */
+  const static int ISOTROPIC_INTERACTIONS = (LJ_INTERACTION |
+                                             MORSE_INTERACTION |
+                                             REPULSIVEPOWER_INTERACTION |
+                                             MIE_INTERACTION |
+                                             TABULATED_INTERACTION);
 
   typedef Vector<RealType, N_INTERACTION_FAMILIES> potVec;
 
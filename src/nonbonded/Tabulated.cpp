@@ -0,0 +1,236 @@
+/*
+ * Copyright (c) 2018 The University of Notre Dame. All Rights Reserved.
+ *
+ * The University of Notre Dame grants you ("Licensee") a
+ * non-exclusive, royalty free, license to use, modify and
+ * redistribute this software in source and binary code form, provided
+ * that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the
+ *    distribution.
+ *
+ * This software is provided "AS IS," without a warranty of any
+ * kind. All express or implied conditions, representations and
+ * warranties, including any implied warranty of merchantability,
+ * fitness for a particular purpose or non-infringement, are hereby
+ * excluded.  The University of Notre Dame and its licensors shall not
+ * be liable for any damages suffered by licensee as a result of
+ * using, modifying or distributing the software or its
+ * derivatives. In no event will the University of Notre Dame or its
+ * licensors be liable for any lost revenue, profit or data, or for
+ * direct, indirect, special, consequential, incidental or punitive
+ * damages, however caused and regardless of the theory of liability,
+ * arising out of the use of or inability to use software, even if the
+ * University of Notre Dame has been advised of the possibility of
+ * such damages.
+ *
+ * SUPPORT OPEN SCIENCE!  If you use OpenMD or its source code in your
+ * research, please cite the appropriate papers when you publish your
+ * work.  Good starting points are:
+ *                                                                      
+ * [1]  Meineke, et al., J. Comp. Chem. 26, 252-271 (2005).             
+ * [2]  Fennell & Gezelter, J. Chem. Phys. 124, 234104 (2006).          
+ * [3]  Sun, Lin & Gezelter, J. Chem. Phys. 128, 234107 (2008).          
+ * [4]  Kuang & Gezelter,  J. Chem. Phys. 133, 164101 (2010).
+ * [5]  Vardeman, Stocker & Gezelter, J. Chem. Theory Comput. 7, 834 (2011).
+ */
+
+#include <cstdio>
+#include <cstring>
+#include <cmath>
+#include <algorithm>
+
+#include "nonbonded/Tabulated.hpp"
+#include "utils/simError.h"
+
+using namespace std;
+
+namespace OpenMD {
+
+  Tabulated::Tabulated() : initialized_(false), forceField_(NULL),
+                           name_("Tabulated") {}
+  
+  void Tabulated::initialize() {    
+
+    Ttypes.clear();
+    Ttids.clear();
+    MixingMap.clear();
+    Ttids.resize( forceField_->getNAtomType(), -1);
+
+    ForceField::NonBondedInteractionTypeContainer* nbiTypes = forceField_->getNonBondedInteractionTypes();
+    ForceField::NonBondedInteractionTypeContainer::MapTypeIterator j;
+    ForceField::NonBondedInteractionTypeContainer::KeyType keys;
+    NonBondedInteractionType* nbt;
+    int ttid1, ttid2;
+
+    for (nbt = nbiTypes->beginType(j); nbt != NULL; 
+         nbt = nbiTypes->nextType(j)) {
+      
+      if (nbt->isTabulated()) {
+        keys = nbiTypes->getKeys(j);
+        AtomType* at1 = forceField_->getAtomType(keys[0]);
+        if (at1 == NULL) {
+          sprintf( painCave.errMsg,
+                   "Tabulated::initialize could not find AtomType %s\n"
+                   "\tfor %s - %s nonbonded interaction.\n",
+                   keys[0].c_str(), keys[0].c_str(), keys[1].c_str());
+          painCave.severity = OPENMD_ERROR;
+          painCave.isFatal = 1;
+          simError();          
+        }
+
+        AtomType* at2 = forceField_->getAtomType(keys[1]);
+        if (at2 == NULL) {
+          sprintf( painCave.errMsg,
+                   "Tabulated::initialize could not find AtomType %s\n"
+                   "\tfor %s - %s nonbonded interaction.\n",
+                   keys[1].c_str(), keys[0].c_str(), keys[1].c_str());
+          painCave.severity = OPENMD_ERROR;
+          painCave.isFatal = 1;
+          simError();          
+        }
+
+        int atid1 = at1->getIdent();
+        if (Ttids[atid1] == -1) {
+          ttid1 = Ttypes.size();
+          Ttypes.insert(atid1);
+          Ttids[atid1] = ttid1;         
+        }
+        int atid2 = at2->getIdent();
+        if (Ttids[atid2] == -1) {
+          ttid2 = Ttypes.size();
+          Ttypes.insert(atid2);
+          Ttids[atid2] = ttid2;
+        }
+        // The table itself is built when the InteractionManager
+        // registers this pair through addExplicitInteraction.
+      }
+    }  
+    initialized_ = true;
+  }
+      
+  void Tabulated::addExplicitInteraction(AtomType* atype1, AtomType* atype2, 
+                                         vector<RealType> &r,
+                                         vector<RealType> &V,
+                                         vector<RealType> &F) {
+
+    int np = r.size();
+
+    if (np < 2) {
+      sprintf( painCave.errMsg,
+               "Tabulated::addExplicitInteraction needs at least two points\n"
+               "\tin the table for the %s - %s interaction.\n",
+               atype1->getName().c_str(), atype2->getName().c_str());
+      painCave.severity = OPENMD_ERROR;
+      painCave.isFatal = 1;
+      simError();
+    }
+
+    // The points may have been given in any order:
+    vector<pair<RealType, int> > order;
+    for (int i = 0; i < np; i++) order.push_back(make_pair(r[i], i));
+    sort(order.begin(), order.end());
+
+    RealType rMin = order.front().first;
+    RealType rMax = order.back().first;
+    RealType dr = (rMax - rMin) / RealType(np - 1);
+
+    for (int i = 0; i < np; i++) {
+      if (fabs(order[i].first - (rMin + RealType(i) * dr)) > 1.0e-4 * dr) {
+        sprintf( painCave.errMsg,
+                 "Tabulated::addExplicitInteraction found unevenly spaced\n"
+                 "\tpoints near r = %lf in the table for the %s - %s\n"
+                 "\tinteraction.  Tabulated interactions must use an\n"
+                 "\tevenly spaced grid in r.\n",
+                 order[i].first, atype1->getName().c_str(),
+                 atype2->getName().c_str());
+        painCave.severity = OPENMD_ERROR;
+        painCave.isFatal = 1;
+        simError();
+      }
+    }
+
+    vector<RealType> sortedV(np), sortedF(np);
+    for (int i = 0; i < np; i++) {
+      sortedV[i] = V[order[i].second];
+      sortedF[i] = F[order[i].second];
+    }
+
+    TabulatedInteractionData table;
+    table.setPoints(rMin, dr, sortedV, sortedF);
+
+    int ttid1 = Ttids[atype1->getIdent()];
+    int ttid2 = Ttids[atype2->getIdent()];
+    int nT = Ttypes.size();
+
+    MixingMap.resize(nT);
+    MixingMap[ttid1].resize(nT);
+    
+    MixingMap[ttid1][ttid2] = table;
+    if (ttid2 != ttid1) {
+      MixingMap[ttid2].resize(nT);
+      MixingMap[ttid2][ttid1] = table;
+    }    
+  }
+
+  void Tabulated::calcForce(InteractionData &idat) {
+
+    if (!initialized_) initialize();
+    
+    TabulatedInteractionData &table = MixingMap[Ttids[idat.atid1]][Ttids[idat.atid2]];
+
+    // Nothing beyond the end of the table:
+    if ( *(idat.rij) >= table.rMax ) return;
+
+    RealType myPot = 0.0;
+    RealType myPotC = 0.0;
+    RealType myDeriv = 0.0;
+    RealType myDerivC = 0.0;
+
+    table.getValueAndDerivativeAt(*(idat.rij), myPot, myDeriv);
+
+    // The potential already ends at rMax, so a cutoff beyond the table
+    // shifts there instead:
+    RealType rc = min(*(idat.rcut), table.rMax);
+    if (idat.shiftedPot) {
+      table.getValueAndDerivativeAt(rc, myPotC, myDerivC);
+      myDerivC = 0.0;
+    } else if (idat.shiftedForce) {
+      table.getValueAndDerivativeAt(rc, myPotC, myDerivC);
+      myPotC = myPotC + myDerivC * (*(idat.rij) - rc);
+    }
+    
+    RealType pot_temp = *(idat.vdwMult) * (myPot - myPotC);
+    *(idat.vpair) += pot_temp;
+    
+    RealType dudr = *(idat.sw) * *(idat.vdwMult) * (myDeriv - myDerivC);
+    
+    (*(idat.pot))[VANDERWAALS_FAMILY] += *(idat.sw) * pot_temp;
+    if (idat.isSelected)
+      (*(idat.selePot))[VANDERWAALS_FAMILY] += *(idat.sw) * pot_temp;
+
+    *(idat.f1) += *(idat.d) * dudr / *(idat.rij);
+    
+    return;
+  }
+
+  RealType Tabulated::getSuggestedCutoffRadius(pair<AtomType*, AtomType*> atypes) {
+    if (!initialized_) initialize();   
+    
+    int atid1 = atypes.first->getIdent();
+    int atid2 = atypes.second->getIdent();
+    int ttid1 = Ttids[atid1];
+    int ttid2 = Ttids[atid2];
+    
+    if ( ttid1 == -1 || ttid2 == -1) return 0.0;
+    if ( ttid2 >= int(MixingMap[ttid1].size()) ) return 0.0;
+
+    // The table ends where the potential ends:
+    return MixingMap[ttid1][ttid2].rMax;
+  }
+}
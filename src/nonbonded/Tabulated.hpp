@@ -0,0 +1,150 @@
+/*
+ * Copyright (c) 2018 The University of Notre Dame. All Rights Reserved.
+ *
+ * The University of Notre Dame grants you ("Licensee") a
+ * non-exclusive, royalty free, license to use, modify and
+ * redistribute this software in source and binary code form, provided
+ * that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the
+ *    distribution.
+ *
+ * This software is provided "AS IS," without a warranty of any
+ * kind. All express or implied conditions, representations and
+ * warranties, including any implied warranty of merchantability,
+ * fitness for a particular purpose or non-infringement, are hereby
+ * excluded.  The University of Notre Dame and its licensors shall not
+ * be liable for any damages suffered by licensee as a result of
+ * using, modifying or distributing the software or its
+ * derivatives. In no event will the University of Notre Dame or its
+ * licensors be liable for any lost revenue, profit or data, or for
+ * direct, indirect, special, consequential, incidental or punitive
+ * damages, however caused and regardless of the theory of liability,
+ * arising out of the use of or inability to use software, even if the
+ * University of Notre Dame has been advised of the possibility of
+ * such damages.
+ *
+ * SUPPORT OPEN SCIENCE!  If you use OpenMD or its source code in your
+ * research, please cite the appropriate papers when you publish your
+ * work.  Good starting points are:
+ *                                                                      
+ * [1]  Meineke, et al., J. Comp. Chem. 26, 252-271 (2005).             
+ * [2]  Fennell & Gezelter, J. Chem. Phys. 124, 234104 (2006).          
+ * [3]  Sun, Lin & Gezelter, J. Chem. Phys. 128, 234107 (2008).          
+ * [4]  Kuang & Gezelter,  J. Chem. Phys. 133, 164101 (2010).
+ * [5]  Vardeman, Stocker & Gezelter, J. Chem. Theory Comput. 7, 834 (2011).
+ */
+ 
+#ifndef NONBONDED_TABULATED_HPP
+#define NONBONDED_TABULATED_HPP
+
+#include "nonbonded/NonBondedInteraction.hpp"
+#include "types/AtomType.hpp"
+#include "brains/ForceField.hpp"
+#include "math/Vector3.hpp"
+
+using namespace std;
+namespace OpenMD {
+
+  /**
+   * A uniform table of piecewise cubic polynomials.  Interval i
+   * covers rMin + i*dr <= r < rMin + (i+1)*dr, and its four
+   * coefficients are stored contiguously in coeffs[4*i ... 4*i+3].
+   */
+  struct TabulatedInteractionData {
+    RealType rMin;
+    RealType rMax;
+    RealType drInv;
+    int nIntervals;
+    vector<RealType> coeffs;
+
+    /**
+     * Builds cubic Hermite intervals from V and F = -dV/dr given at
+     * rMin + i*dr, i = 0 ... V.size()-1.
+     */
+    void setPoints(RealType r0, RealType dr, const vector<RealType> &V,
+                   const vector<RealType> &F) {
+      int np = V.size();
+      rMin = r0;
+      rMax = r0 + RealType(np - 1) * dr;
+      drInv = 1.0 / dr;
+      nIntervals = np - 1;
+      coeffs.resize(4 * nIntervals);
+
+      // coefficients in t = (r - r_i) / dr, using the derivatives
+      // dV/dr = -F at both ends of each interval:
+      for (int i = 0; i < nIntervals; i++) {
+        RealType D0 = -F[i] * dr;
+        RealType D1 = -F[i+1] * dr;
+        coeffs[4*i]     = V[i];
+        coeffs[4*i + 1] = D0;
+        coeffs[4*i + 2] = 3.0 * (V[i+1] - V[i]) - 2.0 * D0 - D1;
+        coeffs[4*i + 3] = 2.0 * (V[i] - V[i+1]) + D0 + D1;
+      }
+    }
+
+    /** Evaluates the potential and dV/dr at r */
+    inline void getValueAndDerivativeAt(const RealType &r, RealType &pot,
+                                        RealType &deriv) const {
+      RealType x = (r - rMin) * drInv;
+      int i = min(max(int(x), 0), nIntervals - 1);
+      RealType t = x - RealType(i);
+      const RealType* c = &coeffs[4 * i];
+      pot = c[0] + t * (c[1] + t * (c[2] + t * c[3]));
+      deriv = (c[1] + t * (2.0 * c[2] + t * 3.0 * c[3])) * drInv;
+    }
+  };
+
+  /**
+   * @class Tabulated
+   *
+   * User-supplied pair potentials given as tables of V(r) and
+   * F(r) = -dV/dr on an evenly-spaced grid.  Between grid points the
+   * potential is a cubic Hermite polynomial matching both V and F at
+   * the grid points, so the forces are always the exact derivative
+   * of the interpolated potential.  The potential is zero beyond the
+   * last point of the table, and the first interval is extrapolated
+   * for separations below the first point.  Shifted cutoff methods
+   * shift at the cutoff radius or at the end of the table, whichever
+   * comes first.
+   */
+  class Tabulated : public VanDerWaalsInteraction {
+    
+  public:    
+    Tabulated();
+    void setForceField(ForceField *ff) {forceField_ = ff;};
+    void setSimulatedAtomTypes(set<AtomType*> &simtypes) {simTypes_ = simtypes; initialize();};
+    void addExplicitInteraction(AtomType* atype1, AtomType* atype2,
+                                vector<RealType> &r, vector<RealType> &V,
+                                vector<RealType> &F);
+    virtual void calcForce(InteractionData &idat);
+    virtual string getName() {return name_;}
+    virtual int getHash() { return TABULATED_INTERACTION; }
+    virtual RealType getSuggestedCutoffRadius(pair<AtomType*, AtomType*> atypes);
+    
+  private:
+    void initialize();
+
+    bool initialized_;
+
+    set<int> Ttypes;           /**< The set of AtomType idents that are Tabulated types */
+    vector<int> Ttids;         /**< The mapping from AtomType ident -> Tabulated type ident */
+    vector<vector<TabulatedInteractionData> > MixingMap;  /**< The tables
+                                                             between two
+                                                             Tabulated
+                                                             types */
+
+    ForceField* forceField_;    
+    set<AtomType*> simTypes_;
+    string name_;
+    
+  };
+}
+
+                               
+#endif
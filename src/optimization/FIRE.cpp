@@ -0,0 +1,378 @@
+/*
+ * Copyright (c) 2018 The University of Notre Dame. All Rights Reserved.
+ *
+ * The University of Notre Dame grants you ("Licensee") a
+ * non-exclusive, royalty free, license to use, modify and
+ * redistribute this software in source and binary code form, provided
+ * that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the
+ *    distribution.
+ *
+ * This software is provided "AS IS," without a warranty of any
+ * kind. All express or implied conditions, representations and
+ * warranties, including any implied warranty of merchantability,
+ * fitness for a particular purpose or non-infringement, are hereby
+ * excluded.  The University of Notre Dame and its licensors shall not
+ * be liable for any damages suffered by licensee as a result of
+ * using, modifying or distributing the software or its
+ * derivatives. In no event will the University of Notre Dame or its
+ * licensors be liable for any lost revenue, profit or data, or for
+ * direct, indirect, special, consequential, incidental or punitive
+ * damages, however caused and regardless of the theory of liability,
+ * arising out of the use of or inability to use software, even if the
+ * University of Notre Dame has been advised of the possibility of
+ * such damages.
+ *
+ * SUPPORT OPEN SCIENCE!  If you use OpenMD or its source code in your
+ * research, please cite the appropriate papers when you publish your
+ * work.  Good starting points are:
+ *                                                                      
+ * [1]  Meineke, et al., J. Comp. Chem. 26, 252-271 (2005).             
+ * [2]  Fennell & Gezelter, J. Chem. Phys. 124, 234104 (2006).          
+ * [3]  Sun, Lin & Gezelter, J. Chem. Phys. 128, 234107 (2008).          
+ * [4]  Kuang & Gezelter,  J. Chem. Phys. 133, 164101 (2010).
+ * [5]  Vardeman, Stocker & Gezelter, J. Chem. Theory Comput. 7, 834 (2011).
+ */
+
+#ifdef IS_MPI
+#include <mpi.h>
+#endif
+
+#include <cmath>
+#include <sstream>
+#include "optimization/FIRE.hpp"
+#include "optimization/Problem.hpp"
+#include "optimization/PotentialEnergyObjectiveFunction.hpp"
+#include "optimization/MinimizerParameters.hpp"
+#include "integrators/DLM.hpp"
+#include "primitives/Molecule.hpp"
+#include "utils/Constants.hpp"
+#include "utils/simError.h"
+
+namespace OpenMD {
+
+  FIRE::FIRE(SimInfo* info) : info_(info), hasFlucQ_(false),
+                              alphaStart_(0.1), fInc_(1.1), fDec_(0.5),
+                              fAlpha_(0.99), nMin_(5) {
+
+    MinimizerParameters* miniPars =
+      info_->getSimParams()->getMinimizerParameters();
+
+    dt_ = miniPars->getFireTimeStep();
+    dtMax_ = miniPars->getFireMaxTimeStep();
+    statusFrequency_ = miniPars->getFireStatusFrequency();
+    alpha_ = alphaStart_;
+
+    if (info_->usesFluctuatingCharges()) {
+      if (info_->getNFluctuatingCharges() > 0) {
+        hasFlucQ_ = true;
+      }
+    }
+
+    nDOF_ = info_->getNdfRaw();
+    if (hasFlucQ_) nDOF_ += info_->getNFluctuatingCharges();
+
+    rotAlgo_ = new DLM();
+  }
+
+  FIRE::~FIRE() {
+    delete rotAlgo_;
+  }
+
+  EndCriteria::Type FIRE::minimize(Problem& P,
+                                   const EndCriteria& endCriteria) {
+
+    PotentialEnergyObjectiveFunction* potObjf =
+      dynamic_cast<PotentialEnergyObjectiveFunction*>(&P.objectiveFunction());
+
+    if (potObjf == NULL) {
+      sprintf(painCave.errMsg,
+              "FIRE: the FIRE minimizer can only be used with the\n"
+              "\tpotential energy objective function.\n");
+      painCave.isFatal = 1;
+      painCave.severity = OPENMD_ERROR;
+      simError();
+    }
+
+    EndCriteria::Type ecType = EndCriteria::None;
+    P.reset();
+
+    size_t statState = 0;
+    int nPositive = 0;
+    RealType fold, fnew;
+
+    nIterations_ = 0;
+    nResets_ = 0;
+
+    zeroVelocities();
+    fnew = potObjf->valueAndForces();
+    nForceEvaluations_ = 1;
+    initialPotential_ = fnew;
+    P.updateStatus(fnew);
+
+    while (true) {
+
+      computePower();
+
+      if (endCriteria.checkZeroGradientNorm(std::sqrt(gradSq_ / nDOF_),
+                                            ecType))
+        break;
+      if (endCriteria.checkMaxIterations(nIterations_, ecType))
+        break;
+
+      if (power_ > 0.0) {
+        mixVelocities();
+        if (nPositive > nMin_) {
+          dt_ = std::min(dt_ * fInc_, dtMax_);
+          alpha_ *= fAlpha_;
+        }
+        nPositive++;
+      } else {
+        zeroVelocities();
+        dt_ *= fDec_;
+        alpha_ = alphaStart_;
+        nPositive = 0;
+        nResets_++;
+      }
+
+      move();
+
+      fold = fnew;
+      fnew = potObjf->valueAndForces();
+      nForceEvaluations_++;
+      nIterations_++;
+
+      if (nIterations_ % statusFrequency_ == 0) P.updateStatus(fnew);
+      else P.setFunctionValue(fnew);
+
+      if (endCriteria.checkStationaryFunctionValue(fold, fnew, statState,
+                                                   ecType))
+        break;
+    }
+
+    // the final configuration is always written out
+    if (nIterations_ % statusFrequency_ != 0) P.updateStatus(fnew);
+
+    computePower();
+    finalPotential_ = fnew;
+    zeroVelocities();
+    writeReport(ecType);
+
+    return ecType;
+  }
+
+  void FIRE::computePower() {
+    SimInfo::MoleculeIterator i;
+    Molecule::IntegrableObjectIterator j;
+    Molecule::FluctuatingChargeIterator k;
+    Molecule* mol;
+    StuntDouble* sd;
+    Atom* atom;
+    Vector3d vel, frc, ji, Tb;
+    Mat3x3d I;
+    int l, m, n;
+
+    // accumulators: power, |v|^2, |f|^2, |j|^2, |tau|^2, v_q^2, f_q^2
+    RealType acc[7] = {0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0};
+
+    for (mol = info_->beginMolecule(i); mol != NULL;
+         mol = info_->nextMolecule(i)) {
+
+      for (sd = mol->beginIntegrableObject(j); sd != NULL;
+           sd = mol->nextIntegrableObject(j)) {
+
+        vel = sd->getVel();
+        frc = sd->getFrc();
+
+        acc[0] += dot(frc, vel);
+        acc[1] += vel.lengthSquare();
+        acc[2] += frc.lengthSquare();
+
+        if (sd->isDirectional()) {
+          ji = sd->getJ();
+          Tb = sd->lab2Body(sd->getTrq());
+          I = sd->getI();
+
+          if (sd->isLinear()) {
+            l = sd->linearAxis();
+            m = (l + 1) % 3;
+            n = (l + 2) % 3;
+            acc[0] += Tb[m] * ji[m] / I(m, m) + Tb[n] * ji[n] / I(n, n);
+            Tb[l] = 0.0;
+          } else {
+            acc[0] += Tb[0] * ji[0] / I(0, 0) + Tb[1] * ji[1] / I(1, 1)
+              + Tb[2] * ji[2] / I(2, 2);
+          }
+          acc[3] += ji.lengthSquare();
+          acc[4] += Tb.lengthSquare();
+        }
+      }
+
+      if (hasFlucQ_) {
+        for (atom = mol->beginFluctuatingCharge(k); atom != NULL;
+             atom = mol->nextFluctuatingCharge(k)) {
+          RealType cvel = atom->getFlucQVel();
+          RealType cfrc = atom->getFlucQFrc();
+          acc[0] += cfrc * cvel;
+          acc[5] += cvel * cvel;
+          acc[6] += cfrc * cfrc;
+        }
+      }
+    }
+
+#ifdef IS_MPI
+    MPI_Allreduce(MPI_IN_PLACE, acc, 7, MPI_REALTYPE, MPI_SUM,
+                  MPI_COMM_WORLD);
+#endif
+
+    power_ = acc[0];
+    vNorm_ = std::sqrt(acc[1]);
+    fNorm_ = std::sqrt(acc[2]);
+    jNorm_ = std::sqrt(acc[3]);
+    tNorm_ = std::sqrt(acc[4]);
+    qvNorm_ = std::sqrt(acc[5]);
+    qfNorm_ = std::sqrt(acc[6]);
+    gradSq_ = acc[2] + acc[4] + acc[6];
+  }
+
+  void FIRE::mixVelocities() {
+    SimInfo::MoleculeIterator i;
+    Molecule::IntegrableObjectIterator j;
+    Molecule::FluctuatingChargeIterator k;
+    Molecule* mol;
+    StuntDouble* sd;
+    Atom* atom;
+
+    // each subspace (translation, rotation, charge) is mixed
+    // separately since the velocities carry different units:
+    RealType vScale = fNorm_ > 0.0 ? alpha_ * vNorm_ / fNorm_ : 0.0;
+    RealType jScale = tNorm_ > 0.0 ? alpha_ * jNorm_ / tNorm_ : 0.0;
+    RealType qScale = qfNorm_ > 0.0 ? alpha_ * qvNorm_ / qfNorm_ : 0.0;
+    RealType keep = 1.0 - alpha_;
+
+    for (mol = info_->beginMolecule(i); mol != NULL;
+         mol = info_->nextMolecule(i)) {
+
+      for (sd = mol->beginIntegrableObject(j); sd != NULL;
+           sd = mol->nextIntegrableObject(j)) {
+
+        sd->setVel(keep * sd->getVel() + vScale * sd->getFrc());
+
+        if (sd->isDirectional()) {
+          Vector3d Tb = sd->lab2Body(sd->getTrq());
+          if (sd->isLinear()) Tb[sd->linearAxis()] = 0.0;
+          sd->setJ(keep * sd->getJ() + jScale * Tb);
+        }
+      }
+
+      if (hasFlucQ_) {
+        for (atom = mol->beginFluctuatingCharge(k); atom != NULL;
+             atom = mol->nextFluctuatingCharge(k)) {
+          atom->setFlucQVel(keep * atom->getFlucQVel() +
+                            qScale * atom->getFlucQFrc());
+        }
+      }
+    }
+  }
+
+  void FIRE::zeroVelocities() {
+    SimInfo::MoleculeIterator i;
+    Molecule::IntegrableObjectIterator j;
+    Molecule::FluctuatingChargeIterator k;
+    Molecule* mol;
+    StuntDouble* sd;
+    Atom* atom;
+
+    for (mol = info_->beginMolecule(i); mol != NULL;
+         mol = info_->nextMolecule(i)) {
+
+      for (sd = mol->beginIntegrableObject(j); sd != NULL;
+           sd = mol->nextIntegrableObject(j)) {
+        sd->setVel(V3Zero);
+        if (sd->isDirectional()) sd->setJ(V3Zero);
+      }
+
+      if (hasFlucQ_) {
+        for (atom = mol->beginFluctuatingCharge(k); atom != NULL;
+             atom = mol->nextFluctuatingCharge(k)) {
+          atom->setFlucQVel(0.0);
+        }
+      }
+    }
+  }
+
+  void FIRE::move() {
+    SimInfo::MoleculeIterator i;
+    Molecule::IntegrableObjectIterator j;
+    Molecule::FluctuatingChargeIterator k;
+    Molecule* mol;
+    StuntDouble* sd;
+    Atom* atom;
+    Vector3d vel, pos, ji, Tb;
+    RealType mass, cvel;
+
+    for (mol = info_->beginMolecule(i); mol != NULL;
+         mol = info_->nextMolecule(i)) {
+
+      for (sd = mol->beginIntegrableObject(j); sd != NULL;
+           sd = mol->nextIntegrableObject(j)) {
+
+        vel = sd->getVel();
+        pos = sd->getPos();
+        mass = sd->getMass();
+
+        // semi-implicit Euler: velocity kick then position drift
+        vel += (dt_ / mass * Constants::energyConvert) * sd->getFrc();
+        pos += dt_ * vel;
+
+        sd->setVel(vel);
+        sd->setPos(pos);
+
+        if (sd->isDirectional()) {
+          Tb = sd->lab2Body(sd->getTrq());
+          ji = sd->getJ();
+          ji += (dt_ * Constants::energyConvert) * Tb;
+          rotAlgo_->rotate(sd, ji, dt_);
+          sd->setJ(ji);
+        }
+      }
+
+      if (hasFlucQ_) {
+        for (atom = mol->beginFluctuatingCharge(k); atom != NULL;
+             atom = mol->nextFluctuatingCharge(k)) {
+          cvel = atom->getFlucQVel();
+          cvel += dt_ * atom->getFlucQFrc() / atom->getChargeMass();
+          atom->setFlucQVel(cvel);
+          atom->setFlucQPos(atom->getFlucQPos() + dt_ * cvel);
+        }
+      }
+    }
+  }
+
+  void FIRE::writeReport(EndCriteria::Type ecType) {
+    std::ostringstream ec;
+    ec << ecType;
+
+    sprintf(painCave.errMsg,
+            "FIRE minimization finished (%s):\n"
+            "\titerations             = %d\n"
+            "\tforce evaluations      = %d\n"
+            "\tvelocity resets        = %d\n"
+            "\tfinal time step        = %g fs\n"
+            "\tinitial potential      = %g kcal/mol\n"
+            "\tfinal potential        = %g kcal/mol\n"
+            "\tRMS gradient           = %g\n",
+            ec.str().c_str(), nIterations_, nForceEvaluations_, nResets_,
+            dt_, initialPotential_, finalPotential_,
+            std::sqrt(gradSq_ / nDOF_));
+    painCave.isFatal = 0;
+    painCave.severity = OPENMD_INFO;
+    simError();
+  }
+}
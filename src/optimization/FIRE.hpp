@@ -0,0 +1,119 @@
+/*
+ * Copyright (c) 2018 The University of Notre Dame. All Rights Reserved.
+ *
+ * The University of Notre Dame grants you ("Licensee") a
+ * non-exclusive, royalty free, license to use, modify and
+ * redistribute this software in source and binary code form, provided
+ * that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the
+ *    distribution.
+ *
+ * This software is provided "AS IS," without a warranty of any
+ * kind. All express or implied conditions, representations and
+ * warranties, including any implied warranty of merchantability,
+ * fitness for a particular purpose or non-infringement, are hereby
+ * excluded.  The University of Notre Dame and its licensors shall not
+ * be liable for any damages suffered by licensee as a result of
+ * using, modifying or distributing the software or its
+ * derivatives. In no event will the University of Notre Dame or its
+ * licensors be liable for any lost revenue, profit or data, or for
+ * direct, indirect, special, consequential, incidental or punitive
+ * damages, however caused and regardless of the theory of liability,
+ * arising out of the use of or inability to use software, even if the
+ * University of Notre Dame has been advised of the possibility of
+ * such damages.
+ *
+ * SUPPORT OPEN SCIENCE!  If you use OpenMD or its source code in your
+ * research, please cite the appropriate papers when you publish your
+ * work.  Good starting points are:
+ *                                                                      
+ * [1]  Meineke, et al., J. Comp. Chem. 26, 252-271 (2005).             
+ * [2]  Fennell & Gezelter, J. Chem. Phys. 124, 234104 (2006).          
+ * [3]  Sun, Lin & Gezelter, J. Chem. Phys. 128, 234107 (2008).          
+ * [4]  Kuang & Gezelter,  J. Chem. Phys. 133, 164101 (2010).
+ * [5]  Vardeman, Stocker & Gezelter, J. Chem. Theory Comput. 7, 834 (2011).
+ */
+
+#ifndef OPTIMIZATION_FIRE_HPP
+#define OPTIMIZATION_FIRE_HPP
+
+#include "optimization/Method.hpp"
+#include "brains/SimInfo.hpp"
+#include "integrators/RotationAlgorithm.hpp"
+
+using namespace QuantLib;
+namespace OpenMD {
+
+  /**
+   * @class FIRE
+   * Fast Inertial Relaxation Engine (Bitzek, Koskinen, Gahler,
+   * Moseler & Gumbsch, Phys. Rev. Lett. 97, 170201 (2006)).
+   *
+   * FIRE is a damped molecular dynamics minimizer.  Each iteration
+   * requires a single force evaluation, and the positions,
+   * orientations and fluctuating charges are propagated directly in
+   * the current Snapshot, so the coordinates are never copied into
+   * DynamicVectors and the neighbor list is only rebuilt when the
+   * displacements exceed the skin thickness.  Velocities are mixed
+   * toward the steepest descent direction while the power F.v is
+   * positive, and are zeroed (with a smaller time step) when the
+   * system starts moving uphill.
+   */
+  class FIRE : public QuantLib::OptimizationMethod {
+  public:
+    FIRE(SimInfo* info);
+    virtual ~FIRE();
+
+    virtual EndCriteria::Type minimize(Problem& P,
+                                       const EndCriteria& endCriteria);
+
+  private:
+    /** computes the power (F.v + tau.omega + f_q v_q) and the
+        norms of the velocities and forces in each subspace */
+    void computePower();
+    /** mixes the velocities toward the force directions */
+    void mixVelocities();
+    /** zeroes all velocities, angular momenta and charge velocities */
+    void zeroVelocities();
+    /** velocity kick followed by a position / orientation drift */
+    void move();
+    void writeReport(EndCriteria::Type ecType);
+
+    SimInfo* info_;
+    RotationAlgorithm* rotAlgo_;
+    bool hasFlucQ_;
+    int nDOF_;
+
+    // FIRE parameters
+    RealType dt_;
+    RealType dtMax_;
+    RealType alpha_;
+    RealType alphaStart_;
+    RealType fInc_;
+    RealType fDec_;
+    RealType fAlpha_;
+    int nMin_;
+    int statusFrequency_;
+
+    // reductions from computePower()
+    RealType power_;
+    RealType vNorm_, fNorm_;
+    RealType jNorm_, tNorm_;
+    RealType qvNorm_, qfNorm_;
+    RealType gradSq_;
+
+    // convergence statistics
+    int nIterations_;
+    int nForceEvaluations_;
+    int nResets_;
+    RealType initialPotential_;
+    RealType finalPotential_;
+  };
+}
+#endif
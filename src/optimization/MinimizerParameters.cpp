@@ -55,6 +55,9 @@ namespace OpenMD {
     DefineOptionalParameterWithDefaultValue(RootEpsilon, "rootEpsilon", 1e-5);
     DefineOptionalParameterWithDefaultValue(FunctionEpsilon, "functionEpsilon", 1e-5);
     DefineOptionalParameterWithDefaultValue(GradientNormEpsilon, "gradientNormEpsilon", 1e-5);
+    DefineOptionalParameterWithDefaultValue(FireTimeStep, "fireTimeStep", 1.0);
+    DefineOptionalParameterWithDefaultValue(FireMaxTimeStep, "fireMaxTimeStep", 10.0);
+    DefineOptionalParameterWithDefaultValue(FireStatusFrequency, "fireStatusFrequency", 1);
   }
   
   MinimizerParameters::~MinimizerParameters() {    
@@ -62,7 +65,8 @@ namespace OpenMD {
   
   void MinimizerParameters::validate() {
     CheckParameter(Method, isEqualIgnoreCase("SD") || 
-                   isEqualIgnoreCase("CG") || isEqualIgnoreCase("BFGS"));
+                   isEqualIgnoreCase("CG") || isEqualIgnoreCase("BFGS") ||
+                   isEqualIgnoreCase("FIRE"));
     CheckParameter(MaxIterations, isPositive());
     int one = 1;
     int mi = this->getMaxIterations();
@@ -70,5 +74,8 @@ namespace OpenMD {
                    isGreaterThanOrEqualTo(one) && isLessThanOrEqualTo(mi));
     CheckParameter(RootEpsilon, isPositive());
     CheckParameter(GradientNormEpsilon, isPositive());
+    CheckParameter(FireTimeStep, isPositive());
+    CheckParameter(FireMaxTimeStep, isPositive());
+    CheckParameter(FireStatusFrequency, isPositive());
   }  
 }
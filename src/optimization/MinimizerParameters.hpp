@@ -54,6 +54,9 @@ namespace OpenMD {
     DeclareParameter(RootEpsilon, RealType);
     DeclareParameter(FunctionEpsilon, RealType);
     DeclareParameter(GradientNormEpsilon, RealType);
+    DeclareParameter(FireTimeStep, RealType);
+    DeclareParameter(FireMaxTimeStep, RealType);
+    DeclareParameter(FireStatusFrequency, int);
   public:
     MinimizerParameters();
     virtual ~MinimizerParameters();
@@ -57,7 +57,7 @@ namespace OpenMD {
     OptimizationCreator(const std::string& ident) : ident_(ident) {}
     virtual ~OptimizationCreator() {}    
     const std::string& getIdent() const { return ident_; }    
-    virtual QuantLib::OptimizationMethod* create() const = 0;
+    virtual QuantLib::OptimizationMethod* create(SimInfo* info) const = 0;
     
   private:
     std::string ident_;
@@ -67,7 +67,19 @@ namespace OpenMD {
   class OptimizationBuilder : public OptimizationCreator {
   public:
     OptimizationBuilder(const std::string& ident) : OptimizationCreator(ident) {}
-    virtual  QuantLib::OptimizationMethod* create() const {return new ConcreteOptimization();}
+    virtual  QuantLib::OptimizationMethod* create(SimInfo*) const {return new ConcreteOptimization();}
+  };
+
+  /**
+   * @class SimOptimizationBuilder
+   * Builder for optimization methods which work directly on the
+   * simulation (e.g. FIRE) and therefore need the SimInfo object.
+   */
+  template<class ConcreteOptimization>
+  class SimOptimizationBuilder : public OptimizationCreator {
+  public:
+    SimOptimizationBuilder(const std::string& ident) : OptimizationCreator(ident) {}
+    virtual  QuantLib::OptimizationMethod* create(SimInfo* info) const {return new ConcreteOptimization(info);}
   };
   
 }
@@ -69,7 +69,7 @@ namespace OpenMD {
     CreatorMapType::iterator i = creatorMap_.find(id);
     if (i != creatorMap_.end()) {
       //invoke functor to create object
-      return (i->second)->create();
+      return (i->second)->create(info);
     } else {
       return NULL;
     }
@@ -45,7 +45,7 @@
 namespace OpenMD{
 
   PotentialEnergyObjectiveFunction::PotentialEnergyObjectiveFunction(SimInfo* info, ForceManager* forceMan)
-    : info_(info), forceMan_(forceMan), thermo(info) {   
+    : info_(info), forceMan_(forceMan), thermo(info), hasFlucQ_(false) {
     shake_ = new Shake(info_);
     
     if (info_->usesFluctuatingCharges()) {
@@ -88,6 +88,14 @@ namespace OpenMD{
     return thermo.getPotential();
   }
   
+  RealType PotentialEnergyObjectiveFunction::valueAndForces() {
+    shake_->constraintR();
+    forceMan_->calcForces();
+    if (hasFlucQ_) fqConstraints_->applyConstraints();
+    shake_->constraintF();
+    return thermo.getPotential();
+  }
+
   void PotentialEnergyObjectiveFunction::setCoor(const DynamicVector<RealType> &x) const {
     Vector3d position;
     Vector3d eulerAngle;
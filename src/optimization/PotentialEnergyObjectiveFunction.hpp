@@ -65,6 +65,14 @@ namespace OpenMD {
 
     DynamicVector<RealType> setInitialCoords();
 
+    /**
+     * Computes the potential and forces for the configuration that
+     * is currently in the snapshot.  Used by minimizers (FIRE) which
+     * propagate the StuntDoubles directly rather than through a
+     * DynamicVector of coordinates.
+     */
+    RealType valueAndForces();
+
   private:
     // transform minimization coordinates into cartesian and
     // rotational coordinates
@@ -77,6 +77,18 @@ namespace QuantLib {
         //! current value of the local minimum
         const DynamicVector<RealType>& currentValue() const { return currentValue_; }
 
+        //! record one value and gradient evaluation that was performed
+        //  directly on the simulation state (e.g. by FIRE) and report it
+        void updateStatus(RealType functionValue) {
+            ++functionEvaluation_;
+            ++gradientEvaluation_;
+            functionValue_ = functionValue;
+            statusFunction_.writeStatus(functionEvaluation_,
+                                        gradientEvaluation_,
+                                        currentValue_,
+                                        functionValue_);
+        }
+
         void setFunctionValue(RealType functionValue) {
             functionValue_=functionValue;
         }
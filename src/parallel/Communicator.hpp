@@ -52,6 +52,7 @@
 #include <config.h>
 #include <mpi.h>
 #include "math/SquareMatrix3.hpp"
+#include "utils/PerformanceCounters.hpp"
 
 using namespace std;
 namespace OpenMD{
@@ -173,6 +174,10 @@ namespace OpenMD{
       for (int i = 0; i < nCommProcs; i++) {
         size_ += counts[i];
       }
+
+      int typeSize;
+      MPI_Type_size(MPITraits<T>::Type(), &typeSize);
+      bytes_ = (long long) size_ * typeSize;
     }
 
     
@@ -189,6 +194,7 @@ namespace OpenMD{
                      &displacements[0], 
                      MPITraits<T>::Type(),
                      myComm);
+      PerformanceCounters::getInstance()->addCommBytes(bytes_);
     }       
     
     void scatter(vector<T>& v1, vector<T>& v2) {
@@ -197,6 +203,7 @@ namespace OpenMD{
             
       MPI_Reduce_scatter(&v1[0], &v2[0], &counts[0], 
                          MPITraits<T>::Type(), MPI_SUM, myComm);
+      PerformanceCounters::getInstance()->addCommBytes(bytes_);
     }
     
     int getSize() {
@@ -206,6 +213,7 @@ namespace OpenMD{
   private:
     int planSize_;     ///< how many are on local proc
     int size_;
+    long long bytes_;  ///< bytes moved by one gather or scatter
     vector<int> counts;
     vector<int> displacements;
     MPI_Comm myComm;
@@ -47,6 +47,7 @@
 #include "brains/SnapshotManager.hpp"
 #include "nonbonded/NonBondedInteraction.hpp"
 #include "nonbonded/InteractionManager.hpp"
+#include "utils/BinaryIO.hpp"
 #include "utils/Tuple.hpp"
 
 using namespace std;
@@ -112,6 +113,14 @@ namespace OpenMD {
 
     // neighbor list routines
     virtual bool checkNeighborList();
+    /** Writes the group positions saved at the last list build */
+    void saveNeighborListState(std::ostream& os) {
+      writeBinary(os, saved_CG_positions_);
+    }
+    /** Restores the positions written by saveNeighborListState */
+    void loadNeighborListState(std::istream& is) {
+      readBinary(is, saved_CG_positions_);
+    }
     virtual void buildNeighborList(vector<int>& neighborList, vector<int>& point) = 0;
 
     void setCutoffRadius(RealType rCut);
@@ -134,7 +143,6 @@ namespace OpenMD {
        
     // atom bookkeeping
     virtual int& getNAtomsInRow() = 0;
-    virtual vector<int>& getExcludesForAtom(int atom1) = 0;
     virtual bool skipAtomPair(int atom1, int atom2, int cg1, int cg2) = 0;
     virtual bool excludeAtomPair(int atom1, int atom2) = 0;
     virtual int getGlobalIDRow(int atom1) = 0;
@@ -181,16 +189,20 @@ namespace OpenMD {
 
 
     /** 
-     * The topological distance between two atomic sites is handled
-     * via two vector structures for speed.  These structures agnostic
-     * regarding the parallel decomposition.  The index for
-     * toposForAtom could be local or row, while the values could be
-     * local or column.  It will be up to the specific decomposition
-     * method to fill these.
+     * The topological distances and exclusions for each atomic site
+     * are held in compressed sparse row (CSR) form.  The entries for
+     * atom i live in [topoStart[i], topoStart[i+1]) of toposForAtom
+     * and topoDist (sorted by neighbor index), and likewise for
+     * excludesForAtom.  These structures are agnostic regarding the
+     * parallel decomposition.  The row index could be local or row,
+     * while the stored neighbors could be local or column.  It will be
+     * up to the specific decomposition method to fill these.
      */
-    vector<vector<int> > toposForAtom; 
-    vector<vector<int> > topoDist;                                       
-    vector<vector<int> > excludesForAtom;
+    vector<int> topoStart;
+    vector<int> toposForAtom; 
+    vector<int> topoDist;                                       
+    vector<int> excludeStart;
+    vector<int> excludesForAtom;
     vector<vector<int> > groupList_;
     vector<RealType> massFactors;
     vector<AtomType*> atypesLocal;
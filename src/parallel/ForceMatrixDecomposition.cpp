@@ -44,6 +44,8 @@
 #include "nonbonded/NonBondedInteraction.hpp"
 #include "brains/SnapshotManager.hpp"
 #include "brains/PairList.hpp"
+#include "utils/PerformanceCounters.hpp"
+#include <algorithm>
 
 using namespace std;
 namespace OpenMD {
@@ -99,14 +101,10 @@ namespace OpenMD {
     AtomLocalToGlobal = info_->getGlobalAtomIndices();
     cgLocalToGlobal = info_->getGlobalGroupIndices();
     vector<int> globalGroupMembership = info_->getGlobalGroupMembership();
+    int nGlobalGroups = info_->getNGlobalCutoffGroups();
 
     massFactors = info_->getMassFactors();
 
-    PairList* excludes = info_->getExcludedInteractions();
-    PairList* oneTwo = info_->getOneTwoInteractions();
-    PairList* oneThree = info_->getOneThreeInteractions();
-    PairList* oneFour = info_->getOneFourInteractions();
-    
     if (needVelocities_) 
       snap_->cgData.setStorageLayout(DataStorage::dslPosition | 
                                      DataStorage::dslVelocity);
@@ -200,93 +198,35 @@ namespace OpenMD {
     AtomPlanRealRow->gather(massFactors, massFactorsRow);
     AtomPlanRealColumn->gather(massFactors, massFactorsCol);
 
+    // Atoms are assigned to their cutoff groups through a global ->
+    // row (or column) group map, which keeps this linear in the
+    // number of atoms:
+    vector<int> cgGlobalToRow(nGlobalGroups, -1);
+    for (int i = 0; i < nGroupsInRow_; i++) 
+      cgGlobalToRow[cgRowToGlobal[i]] = i;
+
     groupListRow_.clear();
     groupListRow_.resize(nGroupsInRow_);
-    for (int i = 0; i < nGroupsInRow_; i++) {
-      int gid = cgRowToGlobal[i];
-      for (int j = 0; j < nAtomsInRow_; j++) {
-        int aid = AtomRowToGlobal[j];
-        if (globalGroupMembership[aid] == gid)
-          groupListRow_[i].push_back(j);
-      }      
+    for (int j = 0; j < nAtomsInRow_; j++) {
+      int i = cgGlobalToRow[globalGroupMembership[AtomRowToGlobal[j]]];
+      if (i >= 0) groupListRow_[i].push_back(j);
     }
 
+    vector<int> cgGlobalToCol(nGlobalGroups, -1);
+    for (int i = 0; i < nGroupsInCol_; i++) 
+      cgGlobalToCol[cgColToGlobal[i]] = i;
+
     groupListCol_.clear();
     groupListCol_.resize(nGroupsInCol_);
-    for (int i = 0; i < nGroupsInCol_; i++) {
-      int gid = cgColToGlobal[i];
-      for (int j = 0; j < nAtomsInCol_; j++) {
-        int aid = AtomColToGlobal[j];
-        if (globalGroupMembership[aid] == gid)
-          groupListCol_[i].push_back(j);
-      }      
+    for (int j = 0; j < nAtomsInCol_; j++) {
+      int i = cgGlobalToCol[globalGroupMembership[AtomColToGlobal[j]]];
+      if (i >= 0) groupListCol_[i].push_back(j);
     }
 
-    excludesForAtom.clear();
-    excludesForAtom.resize(nAtomsInRow_);
-    toposForAtom.clear();
-    toposForAtom.resize(nAtomsInRow_);
-    topoDist.clear();
-    topoDist.resize(nAtomsInRow_);
-    for (int i = 0; i < nAtomsInRow_; i++) {
-      int iglob = AtomRowToGlobal[i];
-
-      for (int j = 0; j < nAtomsInCol_; j++) {
-        int jglob = AtomColToGlobal[j];
-
-        if (excludes->hasPair(iglob, jglob)) 
-          excludesForAtom[i].push_back(j);       
-        
-        if (oneTwo->hasPair(iglob, jglob)) {
-          toposForAtom[i].push_back(j);
-          topoDist[i].push_back(1);
-        } else {
-          if (oneThree->hasPair(iglob, jglob)) {
-            toposForAtom[i].push_back(j);
-            topoDist[i].push_back(2);
-          } else {
-            if (oneFour->hasPair(iglob, jglob)) {
-              toposForAtom[i].push_back(j);
-              topoDist[i].push_back(3);
-            }
-          }
-        }
-      }      
-    }
+    buildPairTables(AtomRowToGlobal, AtomColToGlobal);
 
 #else
-    excludesForAtom.clear();
-    excludesForAtom.resize(nLocal_);
-    toposForAtom.clear();
-    toposForAtom.resize(nLocal_);
-    topoDist.clear();
-    topoDist.resize(nLocal_);
-
-    for (int i = 0; i < nLocal_; i++) {
-      int iglob = AtomLocalToGlobal[i];
-
-      for (int j = 0; j < nLocal_; j++) {
-        int jglob = AtomLocalToGlobal[j];
-
-        if (excludes->hasPair(iglob, jglob)) 
-          excludesForAtom[i].push_back(j);              
-        
-        if (oneTwo->hasPair(iglob, jglob)) {
-          toposForAtom[i].push_back(j);
-          topoDist[i].push_back(1);
-        } else {
-          if (oneThree->hasPair(iglob, jglob)) {
-            toposForAtom[i].push_back(j);
-            topoDist[i].push_back(2);
-          } else {
-            if (oneFour->hasPair(iglob, jglob)) {
-              toposForAtom[i].push_back(j);
-              topoDist[i].push_back(3);
-            }
-          }
-        }
-      }      
-    }
+    buildPairTables(AtomLocalToGlobal, AtomLocalToGlobal);
 #endif
 
     // allocate memory for the parallel objects
@@ -295,23 +235,110 @@ namespace OpenMD {
     for (int i = 0; i < nLocal_; i++) 
       atypesLocal[i] = ff_->getAtomType(idents[i]);
 
+    vector<int> cgGlobalToLocal(nGlobalGroups, -1);
+    for (int i = 0; i < nGroups_; i++) 
+      cgGlobalToLocal[cgLocalToGlobal[i]] = i;
+
     groupList_.clear();
     groupList_.resize(nGroups_);
-    for (int i = 0; i < nGroups_; i++) {
-      int gid = cgLocalToGlobal[i];
-      for (int j = 0; j < nLocal_; j++) {
-        int aid = AtomLocalToGlobal[j];
-        if (globalGroupMembership[aid] == gid) {
-          groupList_[i].push_back(j);
+    for (int j = 0; j < nLocal_; j++) {
+      int i = cgGlobalToLocal[globalGroupMembership[AtomLocalToGlobal[j]]];
+      if (i >= 0) groupList_[i].push_back(j);
+    }
+  }
+    
+  /**
+   * Builds the CSR exclusion and topological distance tables by
+   * walking the bonded pair lists once, rather than querying every
+   * row x column atom pair.  Each stored pair (a, b) is entered for
+   * both orderings that are present on this processor, and a pair
+   * that shows up at several topological distances keeps the
+   * shortest one.
+   */
+  void ForceMatrixDecomposition::buildPairTables(const vector<int>& rowToGlobal,
+                                                 const vector<int>& colToGlobal) {
+    int nRows = rowToGlobal.size();
+    int nGlobal = info_->getNGlobalAtoms();
+
+    vector<int> globalToRow(nGlobal, -1);
+    vector<int> globalToCol(nGlobal, -1);
+    for (int i = 0; i < nRows; i++) globalToRow[rowToGlobal[i]] = i;
+    for (unsigned int j = 0; j < colToGlobal.size(); j++)
+      globalToCol[colToGlobal[j]] = j;
+
+    PairList* lists[4];
+    lists[0] = info_->getExcludedInteractions();
+    lists[1] = info_->getOneTwoInteractions();
+    lists[2] = info_->getOneThreeInteractions();
+    lists[3] = info_->getOneFourInteractions();
+
+    // Gather (row, column, distance) triplets; distance 0 marks an
+    // exclusion:
+    vector<int> tRow, tCol, tDist;
+    for (int l = 0; l < 4; l++) {
+      const vector<int>& offsets = lists[l]->getRowOffsets();
+      const vector<int>& partners = lists[l]->getPartners();
+      int nListRows = offsets.size() - 1;
+      for (int a = 0; a < nListRows; a++) {
+        for (int p = offsets[a]; p < offsets[a+1]; p++) {
+          int b = partners[p];
+          if (globalToRow[a] >= 0 && globalToCol[b] >= 0) {
+            tRow.push_back(globalToRow[a]);
+            tCol.push_back(globalToCol[b]);
+            tDist.push_back(l);
+          }
+          if (globalToRow[b] >= 0 && globalToCol[a] >= 0) {
+            tRow.push_back(globalToRow[b]);
+            tCol.push_back(globalToCol[a]);
+            tDist.push_back(l);
+          }
         }
-      }      
-    }    
+      }
+    }
+
+    // Counting sort of the triplets by row:
+    vector<int> start(nRows + 1, 0);
+    for (unsigned int t = 0; t < tRow.size(); t++) start[tRow[t] + 1]++;
+    for (int i = 0; i < nRows; i++) start[i+1] += start[i];
+    vector<int> next(start.begin(), start.end() - 1);
+    vector<pair<int, int> > entries(tRow.size());
+    for (unsigned int t = 0; t < tRow.size(); t++) 
+      entries[next[tRow[t]]++] = make_pair(tCol[t], tDist[t]);
+
+    excludeStart.assign(nRows + 1, 0);
+    topoStart.assign(nRows + 1, 0);
+    excludesForAtom.clear();
+    toposForAtom.clear();
+    topoDist.clear();
+
+    for (int i = 0; i < nRows; i++) {
+      // each row holds only the bonded neighborhood of one atom:
+      sort(entries.begin() + start[i], entries.begin() + start[i+1]);
+      int lastTopo = -1;
+      for (int e = start[i]; e < start[i+1]; e++) {
+        int j = entries[e].first;
+        int d = entries[e].second;
+        if (d == 0) {
+          excludesForAtom.push_back(j);
+        } else if (j != lastTopo) {
+          // sorted by distance within a column, so the first is shortest
+          toposForAtom.push_back(j);
+          topoDist.push_back(d);
+          lastTopo = j;
+        }
+      }
+      excludeStart[i+1] = excludesForAtom.size();
+      topoStart[i+1] = toposForAtom.size();
+    }
   }
     
   int ForceMatrixDecomposition::getTopologicalDistance(int atom1, int atom2) {
-    for (unsigned int j = 0; j < toposForAtom[atom1].size(); j++) {
-      if (toposForAtom[atom1][j] == atom2) 
-        return topoDist[atom1][j];
+    // Rows hold only the handful of 1-2, 1-3 and 1-4 partners of
+    // atom1, so this scan is bounded by the bonded connectivity, not
+    // by the system size.
+    for (int j = topoStart[atom1]; j < topoStart[atom1+1]; j++) {
+      if (toposForAtom[j] == atom2) 
+        return topoDist[j];
     }                                           
     return 0;
   }
@@ -449,6 +476,10 @@ namespace OpenMD {
   void ForceMatrixDecomposition::distributeData()  {
    
 #ifdef IS_MPI
+    PerformanceCounters* counters = PerformanceCounters::getInstance();
+    static int distributeBytes = 
+      counters->getCounterID("Communication/DistributeBytes");
+    long long bytesBefore = counters->getCommBytes();
 
     snap_ = sman_->getCurrentSnapshot();
     storageLayout_ = sman_->getStorageLayout();
@@ -517,6 +548,8 @@ namespace OpenMD {
                                  atomColData.flucQPos);
     }
 
+    if (counters->isEnabled())
+      counters->add(distributeBytes, counters->getCommBytes() - bytesBefore);
 #endif      
   }
   
@@ -586,6 +619,11 @@ namespace OpenMD {
   
   void ForceMatrixDecomposition::collectData() {
 #ifdef IS_MPI
+    PerformanceCounters* counters = PerformanceCounters::getInstance();
+    static int collectBytes = 
+      counters->getCounterID("Communication/CollectBytes");
+    long long bytesBefore = counters->getCommBytes();
+
     snap_ = sman_->getCurrentSnapshot();
     storageLayout_ = sman_->getStorageLayout();
 
@@ -804,6 +842,9 @@ namespace OpenMD {
     MPI_Allreduce(MPI_IN_PLACE, 
                   &snap_->frameData.conductiveHeatFlux[0], 3, 
                   MPI_REALTYPE, MPI_SUM, col);
+
+    if (counters->isEnabled())
+      counters->add(collectBytes, counters->getCommBytes() - bytesBefore);
 #endif
 
   }
@@ -961,10 +1002,6 @@ namespace OpenMD {
     return d;    
   }
 
-  vector<int>& ForceMatrixDecomposition::getExcludesForAtom(int atom1) {
-    return excludesForAtom[atom1];
-  }
-
   /**
    * We need to exclude some overcounted interactions that result from
    * the parallel decomposition.
@@ -1020,9 +1057,8 @@ namespace OpenMD {
     // excludesForAtom was constructed to use row/column indices in the MPI
     // version, and to use local IDs in the non-MPI version:
     
-    for (vector<int>::iterator i = excludesForAtom[atom1].begin();
-         i != excludesForAtom[atom1].end(); ++i) {
-      if ( (*i) == atom2 ) return true;
+    for (int j = excludeStart[atom1]; j < excludeStart[atom1+1]; j++) {
+      if (excludesForAtom[j] == atom2) return true;
     }
 
     return false;
@@ -87,7 +87,6 @@ namespace OpenMD {
     // atom bookkeeping
     int& getNAtomsInRow();
     int getTopologicalDistance(int atom1, int atom2);
-    vector<int>& getExcludesForAtom(int atom1); 
     bool skipAtomPair(int atom1, int atom2, int cg1, int cg2);
     bool excludeAtomPair(int atom1, int atom2);
     int getGlobalIDRow(int atom1);
@@ -102,6 +101,9 @@ namespace OpenMD {
     void unpackInteractionData(InteractionData &idat, int atom1, int atom2);
 
   private:     
+    void buildPairTables(const vector<int>& rowToGlobal,
+                         const vector<int>& colToGlobal);
+
     int nLocal_;
     int nGroups_;
     vector<int> AtomLocalToGlobal;
@@ -76,6 +76,7 @@ namespace OpenMD {
     MemoryUtils::deletePointers(cutoffGroups_);
     MemoryUtils::deletePointers(constraintPairs_);
     MemoryUtils::deletePointers(constraintElems_);
+    MemoryUtils::deletePointers(constraintClusters_);
 
     // integrableObjects_ don't own the objects
     integrableObjects_.clear();
@@ -142,6 +143,13 @@ namespace OpenMD {
       constraintElems_.push_back(cp);
     }
   }
+
+  void Molecule::addConstraintCluster(ConstraintCluster* cc) {
+    if (std::find(constraintClusters_.begin(), constraintClusters_.end(), cc) ==
+        constraintClusters_.end()) {
+      constraintClusters_.push_back(cc);
+    }
+  }
   
   void Molecule::complete() {
     
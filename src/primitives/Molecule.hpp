@@ -53,6 +53,7 @@
 #include <iostream>
 
 #include "constraints/ConstraintPair.hpp"
+#include "constraints/ConstraintCluster.hpp"
 #include "math/Vector3.hpp"
 #include "primitives/Atom.hpp"
 #include "primitives/RigidBody.hpp"
@@ -90,6 +91,7 @@ namespace OpenMD{
     typedef std::vector<StuntDouble*>::iterator IntegrableObjectIterator;
     typedef std::vector<ConstraintPair*>::iterator ConstraintPairIterator;
     typedef std::vector<ConstraintElem*>::iterator ConstraintElemIterator;
+    typedef std::vector<ConstraintCluster*>::iterator ConstraintClusterIterator;
     typedef std::vector<Atom*>::iterator FluctuatingChargeIterator;
     typedef std::vector<HBondDonor*>::iterator HBondDonorIterator;
     typedef std::vector<Atom*>::iterator HBondAcceptorIterator;
@@ -164,6 +166,8 @@ namespace OpenMD{
     void addConstraintPair(ConstraintPair* consPair);
     
     void addConstraintElem(ConstraintElem* consElem);
+
+    void addConstraintCluster(ConstraintCluster* consCluster);
     
     /** */
     void complete();
@@ -338,6 +342,16 @@ namespace OpenMD{
       return (i == constraintElems_.end()) ? NULL : *i;    
     }
 
+    ConstraintCluster* beginConstraintCluster(std::vector<ConstraintCluster*>::iterator& i) {
+      i = constraintClusters_.begin();
+      return (i == constraintClusters_.end()) ? NULL : *i;
+    }
+    
+    ConstraintCluster* nextConstraintCluster(std::vector<ConstraintCluster*>::iterator& i) {            
+      ++i;
+      return (i == constraintClusters_.end()) ? NULL : *i;    
+    }
+
     Atom* beginFluctuatingCharge(std::vector<Atom*>::iterator& i) {
       i = fluctuatingCharges_.begin();
       return (i == fluctuatingCharges_.end()) ? NULL : *i;
@@ -459,6 +473,7 @@ namespace OpenMD{
     std::vector<CutoffGroup*> cutoffGroups_;
     std::vector<ConstraintPair*> constraintPairs_;
     std::vector<ConstraintElem*> constraintElems_;
+    std::vector<ConstraintCluster*> constraintClusters_;
     std::vector<Atom*> fluctuatingCharges_;
     std::vector<HBondDonor*> hBondDonors_;
     std::vector<Atom*> hBondAcceptors_;
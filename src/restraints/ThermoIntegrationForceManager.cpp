@@ -44,7 +44,12 @@
 #include <mpi.h>
 #endif
 
+#include <cmath>
+#include <cstdio>
+
 #include "restraints/ThermoIntegrationForceManager.hpp"
+#include "utils/StringUtils.hpp"
+#include "utils/simError.h"
 
 namespace OpenMD {
   
@@ -85,9 +90,62 @@ namespace OpenMD {
     
     // build the scaling factor used to modulate the forces and torques
     factor_ = pow(tIntLambda_, tIntK_);
+
+    // The potential is linear in lambda^k, so the energies at any
+    // other lambda follow from the raw and harmonic parts computed
+    // for this step:
+    if (simParam->haveThermodynamicIntegrationLambdas()) {
+      lambdas_ = simParam->getThermodynamicIntegrationLambdas();
+      for (unsigned int i = 0; i < lambdas_.size(); i++) {
+        if (lambdas_[i] < 0.0 || lambdas_[i] > 1.0) {
+          sprintf(painCave.errMsg,
+                  "ThermoIntegration error: thermodynamicIntegrationLambdas\n"
+                  "\tvalues must lie between 0 and 1 (found %f).\n",
+                  lambdas_[i]);
+          painCave.isFatal = 1;
+          simError();
+        }
+        lambdaFactors_.push_back(pow(lambdas_[i], tIntK_));
+      }
+
+      if (simParam->haveStatusTime()) {
+        lambdaTime_ = simParam->getStatusTime();
+      } else {
+        lambdaTime_ = simParam->getDt();
+      }
+      currLambdaTime_ = currSnapshot_->getTime();
+
+      lambdaFileName_ = getPrefix(info_->getFinalConfigFileName()) + 
+        ".lambda";
+
+#ifdef IS_MPI
+      if (worldRank == 0) {
+#endif
+        lambdaOut_.open(lambdaFileName_.c_str(), 
+                        std::ios::out | std::ios::trunc);
+        if (!lambdaOut_) {
+          sprintf(painCave.errMsg,
+                  "ThermoIntegration error: could not open \"%s\"\n"
+                  "\tfor writing.\n", lambdaFileName_.c_str());
+          painCave.isFatal = 1;
+          simError();
+        }
+        lambdaOut_ << "# potential energies (kcal/mol) at neighboring "
+                   << "lambda values\n";
+        lambdaOut_ << "# sampled lambda: " << tIntLambda_ 
+                   << "  k: " << tIntK_ << "\n";
+        lambdaOut_ << "# time";
+        for (unsigned int i = 0; i < lambdas_.size(); i++) 
+          lambdaOut_ << "\tU(" << lambdas_[i] << ")";
+        lambdaOut_ << "\n";
+#ifdef IS_MPI
+      }
+#endif
+    }
   }
   
   ThermoIntegrationForceManager::~ThermoIntegrationForceManager(){
+    if (lambdaOut_.is_open()) lambdaOut_.close();
   }
   
   void ThermoIntegrationForceManager::calcForces(){
@@ -163,5 +221,33 @@ namespace OpenMD {
     // give the final values to stats
     curSnapshot->setLongRangePotential(lrPot_);
     curSnapshot->setRestraintPotential(vHarm_);
-  }  
+
+    if (!lambdas_.empty() && curSnapshot->getTime() >= currLambdaTime_) {
+      writeLambdaEnergies(curSnapshot->getTime(),
+                          curSnapshot->getShortRangePotential() + 
+                          curSnapshot->getRawPotential());
+      currLambdaTime_ += lambdaTime_;
+    }
+  }
+
+  void ThermoIntegrationForceManager::writeLambdaEnergies(RealType time,
+                                                          RealType rawPot) {
+    // The forces of the whole system are scaled by lambda^k, and the
+    // restraints by (1 - lambda^k), so this is the Hamiltonian being
+    // sampled at each of the requested lambda values.  The raw and
+    // harmonic energies have already been summed over all processors.
+#ifdef IS_MPI
+    if (worldRank != 0) return;
+#endif
+    char buffer[32];
+    sprintf(buffer, "%.6f", time);
+    lambdaOut_ << buffer;
+    for (unsigned int i = 0; i < lambdaFactors_.size(); i++) {
+      RealType f = lambdaFactors_[i];
+      sprintf(buffer, "\t%.10g", f * rawPot + (1.0 - f) * vHarm_);
+      lambdaOut_ << buffer;
+    }
+    lambdaOut_ << "\n";
+    lambdaOut_.flush();
+  }
 }
@@ -43,6 +43,8 @@
 #ifndef RESTRAINTS_THERMOINTEGRATIONFORCEMANAGER_HPP
 #define RESTRAINTS_THERMOINTEGRATIONFORCEMANAGER_HPP
 
+#include <fstream>
+#include <vector>
 #include "restraints/RestraintForceManager.hpp"
 
 namespace OpenMD {
@@ -64,6 +66,17 @@ namespace OpenMD {
     RealType factor_;
     RealType lrPot_;
     RealType vHarm_;
+
+    // neighboring lambda values at which the potential is also
+    // evaluated, and the matching scaling factors (lambda^k):
+    std::vector<RealType> lambdas_;
+    std::vector<RealType> lambdaFactors_;
+    std::string lambdaFileName_;
+    std::ofstream lambdaOut_;
+    RealType lambdaTime_;
+    RealType currLambdaTime_;
+
+    void writeLambdaEnergies(RealType time, RealType rawPot);
   };
   
 }
@@ -57,6 +57,7 @@
 #include "utils/Tuple.hpp"
 #include "brains/Thermo.hpp"
 #include "math/ConvexHull.hpp"
+#include "utils/BinaryIO.hpp"
 
 #ifdef _MSC_VER
 #define isnan(x) _isnan((x))
@@ -2428,5 +2429,38 @@ namespace OpenMD {
       rnemdFile_ << "\t" << s[0] << "\t" << s[1] << "\t" << s[2];
     }
   }  
-}
 
+  void RNEMD::saveState(std::ostream& os) {
+    if (!doRNEMD_) return;
+    writeBinary(os, kineticExchange_);
+    writeBinary(os, momentumExchange_);
+    writeBinary(os, angularMomentumExchange_);
+    writeBinary(os, trialCount_);
+    writeBinary(os, failTrialCount_);
+    writeBinary(os, failRootCount_);
+
+    for (unsigned int i = 0; i < data_.size(); i++) {
+      for (unsigned int bin = 0; bin < data_[i].accumulator.size(); bin++) {
+        data_[i].accumulator[bin]->saveState(os);
+      }
+    }
+    areaAccumulator_->saveState(os);
+  }
+
+  void RNEMD::loadState(std::istream& is) {
+    if (!doRNEMD_) return;
+    readBinary(is, kineticExchange_);
+    readBinary(is, momentumExchange_);
+    readBinary(is, angularMomentumExchange_);
+    readBinary(is, trialCount_);
+    readBinary(is, failTrialCount_);
+    readBinary(is, failRootCount_);
+
+    for (unsigned int i = 0; i < data_.size(); i++) {
+      for (unsigned int bin = 0; bin < data_[i].accumulator.size(); bin++) {
+        data_[i].accumulator[bin]->loadState(is);
+      }
+    }
+    areaAccumulator_->loadState(is);
+  }
+}
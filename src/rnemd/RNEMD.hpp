@@ -69,6 +69,10 @@ namespace OpenMD {
     void writeVector(int index, unsigned int bin);
     void writeRealErrorBars(int index, unsigned int bin);
     void writeVectorErrorBars(int index, unsigned int bin);
+    /** Writes the exchange totals and accumulated profiles */
+    void saveState(std::ostream& os);
+    /** Restores the state written by saveState */
+    void loadState(std::istream& is);
 
   private:
 
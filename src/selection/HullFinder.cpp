@@ -131,17 +131,15 @@ namespace OpenMD {
 
   AlphaHullFinder::AlphaHullFinder(SimInfo* info)
     : HullFinder(info) {
-    delete surfaceMesh_;
-    
 #ifdef HAVE_QHULL
+    delete surfaceMesh_;
     surfaceMesh_ = new AlphaHull(0.0);
 #endif
   }
 
   void AlphaHullFinder::setAlpha(RealType alpha) {
-    delete surfaceMesh_;
-    
 #ifdef HAVE_QHULL
+    delete surfaceMesh_;
     surfaceMesh_ = new AlphaHull(alpha);
 #endif
   }
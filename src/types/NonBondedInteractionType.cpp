@@ -60,6 +60,7 @@ namespace OpenMD {
     nbitp.is_RepulsivePower = false;
     nbitp.is_Mie = false;
     nbitp.is_Buckingham = false;
+    nbitp.is_Tabulated = false;
     atomTypes_.first = NULL;
     atomTypes_.second = NULL;
   }
@@ -172,4 +173,12 @@ namespace OpenMD {
     nbitp.is_Buckingham = true;
   }
 
+  bool NonBondedInteractionType::isTabulated() {
+    return nbitp.is_Tabulated;
+  }
+
+  void NonBondedInteractionType::setTabulated() {
+    nbitp.is_Tabulated = true;
+  }
+
 }
@@ -47,6 +47,7 @@
 #include <cassert>
 #include "math/Vector3.hpp"
 #include "nonbonded/NonBondedInteraction.hpp"
+#include "utils/BinaryIO.hpp"
 
 namespace OpenMD {
 
@@ -61,6 +62,11 @@ namespace OpenMD {
       return Count_;
     }
     virtual ~BaseAccumulator() {};
+
+    /** Writes the accumulated state so a run can be resumed */
+    virtual void saveState(std::ostream& os) = 0;
+    /** Restores the state written by saveState */
+    virtual void loadState(std::istream& is) = 0;
   protected:
     size_t Count_;
 
@@ -185,6 +191,24 @@ namespace OpenMD {
       return;
     }
 
+    void saveState(std::ostream& os) {
+      writeBinary(os, Count_);
+      writeBinary(os, Val_);
+      writeBinary(os, Avg_);
+      writeBinary(os, Avg2_);
+      writeBinary(os, Min_);
+      writeBinary(os, Max_);
+    }
+
+    void loadState(std::istream& is) {
+      readBinary(is, Count_);
+      readBinary(is, Val_);
+      readBinary(is, Avg_);
+      readBinary(is, Avg2_);
+      readBinary(is, Min_);
+      readBinary(is, Max_);
+    }
+
   private:
     ElementType Val_;
     ResultType Avg_;
@@ -367,6 +391,28 @@ namespace OpenMD {
     }
 
 
+    void saveState(std::ostream& os) {
+      writeBinary(os, Count_);
+      writeBinary(os, Val_);
+      writeBinary(os, Avg_);
+      writeBinary(os, Avg2_);
+      writeBinary(os, AvgLen_);
+      writeBinary(os, AvgLen2_);
+      writeBinary(os, Min_);
+      writeBinary(os, Max_);
+    }
+
+    void loadState(std::istream& is) {
+      readBinary(is, Count_);
+      readBinary(is, Val_);
+      readBinary(is, Avg_);
+      readBinary(is, Avg2_);
+      readBinary(is, AvgLen_);
+      readBinary(is, AvgLen2_);
+      readBinary(is, Min_);
+      readBinary(is, Max_);
+    }
+
   private:
     ResultType Val_;
     ResultType Avg_;
@@ -553,6 +599,28 @@ namespace OpenMD {
     }
 
 
+    void saveState(std::ostream& os) {
+      writeBinary(os, Count_);
+      writeBinary(os, Val_);
+      writeBinary(os, Avg_);
+      writeBinary(os, Avg2_);
+      writeBinary(os, AvgLen_);
+      writeBinary(os, AvgLen2_);
+      writeBinary(os, Min_);
+      writeBinary(os, Max_);
+    }
+
+    void loadState(std::istream& is) {
+      readBinary(is, Count_);
+      readBinary(is, Val_);
+      readBinary(is, Avg_);
+      readBinary(is, Avg2_);
+      readBinary(is, AvgLen_);
+      readBinary(is, AvgLen2_);
+      readBinary(is, Min_);
+      readBinary(is, Max_);
+    }
+
   private:
     ResultType Val_;
     ResultType Avg_;
@@ -666,6 +734,20 @@ namespace OpenMD {
       return;
     }
 
+    void saveState(std::ostream& os) {
+      writeBinary(os, Count_);
+      writeBinary(os, Val_);
+      writeBinary(os, Avg_);
+      writeBinary(os, Avg2_);
+    }
+
+    void loadState(std::istream& is) {
+      readBinary(is, Count_);
+      readBinary(is, Val_);
+      readBinary(is, Avg_);
+      readBinary(is, Avg2_);
+    }
+
   private:
     ElementType Val_;
     ResultType Avg_;
@@ -0,0 +1,101 @@
+/*
+ * Copyright (c) 2018 The University of Notre Dame. All Rights Reserved.
+ *
+ * The University of Notre Dame grants you ("Licensee") a
+ * non-exclusive, royalty free, license to use, modify and
+ * redistribute this software in source and binary code form, provided
+ * that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the
+ *    distribution.
+ *
+ * This software is provided "AS IS," without a warranty of any
+ * kind. All express or implied conditions, representations and
+ * warranties, including any implied warranty of merchantability,
+ * fitness for a particular purpose or non-infringement, are hereby
+ * excluded.  The University of Notre Dame and its licensors shall not
+ * be liable for any damages suffered by licensee as a result of
+ * using, modifying or distributing the software or its
+ * derivatives. In no event will the University of Notre Dame or its
+ * licensors be liable for any lost revenue, profit or data, or for
+ * direct, indirect, special, consequential, incidental or punitive
+ * damages, however caused and regardless of the theory of liability,
+ * arising out of the use of or inability to use software, even if the
+ * University of Notre Dame has been advised of the possibility of
+ * such damages.
+ *
+ * SUPPORT OPEN SCIENCE!  If you use OpenMD or its source code in your
+ * research, please cite the appropriate papers when you publish your
+ * work.  Good starting points are:
+ *                                                                      
+ * [1]  Meineke, et al., J. Comp. Chem. 26, 252-271 (2005).             
+ * [2]  Fennell & Gezelter, J. Chem. Phys. 124, 234104 (2006).          
+ * [3]  Sun, Lin & Gezelter, J. Chem. Phys. 128, 234107 (2008).          
+ * [4]  Kuang & Gezelter,  J. Chem. Phys. 133, 164101 (2010).
+ * [5]  Vardeman, Stocker & Gezelter, J. Chem. Theory Comput. 7, 834 (2011).
+ */
+
+/**
+ * @file BinaryIO.hpp
+ * Helpers for writing plain values in native binary form, as used
+ * by the checkpoint files.
+ */
+
+#ifndef UTILS_BINARYIO_HPP
+#define UTILS_BINARYIO_HPP
+
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace OpenMD {
+
+  /** Writes the bytes of a trivially copyable value */
+  template<typename T>
+  inline void writeBinary(std::ostream& os, const T& value) {
+    os.write(reinterpret_cast<const char*>(&value), sizeof(T));
+  }
+
+  /** Reads a value written by writeBinary */
+  template<typename T>
+  inline void readBinary(std::istream& is, T& value) {
+    is.read(reinterpret_cast<char*>(&value), sizeof(T));
+  }
+
+  /** Writes the length of a vector followed by its elements */
+  template<typename T>
+  inline void writeBinary(std::ostream& os, const std::vector<T>& v) {
+    unsigned long long n = v.size();
+    writeBinary(os, n);
+    if (n > 0) 
+      os.write(reinterpret_cast<const char*>(&v[0]), n * sizeof(T));
+  }
+
+  template<typename T>
+  inline void readBinary(std::istream& is, std::vector<T>& v) {
+    unsigned long long n = 0;
+    readBinary(is, n);
+    v.resize(n);
+    if (n > 0) 
+      is.read(reinterpret_cast<char*>(&v[0]), n * sizeof(T));
+  }
+
+  inline void writeBinary(std::ostream& os, const std::string& s) {
+    unsigned long long n = s.size();
+    writeBinary(os, n);
+    os.write(s.data(), n);
+  }
+
+  inline void readBinary(std::istream& is, std::string& s) {
+    unsigned long long n = 0;
+    readBinary(is, n);
+    s.resize(n);
+    if (n > 0) is.read(&s[0], n);
+  }
+}
+#endif
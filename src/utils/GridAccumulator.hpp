@@ -0,0 +1,132 @@
+/*
+ * Copyright (c) 2018 The University of Notre Dame. All Rights Reserved.
+ *
+ * The University of Notre Dame grants you ("Licensee") a
+ * non-exclusive, royalty free, license to use, modify and
+ * redistribute this software in source and binary code form, provided
+ * that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the
+ *    distribution.
+ *
+ * This software is provided "AS IS," without a warranty of any
+ * kind. All express or implied conditions, representations and
+ * warranties, including any implied warranty of merchantability,
+ * fitness for a particular purpose or non-infringement, are hereby
+ * excluded.  The University of Notre Dame and its licensors shall not
+ * be liable for any damages suffered by licensee as a result of
+ * using, modifying or distributing the software or its
+ * derivatives. In no event will the University of Notre Dame or its
+ * licensors be liable for any lost revenue, profit or data, or for
+ * direct, indirect, special, consequential, incidental or punitive
+ * damages, however caused and regardless of the theory of liability,
+ * arising out of the use of or inability to use software, even if the
+ * University of Notre Dame has been advised of the possibility of
+ * such damages.
+ *
+ * SUPPORT OPEN SCIENCE!  If you use OpenMD or its source code in your
+ * research, please cite the appropriate papers when you publish your
+ * work.  Good starting points are:
+ *                                                                      
+ * [1]  Meineke, et al., J. Comp. Chem. 26, 252-271 (2005).             
+ * [2]  Fennell & Gezelter, J. Chem. Phys. 124, 234104 (2006).          
+ * [3]  Sun, Lin & Gezelter, J. Chem. Phys. 128, 234107 (2008).          
+ * [4]  Kuang & Gezelter,  J. Chem. Phys. 133, 164101 (2010).
+ * [5]  Vardeman, Stocker & Gezelter, J. Chem. Theory Comput. 7, 834 (2011).
+ */
+ 
+#ifndef UTILS_GRIDACCUMULATOR_HPP
+#define UTILS_GRIDACCUMULATOR_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+namespace OpenMD {
+
+  /**
+   * @class GridAccumulator
+   * @brief A 3d grid that many threads can add into at once.
+   *
+   * Every element is an atomic, so concurrent add() calls into the
+   * same cell are safe without keeping a private copy of the grid
+   * for each thread.  This keeps the memory footprint of very large
+   * grids at a single copy.  parallelFor() hands out work items to
+   * the threads in an interleaved order, which also balances
+   * triangular pair loops.
+   */
+  template<class Elem>
+  class GridAccumulator {
+  public:
+    GridAccumulator(unsigned int dim1, unsigned int dim2, unsigned int dim3)
+      : dim1_(dim1), dim2_(dim2), dim3_(dim3), data_(dim1 * dim2 * dim3) {
+      nThreads_ = std::max(1u, std::thread::hardware_concurrency());
+      clear();
+    }
+
+    unsigned int getDim1() const { return dim1_; }
+    unsigned int getDim2() const { return dim2_; }
+    unsigned int getDim3() const { return dim3_; }
+    unsigned int getNThreads() const { return nThreads_; }
+    void setNThreads(unsigned int nThreads) { 
+      nThreads_ = std::max(1u, nThreads);
+    }
+
+    void clear() {
+      for (size_t i = 0; i < data_.size(); i++)
+        data_[i].store(Elem(0), std::memory_order_relaxed);
+    }
+
+    size_t getIndex(unsigned int i, unsigned int j, unsigned int k) const {
+      return (size_t(i) * dim2_ + j) * dim3_ + k;
+    }
+
+    /** Thread-safe accumulation into cell (i, j, k) */
+    void add(unsigned int i, unsigned int j, unsigned int k, Elem value) {
+      std::atomic<Elem>& cell = data_[getIndex(i, j, k)];
+      Elem old = cell.load(std::memory_order_relaxed);
+      while (!cell.compare_exchange_weak(old, old + value,
+                                         std::memory_order_relaxed)) {}
+    }
+
+    /** Reads cell (i, j, k); only meaningful once the adds are done */
+    Elem operator ()(unsigned int i, unsigned int j, unsigned int k) const {
+      return data_[getIndex(i, j, k)].load(std::memory_order_relaxed);
+    }
+
+    /**
+     * Calls f(n) for every n in [0, nItems), spread over the worker
+     * threads.  Thread t handles items t, t + nThreads, ...
+     */
+    template<class Function>
+    void parallelFor(int nItems, Function f) const {
+      int nThreads = std::min(int(nThreads_), nItems);
+      if (nThreads <= 1) {
+        for (int n = 0; n < nItems; n++) f(n);
+        return;
+      }
+      std::vector<std::thread> workers;
+      for (int t = 1; t < nThreads; t++) {
+        workers.push_back(std::thread([=, &f]() {
+              for (int n = t; n < nItems; n += nThreads) f(n);
+            }));
+      }
+      for (int n = 0; n < nItems; n += nThreads) f(n);
+      for (unsigned int t = 0; t < workers.size(); t++) workers[t].join();
+    }
+
+  private:
+    unsigned int dim1_;
+    unsigned int dim2_;
+    unsigned int dim3_;
+    unsigned int nThreads_;
+    std::vector<std::atomic<Elem> > data_;
+  };
+}
+#endif
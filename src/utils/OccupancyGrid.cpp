@@ -0,0 +1,164 @@
+/*
+ * Copyright (c) 2018 The University of Notre Dame. All Rights Reserved.
+ *
+ * The University of Notre Dame grants you ("Licensee") a
+ * non-exclusive, royalty free, license to use, modify and
+ * redistribute this software in source and binary code form, provided
+ * that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the
+ *    distribution.
+ *
+ * This software is provided "AS IS," without a warranty of any
+ * kind. All express or implied conditions, representations and
+ * warranties, including any implied warranty of merchantability,
+ * fitness for a particular purpose or non-infringement, are hereby
+ * excluded.  The University of Notre Dame and its licensors shall not
+ * be liable for any damages suffered by licensee as a result of
+ * using, modifying or distributing the software or its
+ * derivatives. In no event will the University of Notre Dame or its
+ * licensors be liable for any lost revenue, profit or data, or for
+ * direct, indirect, special, consequential, incidental or punitive
+ * damages, however caused and regardless of the theory of liability,
+ * arising out of the use of or inability to use software, even if the
+ * University of Notre Dame has been advised of the possibility of
+ * such damages.
+ *
+ * SUPPORT OPEN SCIENCE!  If you use OpenMD or its source code in your
+ * research, please cite the appropriate papers when you publish your
+ * work.  Good starting points are:
+ *                                                                      
+ * [1]  Meineke, et al., J. Comp. Chem. 26, 252-271 (2005).             
+ * [2]  Fennell & Gezelter, J. Chem. Phys. 124, 234104 (2006).          
+ * [3]  Sun, Lin & Gezelter, J. Chem. Phys. 128, 234107 (2008).          
+ * [4]  Kuang & Gezelter,  J. Chem. Phys. 133, 164101 (2010).
+ * [5]  Vardeman, Stocker & Gezelter, J. Chem. Theory Comput. 7, 834 (2011).
+ */
+ 
+#include <cmath>
+#include <algorithm>
+#include "utils/OccupancyGrid.hpp"
+#include "utils/Utility.hpp"
+#include "utils/simError.h"
+
+namespace OpenMD {
+
+  OccupancyGrid::OccupancyGrid(const Mat3x3d& hmat, RealType rcut) : 
+    hmat_(hmat), rcutSq_(rcut * rcut), built_(false) {
+
+    invHmat_ = hmat_.inverse();
+
+    // the width of the box perpendicular to each pair of box vectors
+    // decides how many rcut-wide cells fit along that direction:
+    RealType volume = std::fabs(hmat_.determinant());
+    Vector3d a = hmat_.getColumn(0);
+    Vector3d b = hmat_.getColumn(1);
+    Vector3d c = hmat_.getColumn(2);
+    Vector3d widths(volume / cross(b, c).length(),
+                    volume / cross(c, a).length(),
+                    volume / cross(a, b).length());
+
+    for (int i = 0; i < 3; i++) {
+      if (2.0 * rcut > widths[i]) {
+        sprintf(painCave.errMsg, 
+                "OccupancyGrid: the cutoff (%f) is larger than half of the\n"
+                "\tbox width (%f).\n", rcut, widths[i]);
+        painCave.isFatal = 1;
+        simError();
+      }
+      maxCells_[i] = std::max(RealType(1.0), std::floor(widths[i] / rcut));
+    }
+  }
+
+  void OccupancyGrid::buildCells() {
+    // cells may be wider than rcut, so the grid is coarsened until
+    // there are no more cells than points:
+    RealType nMax = std::max(std::size_t(1), points_.size());
+    RealType nTotal = maxCells_.x() * maxCells_.y() * maxCells_.z();
+    RealType scale = (nTotal > nMax) ? std::pow(nMax / nTotal, 1.0 / 3.0) 
+      : 1.0;
+
+    for (int i = 0; i < 3; i++) {
+      nCells_[i] = std::max(1, int(maxCells_[i] * scale));
+
+      // with fewer than three cells the neighbors wrap onto each other,
+      // so each distinct cell is only visited once:
+      offsets_[i].clear();
+      offsets_[i].push_back(0);
+      if (nCells_[i] > 1) offsets_[i].push_back(1);
+      if (nCells_[i] > 2) offsets_[i].push_back(-1);
+    }
+
+    // counting sort of the points by cell:
+    int nPoints = points_.size();
+    std::vector<int> cellOf(nPoints);
+    Vector3i cell;
+    cellStart_.assign(nCells_.x() * nCells_.y() * nCells_.z() + 1, 0);
+    for (int p = 0; p < nPoints; p++) {
+      cellOf[p] = getCellIndex(points_[p], cell);
+      cellStart_[cellOf[p] + 1]++;
+    }
+    for (std::size_t c = 1; c < cellStart_.size(); c++)
+      cellStart_[c] += cellStart_[c - 1];
+
+    std::vector<int> next(cellStart_.begin(), cellStart_.end() - 1);
+    cellPoints_.resize(nPoints);
+    for (int p = 0; p < nPoints; p++)
+      cellPoints_[next[cellOf[p]]++] = p;
+
+    built_ = true;
+  }
+
+  int OccupancyGrid::getCellIndex(const Vector3d& pos, Vector3i& cell) {
+    Vector3d scaled = invHmat_ * pos;
+    for (int i = 0; i < 3; i++) {
+      scaled[i] -= std::floor(scaled[i]);
+      cell[i] = int(scaled[i] * nCells_[i]);
+      if (cell[i] >= nCells_[i]) cell[i] -= nCells_[i];
+    }
+    return (cell.z() * nCells_.y() + cell.y()) * nCells_.x() + cell.x();
+  }
+
+  Vector3d OccupancyGrid::minimumImage(const Vector3d& d) {
+    Vector3d scaled = invHmat_ * d;
+    for (int i = 0; i < 3; i++) {
+      scaled[i] -= roundMe(scaled[i]);
+    }
+    return hmat_ * scaled;
+  }
+
+  void OccupancyGrid::addPoint(const Vector3d& pos) {
+    points_.push_back(pos);
+    built_ = false;
+  }
+
+  bool OccupancyGrid::isOccupied(const Vector3d& pos) {
+    if (!built_) buildCells();
+
+    Vector3i cell;
+    getCellIndex(pos, cell);
+
+    for (std::size_t i = 0; i < offsets_[0].size(); i++) {
+      int cx = (cell.x() + offsets_[0][i] + nCells_.x()) % nCells_.x();
+      for (std::size_t j = 0; j < offsets_[1].size(); j++) {
+        int cy = (cell.y() + offsets_[1][j] + nCells_.y()) % nCells_.y();
+        for (std::size_t k = 0; k < offsets_[2].size(); k++) {
+          int cz = (cell.z() + offsets_[2][k] + nCells_.z()) % nCells_.z();
+          
+          int c = (cz * nCells_.y() + cy) * nCells_.x() + cx;
+          for (int p = cellStart_[c]; p < cellStart_[c + 1]; p++) {
+            Vector3d d = minimumImage(points_[cellPoints_[p]] - pos);
+            if (d.lengthSquare() < rcutSq_) return true;
+          }
+        }
+      }
+    }
+    return false;
+  }
+
+}
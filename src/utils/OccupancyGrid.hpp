@@ -0,0 +1,100 @@
+/*
+ * Copyright (c) 2018 The University of Notre Dame. All Rights Reserved.
+ *
+ * The University of Notre Dame grants you ("Licensee") a
+ * non-exclusive, royalty free, license to use, modify and
+ * redistribute this software in source and binary code form, provided
+ * that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the
+ *    distribution.
+ *
+ * This software is provided "AS IS," without a warranty of any
+ * kind. All express or implied conditions, representations and
+ * warranties, including any implied warranty of merchantability,
+ * fitness for a particular purpose or non-infringement, are hereby
+ * excluded.  The University of Notre Dame and its licensors shall not
+ * be liable for any damages suffered by licensee as a result of
+ * using, modifying or distributing the software or its
+ * derivatives. In no event will the University of Notre Dame or its
+ * licensors be liable for any lost revenue, profit or data, or for
+ * direct, indirect, special, consequential, incidental or punitive
+ * damages, however caused and regardless of the theory of liability,
+ * arising out of the use of or inability to use software, even if the
+ * University of Notre Dame has been advised of the possibility of
+ * such damages.
+ *
+ * SUPPORT OPEN SCIENCE!  If you use OpenMD or its source code in your
+ * research, please cite the appropriate papers when you publish your
+ * work.  Good starting points are:
+ *                                                                      
+ * [1]  Meineke, et al., J. Comp. Chem. 26, 252-271 (2005).             
+ * [2]  Fennell & Gezelter, J. Chem. Phys. 124, 234104 (2006).          
+ * [3]  Sun, Lin & Gezelter, J. Chem. Phys. 128, 234107 (2008).          
+ * [4]  Kuang & Gezelter,  J. Chem. Phys. 133, 164101 (2010).
+ * [5]  Vardeman, Stocker & Gezelter, J. Chem. Theory Comput. 7, 834 (2011).
+ */
+ 
+#ifndef UTILS_OCCUPANCYGRID_HPP
+#define UTILS_OCCUPANCYGRID_HPP
+
+#include <vector>
+#include "math/Vector3.hpp"
+#include "math/SquareMatrix3.hpp"
+
+namespace OpenMD {
+
+  /**
+   * @class OccupancyGrid
+   * @brief A periodic cell hash for overlap tests against a fixed set
+   * of points.
+   *
+   * The box is divided into cells that are at least rcut wide in
+   * every direction, so a point can only overlap with the points
+   * stored in its own and the 26 neighboring cells.  Both building
+   * the grid and each isOccupied query are therefore independent of
+   * the number of stored points.  The cells are built, in compressed
+   * sparse row form, the first time the grid is queried after points
+   * were added.  There are never more cells than stored points, so a
+   * small rcut in a large box widens the cells instead of allocating
+   * a mostly empty grid.
+   */
+  class OccupancyGrid {
+  public:
+    OccupancyGrid(const Mat3x3d& hmat, RealType rcut);
+
+    void addPoint(const Vector3d& pos);
+
+    /** Returns true if a stored point lies within rcut of pos */
+    bool isOccupied(const Vector3d& pos);
+
+    int getNPoints() { return points_.size(); }
+    Vector3i getNCells() { 
+      if (!built_) buildCells();
+      return nCells_; 
+    }
+
+  private:
+    void buildCells();
+    int getCellIndex(const Vector3d& pos, Vector3i& cell);
+    Vector3d minimumImage(const Vector3d& d);
+
+    Mat3x3d hmat_;
+    Mat3x3d invHmat_;
+    RealType rcutSq_;
+    Vector3d maxCells_;     /**< rcut-wide cells that fit along each axis */
+    Vector3i nCells_;
+    bool built_;
+    std::vector<Vector3d> points_;
+    std::vector<int> cellStart_;   /**< CSR offsets into cellPoints_ */
+    std::vector<int> cellPoints_;
+    std::vector<int> offsets_[3];
+  };
+
+}
+#endif
@@ -0,0 +1,232 @@
+/*
+ * Copyright (c) 2018 The University of Notre Dame. All Rights Reserved.
+ *
+ * The University of Notre Dame grants you ("Licensee") a
+ * non-exclusive, royalty free, license to use, modify and
+ * redistribute this software in source and binary code form, provided
+ * that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the
+ *    distribution.
+ *
+ * This software is provided "AS IS," without a warranty of any
+ * kind. All express or implied conditions, representations and
+ * warranties, including any implied warranty of merchantability,
+ * fitness for a particular purpose or non-infringement, are hereby
+ * excluded.  The University of Notre Dame and its licensors shall not
+ * be liable for any damages suffered by licensee as a result of
+ * using, modifying or distributing the software or its
+ * derivatives. In no event will the University of Notre Dame or its
+ * licensors be liable for any lost revenue, profit or data, or for
+ * direct, indirect, special, consequential, incidental or punitive
+ * damages, however caused and regardless of the theory of liability,
+ * arising out of the use of or inability to use software, even if the
+ * University of Notre Dame has been advised of the possibility of
+ * such damages.
+ *
+ * SUPPORT OPEN SCIENCE!  If you use OpenMD or its source code in your
+ * research, please cite the appropriate papers when you publish your
+ * work.  Good starting points are:
+ *                                                                      
+ * [1]  Meineke, et al., J. Comp. Chem. 26, 252-271 (2005).             
+ * [2]  Fennell & Gezelter, J. Chem. Phys. 124, 234104 (2006).          
+ * [3]  Sun, Lin & Gezelter, J. Chem. Phys. 128, 234107 (2008).          
+ * [4]  Kuang & Gezelter,  J. Chem. Phys. 133, 164101 (2010).
+ * [5]  Vardeman, Stocker & Gezelter, J. Chem. Theory Comput. 7, 834 (2011).
+ */
+
+#include "config.h"
+
+#ifdef IS_MPI
+#include <mpi.h>
+#endif
+
+#include <cstdio>
+#include <cstring>
+#include <sstream>
+
+#ifdef HAVE_LINUX_PERF_EVENT_H
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#include "utils/PerformanceCounters.hpp"
+#include "utils/StringTokenizer.hpp"
+#include "utils/simError.h"
+
+namespace OpenMD {
+
+  PerformanceCounters* PerformanceCounters::instance_ = NULL;
+
+  PerformanceCounters::PerformanceCounters() : enabled_(false),
+                                               commBytes_(0),
+                                               hardwareTried_(false),
+                                               hardwareAvailable_(false),
+                                               cyclesFD_(-1),
+                                               cacheMissesFD_(-1) {}
+
+  int PerformanceCounters::getCounterID(const std::string& name) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    std::map<std::string, int>::iterator i = counterMap_.find(name);
+    if (i != counterMap_.end()) return i->second;
+
+    Counter c;
+    c.name = name;
+    c.value = 0;
+    counters_.push_back(c);
+
+    int id = counters_.size() - 1;
+    counterMap_[name] = id;
+    return id;
+  }
+
+  long long PerformanceCounters::getValue(const std::string& name) {
+    std::map<std::string, int>::iterator i = counterMap_.find(name);
+    if (i == counterMap_.end()) return 0;
+    return counters_[i->second].value;
+  }
+
+#ifdef HAVE_LINUX_PERF_EVENT_H
+  static int openPerfEvent(unsigned int type, unsigned long long config) {
+    struct perf_event_attr attr;
+    memset(&attr, 0, sizeof(attr));
+    attr.type = type;
+    attr.size = sizeof(attr);
+    attr.config = config;
+    attr.disabled = 1;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    // this process, any cpu, no group leader:
+    return syscall(__NR_perf_event_open, &attr, 0, -1, -1, 0);
+  }
+#endif
+
+  bool PerformanceCounters::openHardwareCounters() {
+#ifdef HAVE_LINUX_PERF_EVENT_H
+    cyclesFD_ = openPerfEvent(PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES);
+    cacheMissesFD_ = openPerfEvent(PERF_TYPE_HARDWARE,
+                                   PERF_COUNT_HW_CACHE_MISSES);
+    if (cyclesFD_ >= 0 && cacheMissesFD_ >= 0) return true;
+
+    if (cyclesFD_ >= 0) close(cyclesFD_);
+    if (cacheMissesFD_ >= 0) close(cacheMissesFD_);
+    cyclesFD_ = cacheMissesFD_ = -1;
+    sprintf(painCave.errMsg,
+            "PerformanceCounters: perf_event_open was refused, so the\n"
+            "\tcycle and cache miss counters will not be reported.\n"
+            "\t(Check /proc/sys/kernel/perf_event_paranoid.)\n");
+#else
+    sprintf(painCave.errMsg,
+            "PerformanceCounters: hardware counters are not supported on\n"
+            "\tthis platform; only the event counts will be reported.\n");
+#endif
+    painCave.isFatal = 0;
+    painCave.severity = OPENMD_INFO;
+    simError();
+    return false;
+  }
+
+  void PerformanceCounters::startHardwareCounters() {
+    if (!enabled_) return;
+    if (!hardwareTried_) {
+      hardwareTried_ = true;
+      hardwareAvailable_ = openHardwareCounters();
+    }
+#ifdef HAVE_LINUX_PERF_EVENT_H
+    if (!hardwareAvailable_) return;
+    ioctl(cyclesFD_, PERF_EVENT_IOC_RESET, 0);
+    ioctl(cacheMissesFD_, PERF_EVENT_IOC_RESET, 0);
+    ioctl(cyclesFD_, PERF_EVENT_IOC_ENABLE, 0);
+    ioctl(cacheMissesFD_, PERF_EVENT_IOC_ENABLE, 0);
+#endif
+  }
+
+  void PerformanceCounters::stopHardwareCounters(const std::string& prefix) {
+#ifdef HAVE_LINUX_PERF_EVENT_H
+    if (!enabled_ || !hardwareAvailable_) return;
+    ioctl(cyclesFD_, PERF_EVENT_IOC_DISABLE, 0);
+    ioctl(cacheMissesFD_, PERF_EVENT_IOC_DISABLE, 0);
+
+    long long cycles(0), misses(0);
+    if (read(cyclesFD_, &cycles, sizeof(cycles)) != sizeof(cycles))
+      cycles = 0;
+    if (read(cacheMissesFD_, &misses, sizeof(misses)) != sizeof(misses))
+      misses = 0;
+    add(getCounterID(prefix + "/Cycles"), cycles);
+    add(getCounterID(prefix + "/CacheMisses"), misses);
+#endif
+  }
+
+  std::string PerformanceCounters::getJSON(double wallTime) {
+    std::vector<std::string> names;
+    int nRanks = 1;
+
+#ifdef IS_MPI
+    // As with the timing report, the primary rank decides which
+    // counters are reported and the other ranks add to the same names.
+    int myRank;
+    MPI_Comm_rank(MPI_COMM_WORLD, &myRank);
+    MPI_Comm_size(MPI_COMM_WORLD, &nRanks);
+
+    std::string nameList;
+    if (myRank == 0) {
+      for (unsigned int i = 0; i < counters_.size(); i++)
+        nameList += counters_[i].name + "\n";
+    }
+    int nameLength = nameList.size();
+    MPI_Bcast(&nameLength, 1, MPI_INT, 0, MPI_COMM_WORLD);
+    std::vector<char> buffer(nameList.begin(), nameList.end());
+    buffer.resize(nameLength);
+    if (nameLength > 0)
+      MPI_Bcast(&buffer[0], nameLength, MPI_CHAR, 0, MPI_COMM_WORLD);
+    StringTokenizer tokenizer(std::string(buffer.begin(), buffer.end()),
+                              "\n");
+    while (tokenizer.hasMoreTokens()) names.push_back(tokenizer.nextToken());
+#else
+    for (unsigned int i = 0; i < counters_.size(); i++)
+      names.push_back(counters_[i].name);
+#endif
+
+    int nCounters = names.size();
+    std::vector<long long> sum(nCounters), minVal(nCounters),
+      maxVal(nCounters);
+    for (int i = 0; i < nCounters; i++)
+      sum[i] = minVal[i] = maxVal[i] = getValue(names[i]);
+
+#ifdef IS_MPI
+    if (nCounters > 0) {
+      std::vector<long long> local(sum);
+      MPI_Reduce(&local[0], &sum[0], nCounters, MPI_LONG_LONG, MPI_SUM, 0,
+                 MPI_COMM_WORLD);
+      MPI_Reduce(&local[0], &minVal[0], nCounters, MPI_LONG_LONG, MPI_MIN, 0,
+                 MPI_COMM_WORLD);
+      MPI_Reduce(&local[0], &maxVal[0], nCounters, MPI_LONG_LONG, MPI_MAX, 0,
+                 MPI_COMM_WORLD);
+    }
+    if (myRank != 0) return std::string();
+#endif
+
+    std::ostringstream json;
+    json << "{\n";
+    json << "  \"nRanks\": " << nRanks << ",\n";
+    json << "  \"wallTime\": " << wallTime << ",\n";
+    json << "  \"hardwareCounters\": "
+         << (hardwareAvailable_ ? "true" : "false") << ",\n";
+    json << "  \"counters\": {";
+    for (int i = 0; i < nCounters; i++) {
+      json << (i == 0 ? "\n" : ",\n");
+      json << "    \"" << names[i] << "\": {\"sum\": " << sum[i]
+           << ", \"min\": " << minVal[i] << ", \"max\": " << maxVal[i] << "}";
+    }
+    json << "\n  }\n";
+    json << "}\n";
+    return json.str();
+  }
+}
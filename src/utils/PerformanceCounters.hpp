@@ -0,0 +1,138 @@
+/*
+ * Copyright (c) 2018 The University of Notre Dame. All Rights Reserved.
+ *
+ * The University of Notre Dame grants you ("Licensee") a
+ * non-exclusive, royalty free, license to use, modify and
+ * redistribute this software in source and binary code form, provided
+ * that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the
+ *    distribution.
+ *
+ * This software is provided "AS IS," without a warranty of any
+ * kind. All express or implied conditions, representations and
+ * warranties, including any implied warranty of merchantability,
+ * fitness for a particular purpose or non-infringement, are hereby
+ * excluded.  The University of Notre Dame and its licensors shall not
+ * be liable for any damages suffered by licensee as a result of
+ * using, modifying or distributing the software or its
+ * derivatives. In no event will the University of Notre Dame or its
+ * licensors be liable for any lost revenue, profit or data, or for
+ * direct, indirect, special, consequential, incidental or punitive
+ * damages, however caused and regardless of the theory of liability,
+ * arising out of the use of or inability to use software, even if the
+ * University of Notre Dame has been advised of the possibility of
+ * such damages.
+ *
+ * SUPPORT OPEN SCIENCE!  If you use OpenMD or its source code in your
+ * research, please cite the appropriate papers when you publish your
+ * work.  Good starting points are:
+ *                                                                      
+ * [1]  Meineke, et al., J. Comp. Chem. 26, 252-271 (2005).             
+ * [2]  Fennell & Gezelter, J. Chem. Phys. 124, 234104 (2006).          
+ * [3]  Sun, Lin & Gezelter, J. Chem. Phys. 128, 234107 (2008).          
+ * [4]  Kuang & Gezelter,  J. Chem. Phys. 133, 164101 (2010).
+ * [5]  Vardeman, Stocker & Gezelter, J. Chem. Theory Comput. 7, 834 (2011).
+ */
+ 
+#ifndef UTILS_PERFORMANCECOUNTERS_HPP
+#define UTILS_PERFORMANCECOUNTERS_HPP
+
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "config.h"
+
+namespace OpenMD {
+
+  /**
+   * @class PerformanceCounters
+   * @brief Named event counters for performance regression tracking.
+   *
+   * The counters record how much work the force loop actually does
+   * (pairs visited against pairs inside the cutoff, neighbor list
+   * rebuilds, bytes communicated).  They are only updated when the
+   * instrumentation has been switched on with the
+   * performanceCounters keyword:
+   *
+   * @code
+   *   PerformanceCounters* counters = PerformanceCounters::getInstance();
+   *   static int pairs = counters->getCounterID("PairLoop/GroupPairs");
+   *   if (counters->isEnabled()) counters->add(pairs, nPairs);
+   * @endcode
+   *
+   * On Linux, the hardware cycle and cache miss counters can also be
+   * read around a region of code through perf_event_open.  If the
+   * kernel refuses access (as it often does inside containers), the
+   * hardware counters are left out of the report.
+   */
+  class PerformanceCounters {
+  public:
+    static PerformanceCounters* getInstance() {
+      if (instance_ == NULL) {
+        instance_ = new PerformanceCounters();
+      }
+      return instance_;
+    }
+
+    bool isEnabled() { return enabled_; }
+    void setEnabled(bool enabled) { enabled_ = enabled; }
+
+    /** Returns the identifier of the named counter, creating it if needed */
+    int getCounterID(const std::string& name);
+
+    void add(int id, long long n) { counters_[id].value += n; }
+
+    /** Current value of the named counter on this rank (0 if unknown) */
+    long long getValue(const std::string& name);
+
+    /**
+     * Bytes moved by the parallel communication plans.  This running
+     * total is kept even when the instrumentation is off; callers take
+     * differences around the phase they want to attribute.
+     */
+    void addCommBytes(long long n) { commBytes_ += n; }
+    long long getCommBytes() { return commBytes_; }
+
+    /** Starts the hardware counters (no-op when unavailable or disabled) */
+    void startHardwareCounters();
+    /** Stops the hardware counters and adds them to the prefix counters */
+    void stopHardwareCounters(const std::string& prefix);
+
+    /**
+     * Builds the JSON report.  In parallel runs this is a collective
+     * call; every counter is reported as the sum, minimum and maximum
+     * over the ranks, and only the primary rank gets the text.
+     */
+    std::string getJSON(double wallTime);
+
+  private:
+    struct Counter {
+      std::string name;
+      long long value;
+    };
+
+    PerformanceCounters();
+    bool openHardwareCounters();
+
+    static PerformanceCounters* instance_;
+    bool enabled_;
+    std::mutex mutex_;
+    std::vector<Counter> counters_;
+    std::map<std::string, int> counterMap_;
+    long long commBytes_;
+
+    bool hardwareTried_;
+    bool hardwareAvailable_;
+    int cyclesFD_;
+    int cacheMissesFD_;
+  };
+}
+#endif
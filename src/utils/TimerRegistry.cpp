@@ -0,0 +1,192 @@
+/*
+ * Copyright (c) 2018 The University of Notre Dame. All Rights Reserved.
+ *
+ * The University of Notre Dame grants you ("Licensee") a
+ * non-exclusive, royalty free, license to use, modify and
+ * redistribute this software in source and binary code form, provided
+ * that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the
+ *    distribution.
+ *
+ * This software is provided "AS IS," without a warranty of any
+ * kind. All express or implied conditions, representations and
+ * warranties, including any implied warranty of merchantability,
+ * fitness for a particular purpose or non-infringement, are hereby
+ * excluded.  The University of Notre Dame and its licensors shall not
+ * be liable for any damages suffered by licensee as a result of
+ * using, modifying or distributing the software or its
+ * derivatives. In no event will the University of Notre Dame or its
+ * licensors be liable for any lost revenue, profit or data, or for
+ * direct, indirect, special, consequential, incidental or punitive
+ * damages, however caused and regardless of the theory of liability,
+ * arising out of the use of or inability to use software, even if the
+ * University of Notre Dame has been advised of the possibility of
+ * such damages.
+ *
+ * SUPPORT OPEN SCIENCE!  If you use OpenMD or its source code in your
+ * research, please cite the appropriate papers when you publish your
+ * work.  Good starting points are:
+ *                                                                      
+ * [1]  Meineke, et al., J. Comp. Chem. 26, 252-271 (2005).             
+ * [2]  Fennell & Gezelter, J. Chem. Phys. 124, 234104 (2006).          
+ * [3]  Sun, Lin & Gezelter, J. Chem. Phys. 128, 234107 (2008).          
+ * [4]  Kuang & Gezelter,  J. Chem. Phys. 133, 164101 (2010).
+ * [5]  Vardeman, Stocker & Gezelter, J. Chem. Theory Comput. 7, 834 (2011).
+ */
+
+#ifdef IS_MPI
+#include <mpi.h>
+#endif
+
+#include <cstdio>
+#include <sstream>
+
+#include "utils/TimerRegistry.hpp"
+#include "utils/StringTokenizer.hpp"
+
+namespace OpenMD {
+
+  TimerRegistry* TimerRegistry::instance_ = NULL;
+
+  TimerRegistry::TimerRegistry() : enabled_(true), created_(Clock::now()) {}
+
+  int TimerRegistry::getTimerID(const std::string& name) {
+    std::lock_guard<std::recursive_mutex> lock(mutex_);
+    std::map<std::string, int>::iterator i = timerMap_.find(name);
+    if (i != timerMap_.end()) return i->second;
+
+    int parent = -1;
+    int depth = 0;
+    std::string::size_type slash = name.rfind('/');
+    if (slash != std::string::npos) {
+      parent = getTimerID(name.substr(0, slash));
+      depth = timers_[parent].depth + 1;
+    }
+
+    Timer t;
+    t.name = name;
+    t.parent = parent;
+    t.depth = depth;
+    t.total = 0.0;
+    t.calls = 0;
+    timers_.push_back(t);
+    
+    int id = timers_.size() - 1;
+    timerMap_[name] = id;
+    return id;
+  }
+
+  double TimerRegistry::getTime(const std::string& name) {
+    std::map<std::string, int>::iterator i = timerMap_.find(name);
+    if (i == timerMap_.end()) return 0.0;
+    return timers_[i->second].total;
+  }
+
+  std::string TimerRegistry::getReport() {
+    double wallTime = getWallTime();
+    std::vector<std::string> names;
+
+#ifdef IS_MPI
+    // The primary rank decides which timers are reported; the other
+    // ranks contribute their times for the same names.
+    int myRank;
+    MPI_Comm_rank(MPI_COMM_WORLD, &myRank);
+    int nRanks;
+    MPI_Comm_size(MPI_COMM_WORLD, &nRanks);
+
+    std::string nameList;
+    if (myRank == 0) {
+      for (unsigned int i = 0; i < timers_.size(); i++) 
+        nameList += timers_[i].name + "\n";
+    }
+    int nameLength = nameList.size();
+    MPI_Bcast(&nameLength, 1, MPI_INT, 0, MPI_COMM_WORLD);
+    std::vector<char> buffer(nameList.begin(), nameList.end());
+    buffer.resize(nameLength);
+    if (nameLength > 0)
+      MPI_Bcast(&buffer[0], nameLength, MPI_CHAR, 0, MPI_COMM_WORLD);
+    StringTokenizer tokenizer(std::string(buffer.begin(), buffer.end()), 
+                              "\n");
+    while (tokenizer.hasMoreTokens()) names.push_back(tokenizer.nextToken());
+#else
+    for (unsigned int i = 0; i < timers_.size(); i++) 
+      names.push_back(timers_[i].name);
+#endif
+
+    int nTimers = names.size();
+    std::vector<double> minTime(nTimers), avgTime(nTimers), maxTime(nTimers);
+    for (int i = 0; i < nTimers; i++) 
+      minTime[i] = avgTime[i] = maxTime[i] = getTime(names[i]);
+
+#ifdef IS_MPI
+    if (nTimers > 0) {
+      std::vector<double> local(minTime);
+      MPI_Reduce(&local[0], &minTime[0], nTimers, MPI_DOUBLE, MPI_MIN, 0, 
+                 MPI_COMM_WORLD);
+      MPI_Reduce(&local[0], &maxTime[0], nTimers, MPI_DOUBLE, MPI_MAX, 0, 
+                 MPI_COMM_WORLD);
+      MPI_Reduce(&local[0], &avgTime[0], nTimers, MPI_DOUBLE, MPI_SUM, 0, 
+                 MPI_COMM_WORLD);
+      for (int i = 0; i < nTimers; i++) avgTime[i] /= nRanks;
+    }
+    if (myRank != 0) return std::string();
+#endif
+
+    // Build the tree from rank 0's view of the timers (the names were
+    // all registered there, so getTimerID just finds them):
+    std::vector<std::vector<int> > children(nTimers);
+    std::vector<int> roots;
+    for (int i = 0; i < nTimers; i++) {
+      int id = getTimerID(names[i]);
+      if (timers_[id].parent < 0) 
+        roots.push_back(id);
+      else
+        children[timers_[id].parent].push_back(id);
+    }
+
+    std::string report;
+    char line[256];
+    sprintf(line, "Timing report (wall clock seconds, %.3f s total)\n",
+            wallTime);
+    report += line;
+    sprintf(line, "%-36s %10s %12s %12s %12s %7s %7s\n", "phase", "calls", 
+            "min", "avg", "max", "%run", "imbal%");
+    report += line;
+    for (unsigned int r = 0; r < roots.size(); r++)
+      appendReport(report, roots[r], children, minTime, avgTime, maxTime,
+                   wallTime);
+    return report;
+  }
+
+  void TimerRegistry::appendReport(std::string& report, int id,
+                                   const std::vector<std::vector<int> >& children,
+                                   const std::vector<double>& minTime,
+                                   const std::vector<double>& avgTime,
+                                   const std::vector<double>& maxTime,
+                                   double wallTime) {
+    const Timer& t = timers_[id];
+    std::string label(2 * t.depth, ' ');
+    std::string::size_type slash = t.name.rfind('/');
+    label += (slash == std::string::npos) ? t.name : t.name.substr(slash + 1);
+
+    double percent = wallTime > 0.0 ? 100.0 * avgTime[id] / wallTime : 0.0;
+    double imbalance = avgTime[id] > 0.0 ? 
+      100.0 * (maxTime[id] / avgTime[id] - 1.0) : 0.0;
+
+    char line[256];
+    sprintf(line, "%-36s %10ld %12.4f %12.4f %12.4f %7.2f %7.2f\n",
+            label.c_str(), t.calls, minTime[id], avgTime[id], maxTime[id],
+            percent, imbalance);
+    report += line;
+
+    for (unsigned int c = 0; c < children[id].size(); c++) 
+      appendReport(report, children[id][c], children, minTime, avgTime,
+                   maxTime, wallTime);
+  }
+}
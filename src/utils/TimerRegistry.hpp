@@ -0,0 +1,154 @@
+/*
+ * Copyright (c) 2018 The University of Notre Dame. All Rights Reserved.
+ *
+ * The University of Notre Dame grants you ("Licensee") a
+ * non-exclusive, royalty free, license to use, modify and
+ * redistribute this software in source and binary code form, provided
+ * that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the
+ *    distribution.
+ *
+ * This software is provided "AS IS," without a warranty of any
+ * kind. All express or implied conditions, representations and
+ * warranties, including any implied warranty of merchantability,
+ * fitness for a particular purpose or non-infringement, are hereby
+ * excluded.  The University of Notre Dame and its licensors shall not
+ * be liable for any damages suffered by licensee as a result of
+ * using, modifying or distributing the software or its
+ * derivatives. In no event will the University of Notre Dame or its
+ * licensors be liable for any lost revenue, profit or data, or for
+ * direct, indirect, special, consequential, incidental or punitive
+ * damages, however caused and regardless of the theory of liability,
+ * arising out of the use of or inability to use software, even if the
+ * University of Notre Dame has been advised of the possibility of
+ * such damages.
+ *
+ * SUPPORT OPEN SCIENCE!  If you use OpenMD or its source code in your
+ * research, please cite the appropriate papers when you publish your
+ * work.  Good starting points are:
+ *                                                                      
+ * [1]  Meineke, et al., J. Comp. Chem. 26, 252-271 (2005).             
+ * [2]  Fennell & Gezelter, J. Chem. Phys. 124, 234104 (2006).          
+ * [3]  Sun, Lin & Gezelter, J. Chem. Phys. 128, 234107 (2008).          
+ * [4]  Kuang & Gezelter,  J. Chem. Phys. 133, 164101 (2010).
+ * [5]  Vardeman, Stocker & Gezelter, J. Chem. Theory Comput. 7, 834 (2011).
+ */
+ 
+#ifndef UTILS_TIMERREGISTRY_HPP
+#define UTILS_TIMERREGISTRY_HPP
+
+#include <chrono>
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "config.h"
+
+namespace OpenMD {
+
+  /**
+   * @class TimerRegistry
+   * @brief Hierarchical wall-clock timers for the phases of a run.
+   *
+   * Timers are named by paths such as "Force/LongRange/PairLoop";
+   * the parents of a path are created along with it, and the report
+   * is printed as a tree.  Call sites look the identifier up once:
+   *
+   * @code
+   *   static int timer = TimerRegistry::getInstance()->getTimerID("Output/Dump");
+   *   ScopedTimer scope(timer);
+   * @endcode
+   *
+   * Starting and stopping a timer only reads the steady clock, so the
+   * timers can stay on in production runs.  The timers themselves are
+   * meant to be used from the main thread only; programs that run
+   * several systems on worker threads switch them off, although the
+   * identifiers may still be looked up from any thread.
+   */
+  class TimerRegistry {
+  public:
+    static TimerRegistry* getInstance() {
+      if (instance_ == NULL) {
+        instance_ = new TimerRegistry();
+      }
+      return instance_;
+    }
+
+    /** Returns the identifier of the named timer, creating it if needed */
+    int getTimerID(const std::string& name);
+
+    bool isEnabled() { return enabled_; }
+    void setEnabled(bool enabled) { enabled_ = enabled; }
+
+    void start(int id) {
+      if (!enabled_) return;
+      timers_[id].begin = Clock::now();
+    }
+
+    void stop(int id) {
+      if (!enabled_) return;
+      Timer& t = timers_[id];
+      t.total += std::chrono::duration<double>(Clock::now() - t.begin).count();
+      t.calls++;
+    }
+
+    /** Accumulated seconds spent in the named timer (0 if unknown) */
+    double getTime(const std::string& name);
+
+    /** Seconds since the registry was created */
+    double getWallTime() {
+      return std::chrono::duration<double>(Clock::now() - created_).count();
+    }
+
+    /**
+     * Builds the timing report.  In parallel runs this is a collective
+     * call; the per-rank minimum, average and maximum are reported on
+     * the primary rank along with the load imbalance (max/avg - 1).
+     */
+    std::string getReport();
+
+  private:
+    typedef std::chrono::steady_clock Clock;
+
+    struct Timer {
+      std::string name;
+      int parent;
+      int depth;
+      double total;
+      long calls;
+      Clock::time_point begin;
+    };
+
+    TimerRegistry();
+    void appendReport(std::string& report, int id,
+                      const std::vector<std::vector<int> >& children,
+                      const std::vector<double>& minTime,
+                      const std::vector<double>& avgTime,
+                      const std::vector<double>& maxTime,
+                      double wallTime);
+
+    static TimerRegistry* instance_;
+    bool enabled_;
+    std::recursive_mutex mutex_;
+    std::vector<Timer> timers_;
+    std::map<std::string, int> timerMap_;
+    Clock::time_point created_;
+  };
+
+  /** Runs a registered timer for the lifetime of the object */
+  class ScopedTimer {
+  public:
+    ScopedTimer(int id) : id_(id) { TimerRegistry::getInstance()->start(id_); }
+    ~ScopedTimer() { TimerRegistry::getInstance()->stop(id_); }
+  private:
+    int id_;
+  };
+}
+#endif
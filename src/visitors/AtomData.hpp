@@ -55,6 +55,24 @@ namespace OpenMD {
                  eField(V3Zero), charge(0.0),
                  hasCharge(false), hasVector(false), hasVelocity(false), 
                  hasForce(false), hasElectricField(false), hasGlobalID(false) {}
+
+    /** Restores the default values, keeping the name's storage */
+    void clear() {
+      atomTypeName.clear();
+      globalID = 0;
+      pos = V3Zero;
+      vec = V3Zero;
+      vel = V3Zero;
+      frc = V3Zero;
+      eField = V3Zero;
+      charge = 0.0;
+      hasCharge = false;
+      hasVector = false;
+      hasVelocity = false;
+      hasForce = false;
+      hasElectricField = false;
+      hasGlobalID = false;
+    }
     
     std::string atomTypeName;
     int globalID;
@@ -72,42 +90,121 @@ namespace OpenMD {
     bool hasGlobalID;
   };
 
+  /**
+   * @class AtomData
+   * @brief The output sites generated by the visitors for one
+   * StuntDouble.  Cleared records are kept and handed out again by
+   * newAtomInfo(), so an AtomData that is reused from frame to frame
+   * stops allocating once it has seen its largest frame.
+   */
   class AtomData : public GenericData{
   public:
 
-    AtomData(const std::string& id = "ATOMDATA") : GenericData(id) {}
+    AtomData(const std::string& id = "ATOMDATA") : GenericData(id), 
+                                                   nActive_(0) {}
 
     ~AtomData() {
       std::vector<AtomInfo*>::iterator i;
-      AtomInfo* atomInfo;
-
-      for(atomInfo = beginAtomInfo(i); atomInfo; atomInfo  = nextAtomInfo(i)) {
-	delete atomInfo;
+      for(i = data.begin(); i != data.end(); ++i) {
+	delete *i;
       }
       data.clear();
     }
-        
-    void addAtomInfo(AtomInfo* info) {data.push_back(info);}
 
-    void clearAllAtomInfo();
+    /** Appends an AtomInfo, taking ownership of it */
+    void addAtomInfo(AtomInfo* info) {
+      if (nActive_ < data.size()) {
+        data.push_back(data[nActive_]);
+        data[nActive_] = info;
+      } else {
+        data.push_back(info);
+      }
+      ++nActive_;
+    }
+
+    /** Appends a default AtomInfo, recycling a cleared one if possible */
+    AtomInfo* newAtomInfo() {
+      if (nActive_ == data.size()) 
+        data.push_back(new AtomInfo);
+      else 
+        data[nActive_]->clear();
+      return data[nActive_++];
+    }
+
+    /** Empties the list while keeping the records for reuse */
+    void clearAllAtomInfo() { nActive_ = 0; }
 
     AtomInfo* beginAtomInfo(std::vector<AtomInfo*>::iterator& i){
       i = data.begin();
-      return i != data.end()? *i : NULL;
+      return nActive_ > 0 ? *i : NULL;
     }
 
     AtomInfo* nextAtomInfo(std::vector<AtomInfo*>::iterator& i){
       ++i;
-      return i != data.end()? *i: NULL;
+      return static_cast<size_t>(i - data.begin()) < nActive_ ? *i : NULL;
     }
 
-    std::vector<AtomInfo*> getData() {return data;}
+    std::vector<AtomInfo*> getData() {
+      return std::vector<AtomInfo*>(data.begin(), data.begin() + nActive_);
+    }
 
-    int getSize() {return data.size();}
+    int getSize() {return nActive_;}
 
   protected:
 
     std::vector<AtomInfo*> data;
+    size_t nActive_;
+  };
+
+  /**
+   * @class AtomDataTable
+   * @brief Per-StuntDouble AtomData records and visited flags,
+   * indexed by global index (atoms first, then rigid bodies).
+   *
+   * When a visitor pipeline is given a table, the visitors use it
+   * instead of the "ATOMDATA" and "VISITED" properties, so that
+   * neither string keyed lookups nor per-frame allocations are
+   * needed.  clear() starts a new frame in O(1) by advancing a stamp;
+   * stale records are emptied when they are next requested.
+   */
+  class AtomDataTable {
+  public:
+    AtomDataTable(int nStuntDoubles) : records_(nStuntDoubles, 
+                                                static_cast<AtomData*>(NULL)),
+                                       presentStamp_(nStuntDoubles, 0),
+                                       visitedStamp_(nStuntDoubles, 0),
+                                       stamp_(1) {}
+
+    ~AtomDataTable() {
+      for (size_t i = 0; i < records_.size(); ++i) delete records_[i];
+    }
+
+    /** Returns the record for index if it was created this frame */
+    AtomData* find(int index) {
+      return presentStamp_[index] == stamp_ ? records_[index] : NULL;
+    }
+
+    /** Returns the (empty) record for index, creating it if needed */
+    AtomData* create(int index) {
+      if (records_[index] == NULL) records_[index] = new AtomData;
+      if (presentStamp_[index] != stamp_) {
+        records_[index]->clearAllAtomInfo();
+        presentStamp_[index] = stamp_;
+      }
+      return records_[index];
+    }
+
+    bool isVisited(int index) { return visitedStamp_[index] == stamp_; }
+    void setVisited(int index) { visitedStamp_[index] = stamp_; }
+
+    /** Forgets all records and flags before the next frame */
+    void clear() { ++stamp_; }
+
+  private:
+    std::vector<AtomData*> records_;
+    std::vector<unsigned int> presentStamp_;
+    std::vector<unsigned int> visitedStamp_;
+    unsigned int stamp_;
   };
 }
 #endif //VISITOR_ATOMDATA_HPP
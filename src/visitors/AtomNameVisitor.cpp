@@ -1,122 +1,109 @@
-/*
- * Copyright (c) 2005 The University of Notre Dame. All Rights Reserved.
- *
- * The University of Notre Dame grants you ("Licensee") a
- * non-exclusive, royalty free, license to use, modify and
- * redistribute this software in source and binary code form, provided
- * that the following conditions are met:
- *
- * 1. Redistributions of source code must retain the above copyright
- *    notice, this list of conditions and the following disclaimer.
- *
- * 2. Redistributions in binary form must reproduce the above copyright
- *    notice, this list of conditions and the following disclaimer in the
- *    documentation and/or other materials provided with the
- *    distribution.
- *
- * This software is provided "AS IS," without a warranty of any
- * kind. All express or implied conditions, representations and
- * warranties, including any implied warranty of merchantability,
- * fitness for a particular purpose or non-infringement, are hereby
- * excluded.  The University of Notre Dame and its licensors shall not
- * be liable for any damages suffered by licensee as a result of
- * using, modifying or distributing the software or its
- * derivatives. In no event will the University of Notre Dame or its
- * licensors be liable for any lost revenue, profit or data, or for
- * direct, indirect, special, consequential, incidental or punitive
- * damages, however caused and regardless of the theory of liability,
- * arising out of the use of or inability to use software, even if the
- * University of Notre Dame has been advised of the possibility of
- * such damages.
- *
- * SUPPORT OPEN SCIENCE!  If you use OpenMD or its source code in your
- * research, please cite the appropriate papers when you publish your
- * work.  Good starting points are:
- *                                                                      
- * [1]  Meineke, et al., J. Comp. Chem. 26, 252-271 (2005).             
- * [2]  Fennell & Gezelter, J. Chem. Phys. 124, 234104 (2006).          
- * [3]  Sun, Lin & Gezelter, J. Chem. Phys. 128, 234107 (2008).          
- * [4]  Vardeman, Stocker & Gezelter, J. Chem. Theory Comput. 7, 834 (2011).                        
- */
-#include <sstream> 
-#include <fstream>
-#include "visitors/AtomNameVisitor.hpp"
-#include "utils/Trim.hpp"
-#include "utils/StringTokenizer.hpp"
-#include "brains/SimInfo.hpp"
-
-
-namespace OpenMD {
-  AtomNameVisitor::AtomNameVisitor(SimInfo* info) : BaseVisitor(), 
-                                                    info_(info) {
-    visitorName = "AtomNameVisitor";
-    ff_ = info_->getForceField();
-  }
-  
-  
-  void AtomNameVisitor::visitAtom(Atom* atom) {
-    AtomData* atomData;
-    GenericData* data;    
-    
-    data = atom->getPropertyByName("ATOMDATA");
-    if(data != NULL){
-      atomData = dynamic_cast<AtomData*>(data);  
-      if(atomData == NULL){
-	std::cerr << "can not get Atom Data from " << atom->getType() 
-                  << std::endl;
-	atomData = new AtomData; 
-      } else {
-      }
-    } else {
-      atomData = new AtomData;
-    }
-    
-    std::vector<AtomInfo*>::iterator i;
-    for (AtomInfo* atomInfo = atomData->beginAtomInfo(i); 
-         atomInfo != NULL; 
-         atomInfo = atomData->nextAtomInfo(i)) {
-      
-      // query the force field for the AtomType associated with this
-      // atomTypeName:
-      AtomType* at = ff_->getAtomType(atomInfo->atomTypeName);
-      // get the chain of base types for this atom type:
-      std::vector<AtomType*> ayb = at->allYourBase();
-      // use the last type in the chain of base types for the name:
-      std::string bn = ayb[ayb.size()-1]->getName();
-      
-      atomInfo->atomTypeName = bn;      
-    }
-  }
-  
-  void AtomNameVisitor::visit(RigidBody* rb) {
-    std::vector<Atom*>::iterator i;
-    
-    for (Atom* atom = rb->beginAtom(i); atom != NULL; atom = rb->nextAtom(i)) {
-      visit(atom);
-    }
-  }
-  
-  
-  const std::string AtomNameVisitor::toString() {
-    char   buffer[65535];
-    std::string result;
-    
-    sprintf(buffer,
-            "------------------------------------------------------------------\n");
-    result += buffer;
-    
-    sprintf(buffer, "Visitor name: %s\n", visitorName.c_str());
-    result += buffer;
-    
-    sprintf(buffer,
-            "Visitor Description: print base atom types\n");
-    result += buffer;
-    
-    sprintf(buffer,
-            "------------------------------------------------------------------\n");
-    result += buffer;
-    
-    return result;
-  }
-  
-}
+/*
+ * Copyright (c) 2005 The University of Notre Dame. All Rights Reserved.
+ *
+ * The University of Notre Dame grants you ("Licensee") a
+ * non-exclusive, royalty free, license to use, modify and
+ * redistribute this software in source and binary code form, provided
+ * that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the
+ *    distribution.
+ *
+ * This software is provided "AS IS," without a warranty of any
+ * kind. All express or implied conditions, representations and
+ * warranties, including any implied warranty of merchantability,
+ * fitness for a particular purpose or non-infringement, are hereby
+ * excluded.  The University of Notre Dame and its licensors shall not
+ * be liable for any damages suffered by licensee as a result of
+ * using, modifying or distributing the software or its
+ * derivatives. In no event will the University of Notre Dame or its
+ * licensors be liable for any lost revenue, profit or data, or for
+ * direct, indirect, special, consequential, incidental or punitive
+ * damages, however caused and regardless of the theory of liability,
+ * arising out of the use of or inability to use software, even if the
+ * University of Notre Dame has been advised of the possibility of
+ * such damages.
+ *
+ * SUPPORT OPEN SCIENCE!  If you use OpenMD or its source code in your
+ * research, please cite the appropriate papers when you publish your
+ * work.  Good starting points are:
+ *                                                                      
+ * [1]  Meineke, et al., J. Comp. Chem. 26, 252-271 (2005).             
+ * [2]  Fennell & Gezelter, J. Chem. Phys. 124, 234104 (2006).          
+ * [3]  Sun, Lin & Gezelter, J. Chem. Phys. 128, 234107 (2008).          
+ * [4]  Vardeman, Stocker & Gezelter, J. Chem. Theory Comput. 7, 834 (2011).                        
+ */
+#include <sstream> 
+#include <fstream>
+#include "visitors/AtomNameVisitor.hpp"
+#include "utils/Trim.hpp"
+#include "utils/StringTokenizer.hpp"
+#include "brains/SimInfo.hpp"
+
+
+namespace OpenMD {
+  AtomNameVisitor::AtomNameVisitor(SimInfo* info) : BaseVisitor(), 
+                                                    info_(info) {
+    visitorName = "AtomNameVisitor";
+    ff_ = info_->getForceField();
+  }
+  
+  
+  void AtomNameVisitor::visitAtom(Atom* atom) {
+    AtomData* atomData = findAtomData(atom);
+    if (atomData == NULL) return;
+    
+    std::vector<AtomInfo*>::iterator i;
+    for (AtomInfo* atomInfo = atomData->beginAtomInfo(i); 
+         atomInfo != NULL; 
+         atomInfo = atomData->nextAtomInfo(i)) {
+      
+      // query the force field for the AtomType associated with this
+      // atomTypeName:
+      AtomType* at = ff_->getAtomType(atomInfo->atomTypeName);
+      // get the chain of base types for this atom type:
+      std::vector<AtomType*> ayb = at->allYourBase();
+      // use the last type in the chain of base types for the name:
+      std::string bn = ayb[ayb.size()-1]->getName();
+      
+      atomInfo->atomTypeName = bn;      
+    }
+  }
+  
+  void AtomNameVisitor::visit(RigidBody* rb) {
+    std::vector<Atom*>::iterator i;
+    
+    for (Atom* atom = rb->beginAtom(i); atom != NULL; atom = rb->nextAtom(i)) {
+      visit(atom);
+    }
+  }
+  
+  
+  const std::string AtomNameVisitor::toString() {
+    char   buffer[65535];
+    std::string result;
+    
+    sprintf(buffer,
+            "------------------------------------------------------------------\n");
+    result += buffer;
+    
+    sprintf(buffer, "Visitor name: %s\n", visitorName.c_str());
+    result += buffer;
+    
+    sprintf(buffer,
+            "Visitor Description: print base atom types\n");
+    result += buffer;
+    
+    sprintf(buffer,
+            "------------------------------------------------------------------\n");
+    result += buffer;
+    
+    return result;
+  }
+  
+}
@@ -65,24 +65,6 @@ namespace OpenMD {
     //  (*atomIter)->accept(this);
   }
 
-  void BaseAtomVisitor::setVisited(Atom *atom) {
-    GenericData *data;
-    data = atom->getPropertyByName("VISITED");
-
-    //if visited property is not existed, add it as new property
-    if (data == NULL) {
-      data = new GenericData();
-      data->setID("VISITED");
-      atom->addProperty(data);
-    }
-  }
-
-  bool BaseAtomVisitor::isVisited(Atom *atom) {
-    GenericData *data;
-    data = atom->getPropertyByName("VISITED");
-    return data == NULL ? false : true;
-  }
-
   //------------------------------------------------------------------------//
 	
   void DefaultAtomVisitor::visit(Atom *atom) {
@@ -93,7 +75,9 @@ namespace OpenMD {
     if (isVisited(atom))
       return;
     
-    atomInfo = new AtomInfo;
+    atomData = getAtomData(atom);
+    atomData->clearAllAtomInfo();
+    atomInfo = atomData->newAtomInfo();
     atomInfo->atomTypeName = atom->getType();
     atomInfo->globalID = atom->getGlobalIndex();
     atomInfo->pos = atom->getPos();
@@ -123,12 +107,6 @@ namespace OpenMD {
       atomInfo->eField = atom->getElectricField();
     }
 
-    atomData = new AtomData;
-    atomData->setID("ATOMDATA");   
-    atomData->addAtomInfo(atomInfo);
-    
-    atom->addProperty(atomData);
-    
     setVisited(atom);
   }
   
@@ -140,7 +118,9 @@ namespace OpenMD {
     if (isVisited(datom))
       return;
     
-    atomInfo = new AtomInfo;
+    atomData = getAtomData(datom);
+    atomData->clearAllAtomInfo();
+    atomInfo = atomData->newAtomInfo();
     atomInfo->atomTypeName = datom->getType();
     atomInfo->globalID = datom->getGlobalIndex();
     atomInfo->pos = datom->getPos();
@@ -183,12 +163,6 @@ namespace OpenMD {
       atomInfo->vec = datom->getA().transpose()*V3Z;
     }
 
-    atomData = new AtomData;
-    atomData->setID("ATOMDATA");   
-    atomData->addAtomInfo(atomInfo);
-
-    datom->addProperty(atomData);
-
     setVisited(datom);
   }
 
@@ -60,8 +60,6 @@ namespace OpenMD {
     virtual void visit(Atom* atom) {}
     virtual void visit(DirectionalAtom* datom) {}
     virtual void visit(RigidBody* rb);
-    void setVisited(Atom* atom);
-    bool isVisited(Atom* atom);
     
   protected:
     BaseAtomVisitor(SimInfo* info);
@@ -0,0 +1,93 @@
+/*
+ * Copyright (c) 2018 The University of Notre Dame. All Rights Reserved.
+ *
+ * The University of Notre Dame grants you ("Licensee") a
+ * non-exclusive, royalty free, license to use, modify and
+ * redistribute this software in source and binary code form, provided
+ * that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the
+ *    distribution.
+ *
+ * This software is provided "AS IS," without a warranty of any
+ * kind. All express or implied conditions, representations and
+ * warranties, including any implied warranty of merchantability,
+ * fitness for a particular purpose or non-infringement, are hereby
+ * excluded.  The University of Notre Dame and its licensors shall not
+ * be liable for any damages suffered by licensee as a result of
+ * using, modifying or distributing the software or its
+ * derivatives. In no event will the University of Notre Dame or its
+ * licensors be liable for any lost revenue, profit or data, or for
+ * direct, indirect, special, consequential, incidental or punitive
+ * damages, however caused and regardless of the theory of liability,
+ * arising out of the use of or inability to use software, even if the
+ * University of Notre Dame has been advised of the possibility of
+ * such damages.
+ *
+ * SUPPORT OPEN SCIENCE!  If you use OpenMD or its source code in your
+ * research, please cite the appropriate papers when you publish your
+ * work.  Good starting points are:
+ *                                                                      
+ * [1]  Meineke, et al., J. Comp. Chem. 26, 252-271 (2005).             
+ * [2]  Fennell & Gezelter, J. Chem. Phys. 124, 234104 (2006).          
+ * [3]  Sun, Lin & Gezelter, J. Chem. Phys. 128, 234107 (2008).          
+ * [4]  Kuang & Gezelter,  J. Chem. Phys. 133, 164101 (2010).
+ * [5]  Vardeman, Stocker & Gezelter, J. Chem. Theory Comput. 7, 834 (2011).
+ */
+ 
+#include "visitors/BaseVisitor.hpp"
+#include "visitors/AtomData.hpp"
+#include "primitives/StuntDouble.hpp"
+
+namespace OpenMD {
+
+  AtomData* BaseVisitor::findAtomData(StuntDouble* sd) {
+    if (atomDataTable_ != NULL)
+      return atomDataTable_->find(sd->getGlobalIndex());
+
+    GenericData* data = sd->getPropertyByName("ATOMDATA");
+    return data == NULL ? NULL : dynamic_cast<AtomData*>(data);
+  }
+
+  AtomData* BaseVisitor::getAtomData(StuntDouble* sd) {
+    if (atomDataTable_ != NULL)
+      return atomDataTable_->create(sd->getGlobalIndex());
+
+    AtomData* atomData = findAtomData(sd);
+    if (atomData == NULL) {
+      // a stale property of the wrong type is replaced
+      sd->removeProperty("ATOMDATA");
+      atomData = new AtomData;
+      atomData->setID("ATOMDATA");
+      sd->addProperty(atomData);
+    }
+    return atomData;
+  }
+
+  void BaseVisitor::setVisited(StuntDouble* sd) {
+    if (atomDataTable_ != NULL) {
+      atomDataTable_->setVisited(sd->getGlobalIndex());
+      return;
+    }
+
+    //if visited property is not existed, add it as new property
+    if (sd->getPropertyByName("VISITED") == NULL) {
+      GenericData* data = new GenericData();
+      data->setID("VISITED");
+      sd->addProperty(data);
+    }
+  }
+
+  bool BaseVisitor::isVisited(StuntDouble* sd) {
+    if (atomDataTable_ != NULL)
+      return atomDataTable_->isVisited(sd->getGlobalIndex());
+
+    return sd->getPropertyByName("VISITED") != NULL;
+  }
+
+}//namespace OpenMD
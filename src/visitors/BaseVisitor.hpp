@@ -56,6 +56,9 @@ namespace OpenMD {
   class Torsion;
   class Inversion;
   class SimInfo;
+  class StuntDouble;
+  class AtomData;
+  class AtomDataTable;
 
   class BaseVisitor{
   public:
@@ -70,6 +73,23 @@ namespace OpenMD {
 
     virtual void update() {}
 
+    /**
+     * Keeps the per-StuntDouble output records and visited flags in
+     * table instead of the "ATOMDATA" and "VISITED" properties.
+     * Passing NULL restores the property based storage.
+     */
+    virtual void setAtomDataTable(AtomDataTable* table) { 
+      atomDataTable_ = table;
+    }
+
+    /** Returns the output record of sd, or NULL if it has none yet */
+    AtomData* findAtomData(StuntDouble* sd);
+    /** Returns the output record of sd, creating an empty one if needed */
+    AtomData* getAtomData(StuntDouble* sd);
+
+    void setVisited(StuntDouble* sd);
+    bool isVisited(StuntDouble* sd);
+
     const std::string& getVisitorName() {return visitorName;}
     virtual const std::string toString() {
       std::string result;
@@ -89,9 +109,10 @@ namespace OpenMD {
 
   protected:
     
-    BaseVisitor() {}
+    BaseVisitor() : atomDataTable_(NULL) {}
 
     std::string visitorName;
+    AtomDataTable* atomDataTable_;
   };
 
 }//end namespace OpenMD
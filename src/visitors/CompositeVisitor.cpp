@@ -60,6 +60,8 @@ namespace OpenMD {
   void CompositeVisitor::addVisitor(BaseVisitor* newVisitor, int priority){
     VisitorIterator i;
     int curPriority;
+
+    newVisitor->setAtomDataTable(atomDataTable_);
   
     for(i = visitorList.begin(); i != visitorList.end(); ++i){
       curPriority = (*i).second;
@@ -160,4 +162,13 @@ namespace OpenMD {
       curVisitor->update();
   }
 
+  void CompositeVisitor::setAtomDataTable(AtomDataTable* table){
+    VisitorIterator i;
+    BaseVisitor* curVisitor;  
+
+    atomDataTable_ = table;
+    for(curVisitor = beginVisitor(i); curVisitor; curVisitor = nextVisitor(i))
+      curVisitor->setAtomDataTable(table);
+  }
+
 }//namespace OpenMD
@@ -62,6 +62,7 @@ namespace OpenMD {
     virtual void visit(DirectionalAtom* datom); 
     virtual void visit(RigidBody* rb); 
     virtual void update();
+    virtual void setAtomDataTable(AtomDataTable* table);
     
     void addVisitor(BaseVisitor* v, int priority = 0);
     BaseVisitor* beginVisitor(VisitorIterator& i);
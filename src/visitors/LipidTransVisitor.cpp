@@ -115,19 +115,12 @@ namespace OpenMD {
   }
 
   void LipidTransVisitor::internalVisit(StuntDouble *sd) {
-    GenericData *                     data;
     AtomData *                        atomData;
     AtomInfo *                        atomInfo;
     std::vector<AtomInfo *>::iterator i;
 
-    data = sd->getPropertyByName("ATOMDATA");
-
-    if (data != NULL) {
-      atomData = dynamic_cast<AtomData *>(data);
-
-      if (atomData == NULL)
-	return;
-    } else
+    atomData = findAtomData(sd);
+    if (atomData == NULL)
       return;
 
     Snapshot* currSnapshot = info_->getSnapshotManager()->getCurrentSnapshot();
@@ -62,19 +62,12 @@ namespace OpenMD {
   }
 
   void WrappingVisitor::internalVisit(StuntDouble *sd) {
-    GenericData *                     data;
     AtomData *                        atomData;
     AtomInfo *                        atomInfo;
     std::vector<AtomInfo *>::iterator i;
 
-    data = sd->getPropertyByName("ATOMDATA");
-
-    if (data != NULL) {
-      atomData = dynamic_cast<AtomData *>(data);
-
-      if (atomData == NULL)
-	return;
-    } else
+    atomData = findAtomData(sd);
+    if (atomData == NULL)
       return;
 
     Snapshot* currSnapshot = info->getSnapshotManager()->getCurrentSnapshot();
@@ -154,21 +147,12 @@ namespace OpenMD {
   }
 
   void ReplicateVisitor::internalVisit(StuntDouble *sd) {
-    GenericData *          data;
     AtomData *             atomData;
 
     //if there is not atom data, just skip it
-    data = sd->getPropertyByName("ATOMDATA");
-
-    if (data != NULL) {
-      atomData = dynamic_cast<AtomData *>(data);
-
-      if (atomData == NULL) {
-	return;
-      }
-    } else {
+    atomData = findAtomData(sd);
+    if (atomData == NULL)
       return;
-    }
 
     Snapshot* currSnapshot = info->getSnapshotManager()->getCurrentSnapshot();
     Mat3x3d box = currSnapshot->getHmat();
@@ -185,13 +169,11 @@ namespace OpenMD {
 
     for( dirIter = dir.begin(); dirIter != dir.end(); ++dirIter ) {
       for( i = infoList.begin(); i != infoList.end(); ++i ) {
-	newAtomInfo = new AtomInfo();
+	newAtomInfo = data->newAtomInfo();
 	*newAtomInfo = *(*i);
 
 	for( int j = 0; j < 3; j++ )
 	  newAtomInfo->pos[j] += (*dirIter)[0]*box(j, 0) + (*dirIter)[1]*box(j, 1) + (*dirIter)[2]*box(j, 2);
-
-	data->addAtomInfo(newAtomInfo);
       }
     } // end for(dirIter)  
   }
@@ -236,7 +218,9 @@ namespace OpenMD {
                                           doVelocities_(false), 
                                           doForces_(false), doVectors_(false),
                                           doCharges_(false), 
-                                          doElectricFields_(false) {
+                                          doElectricFields_(false),
+                                          doGlobalIDs_(false),
+                                          nFrameAtoms_(0) {
     this->info = info;
     visitorName = "XYZVisitor";
     
@@ -250,7 +234,8 @@ namespace OpenMD {
   XYZVisitor::XYZVisitor(SimInfo *info, const std::string& script) :
     BaseVisitor(), seleMan(info), evaluator(info), doPositions_(true),
     doVelocities_(false), doForces_(false), doVectors_(false),
-    doCharges_(false), doElectricFields_(false) {
+    doCharges_(false), doElectricFields_(false), doGlobalIDs_(false),
+    nFrameAtoms_(0) {
     
     this->info = info;
     visitorName = "XYZVisitor";
@@ -285,29 +270,24 @@ namespace OpenMD {
   }
   
   void XYZVisitor::internalVisit(StuntDouble *sd) {
-    GenericData *                     data;
     AtomData *                        atomData;
     AtomInfo *                        atomInfo;
     std::vector<AtomInfo *>::iterator i;
     char                              buffer[1024];
     
     //if there is not atom data, just skip it
-    data = sd->getPropertyByName("ATOMDATA");
-    
-    if (data != NULL) {
-      atomData = dynamic_cast<AtomData *>(data);
-      
-      if (atomData == NULL)
-	return;
-    } else
+    atomData = findAtomData(sd);
+    if (atomData == NULL)
       return;
 
+    // the lines are appended to a single buffer which keeps its
+    // capacity between frames
+    std::string& line = frame_;
+
     for( atomInfo = atomData->beginAtomInfo(i); atomInfo;
          atomInfo = atomData->nextAtomInfo(i) ) {
      
-      std::string line;
-      sprintf(buffer, "%s", atomInfo->atomTypeName.c_str());
-      line += buffer;
+      line += atomInfo->atomTypeName;
       
       if (doPositions_){
         sprintf(buffer, "%15.8f%15.8f%15.8f", atomInfo->pos[0], 
@@ -343,7 +323,8 @@ namespace OpenMD {
         line += buffer;
       }
 
-      frame.push_back(line);
+      line += '\n';
+      ++nFrameAtoms_;
     }    
   }
 
@@ -352,30 +333,34 @@ namespace OpenMD {
   }
 
   void XYZVisitor::writeFrame(std::ostream &outStream) {
-    std::vector<std::string>::iterator i;
+    std::string frameText;
+    formatFrame(frameText);
+    outStream << frameText;
+  }
+
+  void XYZVisitor::formatFrame(std::string& frameText) {
     char buffer[1024];
     
-    if (frame.empty())
+    if (nFrameAtoms_ == 0)
       std::cerr << "Current Frame does not contain any atoms" << std::endl;
     
     //total number of atoms  
-    outStream << frame.size() << std::endl;
+    sprintf(buffer, "%d\n", nFrameAtoms_);
+    frameText.assign(buffer);
     
     //write comment line
     Snapshot* currSnapshot = info->getSnapshotManager()->getCurrentSnapshot();
     Mat3x3d box = currSnapshot->getHmat();
     
     sprintf(buffer,
-            "%15.8f;%15.8f%15.8f%15.8f;%15.8f%15.8f%15.8f;%15.8f%15.8f%15.8f",
+            "%15.8f;%15.8f%15.8f%15.8f;%15.8f%15.8f%15.8f;%15.8f%15.8f%15.8f\n",
             currSnapshot->getTime(),
             box(0, 0), box(0, 1), box(0, 2),
             box(1, 0), box(1, 1), box(1, 2),
             box(2, 0), box(2, 1), box(2, 2));
     
-    outStream << buffer << std::endl;
-    
-    for( i = frame.begin(); i != frame.end(); ++i )
-      outStream << *i << std::endl;
+    frameText += buffer;
+    frameText += frame_;
   }
   
   std::string XYZVisitor::trimmedName(const std::string&atomTypeName) {    
@@ -509,14 +494,8 @@ namespace OpenMD {
       
       for( atomIter = myAtoms.begin(); atomIter != myAtoms.end();
 	   ++atomIter ) {
-	GenericData* data = (*atomIter)->getPropertyByName("ATOMDATA");
-        
-	if (data != NULL) {
-	  atomData = dynamic_cast<AtomData *>(data);
-          
-	  if (atomData == NULL)
-	    continue;
-	} else
+	atomData = findAtomData(*atomIter);
+	if (atomData == NULL)
 	  continue;
         
 	for( AtomInfo* atomInfo = atomData->beginAtomInfo(i); atomInfo;
@@ -116,7 +116,9 @@ namespace OpenMD {
     virtual const std::string toString();
     
     void writeFrame(std::ostream& outStream);    
-    void clear() {frame.clear();}
+    /** Formats the current frame into frameText, reusing its storage */
+    void formatFrame(std::string& frameText);
+    void clear() {frame_.clear(); nFrameAtoms_ = 0;}
     void doPositions(bool pos) {doPositions_ = pos;}
     void doVelocities(bool vel) {doVelocities_ = vel;}
     void doForces(bool frc) {doForces_ = frc;}
@@ -135,7 +137,7 @@ namespace OpenMD {
     SimInfo* info;
     SelectionManager seleMan;
     SelectionEvaluator evaluator; 
-    std::vector<std::string> frame;
+    std::string frame_;
     bool doPositions_;
     bool doVelocities_;
     bool doForces_;
@@ -143,6 +145,7 @@ namespace OpenMD {
     bool doCharges_;
     bool doElectricFields_;
     bool doGlobalIDs_;
+    int nFrameAtoms_;
   };
 
 
@@ -64,20 +64,18 @@ namespace OpenMD {
 
   void ReplacementVisitor::addSite(const std::string &name, 
                                    const Vector3d &refPos) {
-    AtomInfo* atomInfo = new AtomInfo();
+    AtomInfo* atomInfo = sites_->newAtomInfo();
     atomInfo->atomTypeName = name;
     atomInfo->pos = refPos;
-    sites_->addAtomInfo(atomInfo);
   }
   void ReplacementVisitor::addSite(const std::string &name, 
                                    const Vector3d &refPos, 
                                    const Vector3d &refVec) {
-    AtomInfo* atomInfo = new AtomInfo();
+    AtomInfo* atomInfo = sites_->newAtomInfo();
     atomInfo->atomTypeName = name;
     atomInfo->pos = refPos;
     atomInfo->vec = refVec;
     atomInfo->hasVector = true;
-    sites_->addAtomInfo(atomInfo);
   }
   
   void ReplacementVisitor::visit(DirectionalAtom *datom) {
@@ -95,28 +93,12 @@ namespace OpenMD {
     Vector3d     newVec;
     AtomInfo *   atomInfo;
     AtomData *   atomData;
-    GenericData *data;
-    bool         haveAtomData;
     
     //if atom is not one of our recognized atom types, just skip it
     if (!isReplacedAtom(datom->getType())) 
       return;
     
-    data = datom->getPropertyByName("ATOMDATA");
-    
-    if (data != NULL) {
-      atomData = dynamic_cast<AtomData *>(data);
-      
-      if (atomData == NULL) {
-        std::cerr << "can not get Atom Data from " << datom->getType() << std::endl;
-        atomData = new AtomData;
-        haveAtomData = false;
-      } else
-        haveAtomData = true;
-    } else {
-      atomData = new AtomData;
-      haveAtomData = false;
-    }
+    atomData = getAtomData(datom);
         
     pos = datom->getPos();
     vel = datom->getVel();
@@ -147,7 +129,7 @@ namespace OpenMD {
 
       newVec = Atrans * siteInfo->pos;    
       
-      atomInfo = new AtomInfo;
+      atomInfo = atomData->newAtomInfo();
       atomInfo->atomTypeName = siteInfo->atomTypeName;
       atomInfo->pos = pos + newVec;
       
@@ -160,12 +142,6 @@ namespace OpenMD {
 
       atomInfo->vel = vel + mat * siteInfo->pos;
       atomInfo->hasVelocity = true;
-            
-      atomData->addAtomInfo(atomInfo);
-    }
-    if (!haveAtomData) {
-      atomData->setID("ATOMDATA");
-      datom->addProperty(atomData);
     }
     
     setVisited(datom);
@@ -51,10 +51,8 @@ namespace OpenMD {
     Vector3d pos;
     Vector3d u(0, 0, 1);
     Vector3d newVec;
-    GenericData* data;
     AtomData* atomData;
     AtomInfo* atomInfo;
-    bool haveAtomData;
     RotMat3x3d rotMatrix;
 
     if(!canVisit(rb->getType()))
@@ -66,27 +64,9 @@ namespace OpenMD {
     //matVecMul3(rotMatrix, u, newVec);
     newVec = rotMatrix * u;
 
-    data = rb->getPropertyByName("ATOMDATA");
-
-    if(data != NULL){
-      atomData = dynamic_cast<AtomData*>(data);  
-      
-      if(atomData == NULL){
-	std::cerr << "can not get Atom Data from " << rb->getType() << std::endl;
-	
-	atomData = new AtomData; 
-	haveAtomData = false;      
-	
-      } else
-	haveAtomData = true;
-      
-    } else {
-      atomData = new AtomData;
-      haveAtomData = false;
-      
-    }
+    atomData = getAtomData(rb);
 
-    atomInfo = new AtomInfo;
+    atomInfo = atomData->newAtomInfo();
     atomInfo->atomTypeName = "X";
     atomInfo->globalID = globalID;
     atomInfo->pos[0] = pos[0];
@@ -95,14 +75,6 @@ namespace OpenMD {
     atomInfo->vec[0] = newVec[0];
     atomInfo->vec[1] = newVec[1];
     atomInfo->vec[2] = newVec[2];
-
-    atomData->addAtomInfo(atomInfo);
-
-    if(!haveAtomData){
-      atomData->setID("ATOMDATA");
-      rb->addProperty(atomData);
-    }
-
   }
 
 
@@ -154,7 +126,8 @@ namespace OpenMD {
     Vector3d pos;
     pos = rb->getPos();
 
-    atomInfo = new AtomInfo;
+    atomData = getAtomData(rb);
+    atomInfo = atomData->newAtomInfo();
     atomInfo->atomTypeName = "X";
     atomInfo->pos[0] = pos[0];
     atomInfo->pos[1] = pos[1];
@@ -162,13 +135,6 @@ namespace OpenMD {
     atomInfo->vec[0] = 0;
     atomInfo->vec[1] = 0;
     atomInfo->vec[2] = 0;
-
-    atomData = new AtomData; 
-    atomData->setID("ATOMDATA");
-    atomData->addAtomInfo(atomInfo);
-
-    rb->addProperty(atomData);
-
   }
 
 
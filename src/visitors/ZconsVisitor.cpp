@@ -170,19 +170,13 @@ namespace OpenMD {
   }
 
   void ZConsVisitor::internalVisit(StuntDouble* sd, const std::string& prefix){
-    GenericData* data;
     AtomData* atomData;
     AtomInfo* atomInfo;
     std::vector<AtomInfo*>::iterator iter;
 
     //if there is not atom data, just skip it
-    data = sd->getPropertyByName("ATOMDATA");
-    if(data != NULL){
-      atomData = dynamic_cast<AtomData*>(data);  
-      if(atomData == NULL)
-	return;
-    }
-    else
+    atomData = findAtomData(sd);
+    if(atomData == NULL)
       return;
 
     for(atomInfo  = atomData->beginAtomInfo(iter); atomInfo; atomInfo = atomData->nextAtomInfo(iter))
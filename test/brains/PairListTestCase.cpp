@@ -0,0 +1,79 @@
+#include "brains/PairListTestCase.hpp"
+#include <cstdlib>
+#include <set>
+#include <utility>
+
+// Registers the fixture into the 'registry'
+CPPUNIT_TEST_SUITE_REGISTRATION( PairListTestCase );
+
+void PairListTestCase::testAddRemove() {
+    PairList pairs;
+
+    pairs.addPair(3, 1);
+    pairs.addPair(1, 3);   // the same pair in the other order
+    pairs.addPair(2, 2);   // ignored
+    pairs.addPair(0, 5);
+    CPPUNIT_ASSERT(pairs.getSize() == 2);
+    CPPUNIT_ASSERT(pairs.hasPair(1, 3));
+    CPPUNIT_ASSERT(pairs.hasPair(3, 1));
+    CPPUNIT_ASSERT(pairs.hasPair(5, 0));
+    CPPUNIT_ASSERT(!pairs.hasPair(2, 2));
+    CPPUNIT_ASSERT(!pairs.hasPair(1, 5));
+    CPPUNIT_ASSERT(!pairs.hasPair(7, 9));
+
+    pairs.removePair(3, 1);
+    pairs.removePair(4, 6);   // not in the list
+    CPPUNIT_ASSERT(pairs.getSize() == 1);
+    CPPUNIT_ASSERT(!pairs.hasPair(1, 3));
+    CPPUNIT_ASSERT(pairs.hasPair(0, 5));
+
+    // a removed pair can come back:
+    pairs.addPair(1, 3);
+    CPPUNIT_ASSERT(pairs.hasPair(1, 3));
+    CPPUNIT_ASSERT(pairs.getSize() == 2);
+}
+
+void PairListTestCase::testRoundTrip() {
+    PairList pairs;
+    std::set<std::pair<int, int> > reference;
+    int nAtoms = 60;
+
+    srand(7);
+    for (int n = 0; n < 5000; n++) {
+        int i = rand() % nAtoms;
+        int j = rand() % nAtoms;
+        if (i == j) continue;
+        std::pair<int, int> p(std::min(i, j), std::max(i, j));
+        if (rand() % 3 < 2) {
+            pairs.addPair(i, j);
+            reference.insert(p);
+        } else {
+            pairs.removePair(i, j);
+            reference.erase(p);
+        }
+    }
+
+    CPPUNIT_ASSERT(pairs.getSize() == int(reference.size()));
+    for (int i = 0; i < nAtoms; i++)
+        for (int j = 0; j < nAtoms; j++) 
+            CPPUNIT_ASSERT(pairs.hasPair(i, j) == 
+                           (reference.count(std::make_pair(std::min(i, j), 
+                                                           std::max(i, j))) > 0));
+
+    // the CSR arrays hold each pair once, as (i, j) with i < j, sorted
+    // within each row:
+    const std::vector<int>& start = pairs.getRowOffsets();
+    const std::vector<int>& partners = pairs.getPartners();
+    CPPUNIT_ASSERT(int(start.size()) == pairs.getNRows() + 1);
+    CPPUNIT_ASSERT(start.back() == int(partners.size()));
+
+    std::set<std::pair<int, int> > listed;
+    for (int i = 0; i < pairs.getNRows(); i++) {
+        for (int k = start[i]; k < start[i+1]; k++) {
+            CPPUNIT_ASSERT(partners[k] > i);
+            if (k > start[i]) CPPUNIT_ASSERT(partners[k] > partners[k-1]);
+            listed.insert(std::make_pair(i, partners[k]));
+        }
+    }
+    CPPUNIT_ASSERT(listed == reference);
+}
@@ -0,0 +1,21 @@
+#ifndef TEST_PAIRLISTTESTCASE_HPP
+#define TEST_PAIRLISTTESTCASE_HPP
+
+#include <cppunit/extensions/HelperMacros.h>
+#include "brains/PairList.hpp"
+
+using namespace OpenMD;
+
+class PairListTestCase : public CPPUNIT_NS::TestFixture {
+    CPPUNIT_TEST_SUITE( PairListTestCase );
+    CPPUNIT_TEST(testAddRemove);
+    CPPUNIT_TEST(testRoundTrip);
+
+    CPPUNIT_TEST_SUITE_END();
+
+    public:
+        void testAddRemove();
+        void testRoundTrip();
+};
+
+#endif //TEST_PAIRLISTTESTCASE_HPP
@@ -0,0 +1,85 @@
+#include "math/FusedSplineTestCase.hpp"
+#include <cmath>
+
+// Registers the fixture into the 'registry'
+CPPUNIT_TEST_SUITE_REGISTRATION( FusedSplineTestCase );
+
+// single precision coefficients in a MIXED_PRECISION build:
+static const RealType tolerance = (sizeof(PairRealType) < sizeof(RealType)) ?
+  1.0e-5 : 1.0e-12;
+
+void FusedSplineTestCase::setUp() {
+    int n = 101;
+    for (int i = 0; i < n; i++) 
+        x_.push_back(1.0 + 0.05 * i);
+
+    y_.resize(3);
+    for (int i = 0; i < n; i++) {
+        y_[0].push_back(1.0 / x_[i]);
+        y_[1].push_back(exp(-x_[i]) * cos(2.0 * x_[i]));
+        y_[2].push_back(x_[i] * x_[i] * x_[i] - 4.0 * x_[i]);
+    }
+
+    fused_ = new FusedSpline(x_);
+    for (unsigned int k = 0; k < y_.size(); k++) {
+        CubicSpline* spline = new CubicSpline();
+        spline->addPoints(x_, y_[k]);
+        splines_.push_back(spline);
+        // the functions are added both ways:
+        if (k == 0)
+            CPPUNIT_ASSERT(fused_->addSpline(spline) == 0);
+        else
+            CPPUNIT_ASSERT(fused_->addFunction(y_[k]) == int(k));
+    }
+}
+
+void FusedSplineTestCase::tearDown() {
+    for (unsigned int k = 0; k < splines_.size(); k++)
+        delete splines_[k];
+    splines_.clear();
+    delete fused_;
+}
+
+void FusedSplineTestCase::testSingleFunctions() {
+    RealType v, dv, vRef, dvRef;
+
+    for (RealType t = 1.0; t <= 6.0; t += 0.0137) {
+        for (unsigned int k = 0; k < splines_.size(); k++) {
+            splines_[k]->getValueAndDerivativeAt(t, vRef, dvRef);
+            fused_->getValueAndDerivativeAt(t, k, v, dv);
+            CPPUNIT_ASSERT_DOUBLES_EQUAL(vRef, v, tolerance * (1.0 + fabs(vRef)));
+            CPPUNIT_ASSERT_DOUBLES_EQUAL(dvRef, dv, tolerance * (1.0 + fabs(dvRef)));
+            CPPUNIT_ASSERT_DOUBLES_EQUAL(vRef, fused_->getValueAt(t, k), 
+                                         tolerance * (1.0 + fabs(vRef)));
+        }
+    }
+
+    // the one-function forms stand in for a CubicSpline:
+    splines_[0]->getValueAndDerivativeAt(2.345, vRef, dvRef);
+    fused_->getValueAndDerivativeAt(2.345, v, dv);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(vRef, v, tolerance);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(dvRef, dv, tolerance);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(vRef, fused_->getValueAt(2.345), tolerance);
+}
+
+void FusedSplineTestCase::testFusedFunctions() {
+    RealType v[3], dv[3];
+    RealType vRef, dvRef;
+
+    for (RealType t = 1.0; t <= 6.0; t += 0.0137) {
+        // all of the functions, and only the first two:
+        for (int nFunctions = 3; nFunctions >= 2; nFunctions--) {
+            fused_->getValuesAndDerivativesAt(t, nFunctions, v, dv);
+            for (int k = 0; k < nFunctions; k++) {
+                splines_[k]->getValueAndDerivativeAt(t, vRef, dvRef);
+                CPPUNIT_ASSERT_DOUBLES_EQUAL(vRef, v[k], tolerance * (1.0 + fabs(vRef)));
+                CPPUNIT_ASSERT_DOUBLES_EQUAL(dvRef, dv[k], tolerance * (1.0 + fabs(dvRef)));
+            }
+        }
+    }
+
+    // the spline passes through the knots:
+    fused_->getValuesAndDerivativesAt(x_[40], 3, v, dv);
+    for (int k = 0; k < 3; k++)
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(y_[k][40], v[k], tolerance * (1.0 + fabs(y_[k][40])));
+}
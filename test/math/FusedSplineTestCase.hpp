@@ -0,0 +1,30 @@
+#ifndef TEST_FUSEDSPLINETESTCASE_HPP
+#define TEST_FUSEDSPLINETESTCASE_HPP
+
+#include <cppunit/extensions/HelperMacros.h>
+#include "math/FusedSpline.hpp"
+
+using namespace OpenMD;
+
+class FusedSplineTestCase : public CPPUNIT_NS::TestFixture {
+    CPPUNIT_TEST_SUITE( FusedSplineTestCase );
+    CPPUNIT_TEST(testSingleFunctions);
+    CPPUNIT_TEST(testFusedFunctions);
+
+    CPPUNIT_TEST_SUITE_END();
+
+    public:
+        void setUp();
+        void tearDown();
+
+        void testSingleFunctions();
+        void testFusedFunctions();
+
+    private:
+        std::vector<RealType> x_;
+        std::vector<std::vector<RealType> > y_;
+        std::vector<CubicSpline*> splines_;
+        FusedSpline* fused_;
+};
+
+#endif //TEST_FUSEDSPLINETESTCASE_HPP
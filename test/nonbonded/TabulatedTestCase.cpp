@@ -0,0 +1,55 @@
+#include "nonbonded/TabulatedTestCase.hpp"
+#include <cmath>
+
+// Registers the fixture into the 'registry'
+CPPUNIT_TEST_SUITE_REGISTRATION( TabulatedTestCase );
+
+void TabulatedTestCase::setUp() {
+    // a Lennard-Jones table (sigma = 3.4, epsilon = 0.238) on a coarse
+    // grid, so the Hermite polynomials are far from the true function
+    // between the knots:
+    RealType sigma = 3.4;
+    RealType epsilon = 0.238;
+    r0_ = 3.0;
+    dr_ = 0.25;
+    int np = 37;
+
+    for (int i = 0; i < np; i++) {
+        RealType r = r0_ + i * dr_;
+        RealType sr6 = pow(sigma / r, 6);
+        V_.push_back(4.0 * epsilon * (sr6 * sr6 - sr6));
+        F_.push_back(24.0 * epsilon * (2.0 * sr6 * sr6 - sr6) / r);
+    }
+    table_.setPoints(r0_, dr_, V_, F_);
+}
+
+void TabulatedTestCase::testKnots() {
+    RealType pot, deriv;
+
+    CPPUNIT_ASSERT(table_.nIntervals == int(V_.size()) - 1);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(r0_ + (V_.size() - 1) * dr_, table_.rMax, 
+                                 1.0e-12);
+
+    // both V and F = -dV/dr are reproduced at every knot, including
+    // the end of the last interval:
+    for (unsigned int i = 0; i < V_.size(); i++) {
+        table_.getValueAndDerivativeAt(r0_ + i * dr_, pot, deriv);
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(V_[i], pot, 1.0e-10 * (1.0 + fabs(V_[i])));
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(-F_[i], deriv, 1.0e-10 * (1.0 + fabs(F_[i])));
+    }
+}
+
+void TabulatedTestCase::testDerivative() {
+    RealType potM, potP, pot, deriv, dummy;
+    RealType h = 1.0e-5;
+
+    // between the knots the derivative is that of the interpolated
+    // potential, not of the underlying function:
+    for (RealType r = r0_ + 0.01; r < table_.rMax - 0.01; r += 0.0731) {
+        table_.getValueAndDerivativeAt(r, pot, deriv);
+        table_.getValueAndDerivativeAt(r - h, potM, dummy);
+        table_.getValueAndDerivativeAt(r + h, potP, dummy);
+        CPPUNIT_ASSERT_DOUBLES_EQUAL((potP - potM) / (2.0 * h), deriv, 
+                                     1.0e-6 * (1.0 + fabs(deriv)));
+    }
+}
@@ -0,0 +1,30 @@
+#ifndef TEST_TABULATEDTESTCASE_HPP
+#define TEST_TABULATEDTESTCASE_HPP
+
+#include <cppunit/extensions/HelperMacros.h>
+#include "nonbonded/Tabulated.hpp"
+
+using namespace OpenMD;
+
+class TabulatedTestCase : public CPPUNIT_NS::TestFixture {
+    CPPUNIT_TEST_SUITE( TabulatedTestCase );
+    CPPUNIT_TEST(testKnots);
+    CPPUNIT_TEST(testDerivative);
+
+    CPPUNIT_TEST_SUITE_END();
+
+    public:
+        void setUp();
+
+        void testKnots();
+        void testDerivative();
+
+    private:
+        RealType r0_;
+        RealType dr_;
+        std::vector<RealType> V_;
+        std::vector<RealType> F_;
+        TabulatedInteractionData table_;
+};
+
+#endif //TEST_TABULATEDTESTCASE_HPP
@@ -0,0 +1,135 @@
+#!/usr/bin/env python
+"""
+Compares a MIXED_PRECISION build of OpenMD against the default double
+precision build.  Each .omd file is run once with each executable and the
+two .stat files are compared.  For every system the report lists:
+
+  - the relative difference in the potential energy of the first frame,
+    where both builds start from the same configuration,
+  - the drift (least-squares slope, kcal/mol/ns) and the RMS fluctuation
+    of the conserved quantity for each build,
+  - the averages of the potential energy, temperature and pressure over
+    the run for each build.
+
+Example:
+  python mixed_precision.py ../build/bin/openmd ../mixed/bin/openmd \\
+      ../samples/argon/ar864.omd ../samples/metals/EAM/Au_bulk_voter.omd
+"""
+
+import argparse
+import logging
+import math
+import os
+import shutil
+import subprocess
+import tempfile
+
+FORMAT = '%(asctime)-15s %(message)s'
+logging.basicConfig(format=FORMAT)
+
+"""
+Reads an OpenMD .stat file into a dictionary of columns keyed by the
+column title (without the units).
+"""
+def readStat(statFile):
+	titles = []
+	columns = {}
+	fh = open(statFile, "r")
+	for line in fh:
+		if line.startswith("##"):
+			continue
+		if line.startswith("#"):
+			titles = [t.split('(')[0].strip() for t in line[1:].split('\t')]
+			titles = [t for t in titles if t]
+			for t in titles:
+				columns[t] = []
+			continue
+		values = line.split()
+		if len(values) != len(titles):
+			continue
+		for t, v in zip(titles, values):
+			columns[t].append(float(v))
+	fh.close()
+	return columns
+
+def mean(values):
+	return sum(values) / len(values)
+
+"""
+Returns the least-squares slope of y(x) and the RMS deviation from the
+fitted line.
+"""
+def drift(x, y):
+	mx = mean(x)
+	my = mean(y)
+	sxx = sum((xi - mx)**2 for xi in x)
+	if sxx == 0.0:
+		return 0.0, 0.0
+	slope = sum((xi - mx) * (yi - my) for xi, yi in zip(x, y)) / sxx
+	rms = math.sqrt(mean([(yi - my - slope * (xi - mx))**2
+	                      for xi, yi in zip(x, y)]))
+	return slope, rms
+
+"""
+Runs one executable on an .omd file and returns the parsed .stat file.
+The run is done in a temporary copy of the directory holding the .omd
+file, so the input files it refers to are found and the sample's own
+.dump, .eor and .stat files are left alone.  The copy is removed unless
+the run fails.
+"""
+def runOpenMD(openmd, omdFile, label):
+	logger = logging.getLogger("mixed_precision")
+	runDir = os.path.join(tempfile.mkdtemp(prefix = "mixed_precision_"),
+	                      label)
+	shutil.copytree(os.path.dirname(os.path.abspath(omdFile)), runDir)
+	omd = os.path.basename(omdFile)
+	statFile = os.path.join(runDir, os.path.splitext(omd)[0] + ".stat")
+	logName = os.path.join(runDir, label + ".log")
+	if os.path.isfile(statFile):
+		os.remove(statFile)
+	logFile = open(logName, "w")
+	status = subprocess.call([openmd, omd], cwd = runDir,
+	                         stdout = logFile, stderr = subprocess.STDOUT)
+	logFile.close()
+	if status != 0 or not os.path.isfile(statFile):
+		logger.error("%s failed on %s (see %s)", openmd, omdFile, logName)
+		return None
+	stat = readStat(statFile)
+	shutil.rmtree(os.path.dirname(runDir))
+	return stat
+
+def summarize(stat):
+	time = stat["Time"]
+	slope, rms = drift(time, stat["Conserved Quantity"])
+	# kcal/mol/fs -> kcal/mol/ns
+	return { "drift" : slope * 1.0e6,
+	         "rms" : rms,
+	         "pot" : mean(stat["Potential Energy"]),
+	         "temp" : mean(stat["Temperature"]),
+	         "press" : mean(stat["Pressure"]) }
+
+if __name__ == "__main__":
+	parser = argparse.ArgumentParser(description='Validates a mixed precision build against the double precision build')
+	parser.add_argument( 'reference', help = 'openmd executable from the double precision build' )
+	parser.add_argument( 'mixed', help = 'openmd executable from the MIXED_PRECISION build' )
+	parser.add_argument( 'omd', nargs = '+', help = 'OpenMD (.omd) files to run' )
+	args = parser.parse_args()
+
+	if "FORCE_PARAM_PATH" not in os.environ:
+		os.environ["FORCE_PARAM_PATH"] = os.path.abspath("../forceFields")
+
+	print("%-24s %10s %12s %12s %10s %10s %12s %10s" %
+	      ("system", "build", "dV0/V0", "drift", "rms", "<T>", "<V>", "<P>"))
+	for omd in args.omd:
+		ref = runOpenMD(os.path.abspath(args.reference), omd, "double")
+		mix = runOpenMD(os.path.abspath(args.mixed), omd, "mixed")
+		if ref is None or mix is None:
+			continue
+		name = os.path.splitext(os.path.basename(omd))[0]
+		v0 = ref["Potential Energy"][0]
+		dv0 = (mix["Potential Energy"][0] - v0) / abs(v0)
+		for label, stat, d in (("double", ref, 0.0), ("mixed", mix, dv0)):
+			s = summarize(stat)
+			print("%-24s %10s %12.3e %12.4g %10.4g %10.2f %12.2f %10.1f" %
+			      (name, label, d, s["drift"], s["rms"], s["temp"], s["pot"],
+			       s["press"]))